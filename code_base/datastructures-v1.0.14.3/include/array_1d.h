@@ -22,6 +22,8 @@
  *
  * Version information:
  *   v1.0 2018-01-28: First public version.
+ *   v1.1 2026-10-16: Added array_1d_create_with_allocator.
+ *   v1.2 2026-10-17: Added array_1d_memory_usage.
  */
 
 // ==========PUBLIC DATA TYPES============
@@ -46,6 +48,25 @@ typedef struct array_1d array_1d;
  */
 array_1d *array_1d_create(int lo, int hi, free_function free_func);
 
+/**
+ * array_1d_create_with_allocator() - Create an array using an allocator.
+ * @lo: low index limit.
+ * @hi: high index limit.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the array. See util.h. NULL selects malloc()/free().
+ *
+ * The index limits are inclusive, i.e. all indices i such that low <=
+ * i <= high are defined.
+ *
+ * Returns: A pointer to the new array, or NULL if not enough memory
+ * was available.
+ */
+array_1d *array_1d_create_with_allocator(int lo, int hi,
+					 free_function free_func,
+					 const allocator *alloc);
+
 /**
  * array_1d_low() - Return the low index limit for the array.
  * @a: array to inspect.
@@ -117,4 +138,15 @@ void array_1d_kill(array_1d *a);
  */
 void array_1d_print(const array_1d * l, inspect_callback print_func);
 
+/**
+ * array_1d_memory_usage() - Return the memory used by an array.
+ * @a: Array to inspect.
+ *
+ * The positions with a value are counted as elements and the positions
+ * without as slack. Takes time proportional to the size of the array.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage array_1d_memory_usage(const array_1d *a);
+
 #endif
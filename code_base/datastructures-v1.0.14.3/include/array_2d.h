@@ -23,6 +23,8 @@
  * Version information:
  *   v1.0 2018-01-28: First public version.
  *   v1.1 2018-04-03: Moved freehandler to last in create parameter list.
+ *   v1.2 2026-10-16: Added array_2d_create_with_allocator.
+ *   v1.3 2026-10-17: Added array_2d_memory_usage.
  */
 
 // ==========PUBLIC DATA TYPES============
@@ -50,6 +52,27 @@ typedef struct array_2d array_2d;
 array_2d *array_2d_create(int lo1, int hi1, int lo2, int hi2,
                           free_function free_func);
 
+/**
+ * array_2d_create_with_allocator() - Create an array using an allocator.
+ * @lo1: low index limit for first dimension.
+ * @hi1: high index limit for first dimension.
+ * @lo2: low index limit for second dimension.
+ * @hi2: high index limit for second dimension.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the array. See util.h. NULL selects malloc()/free().
+ *
+ * The index limits are inclusive, i.e. all indices i such that low <=
+ * i <= high are defined.
+ *
+ * Returns: A pointer to the new array, or NULL if not enough memory
+ * was available.
+ */
+array_2d *array_2d_create_with_allocator(int lo1, int hi1, int lo2, int hi2,
+					 free_function free_func,
+					 const allocator *alloc);
+
 /**
  * array_2d_low() - Return the low index limit for the array.
  * @a: array to inspect.
@@ -126,4 +149,17 @@ void array_2d_kill(array_2d *a);
  */
 void array_2d_print(const array_2d * l, inspect_callback print_func);
 
+/**
+ * array_2d_memory_usage() - Return the memory used by an array.
+ * @a: Array to inspect.
+ *
+ * The array stores one pointer for each of the positions in both
+ * dimensions, whether it has a value or not. The positions with a value
+ * are counted as elements and the positions without as slack. Takes
+ * time proportional to the number of positions.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage array_2d_memory_usage(const array_2d *a);
+
 #endif
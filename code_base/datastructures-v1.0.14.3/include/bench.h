@@ -0,0 +1,213 @@
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "util.h"
+
+/*
+ * Declaration of a small benchmark harness for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * A benchmark phase is an operation that is called a number of times,
+ * e.g. one table_lookup() per call. The time of each call is measured
+ * with a nanosecond clock, so that the distribution of the times can
+ * be reported, not only the total. Before each repetition of the phase
+ * a setup function is called, e.g. to build the table to look in, and
+ * after it a teardown function. Neither is part of the measured time.
+ *
+ * The phase is first run a number of warm-up repetitions that are not
+ * measured, so that the caches, the branch predictors and the memory
+ * allocator are in the same state for all measured repetitions. The
+ * result holds percentiles of the time per operation, with the cost of
+ * reading the clock subtracted, and the number of operations per
+ * second.
+ *
+ * Operations that take only a few nanoseconds can be timed in batches
+ * of several calls per clock reading. Each call in a batch is then
+ * given the mean time of the batch.
+ *
+ * On Linux, the hardware counters of the processor, e.g. the number of
+ * cycles and cache misses, can also be read for each phase with
+ * perf_event_open(2). They are counted in an extra repetition without
+ * clock readings and reported per operation. A counter that cannot be
+ * opened, e.g. in a virtual machine without a PMU or when the kernel
+ * denies access (see /proc/sys/kernel/perf_event_paranoid), is reported
+ * as NAN and the phase is still timed.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ *   v1.1 2026-10-17: Added best, the mean of the fastest repetition.
+ *   v1.2 2026-10-17: Added hardware counters.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+// Type definition for the setup and teardown functions of a phase.
+typedef void (*bench_function)(void *arg);
+
+// Type definition for the measured operation of a phase. i is the
+// number of the call in the repetition, 0 .. ops - 1.
+typedef void (*bench_op_function)(void *arg, int i);
+
+// A benchmark phase. setup and teardown may be NULL.
+typedef struct bench_phase {
+	const char *name;
+	int ops; // Number of calls of op per repetition.
+	bench_function setup; // Called before each repetition.
+	bench_op_function op; // The measured operation.
+	bench_function teardown; // Called after each repetition.
+} bench_phase;
+
+// Hardware counters that can be read for a phase.
+typedef enum bench_counter {
+	BENCH_CYCLES,
+	BENCH_INSTRUCTIONS,
+	BENCH_L1D_MISSES, // Level 1 data cache read misses.
+	BENCH_LLC_MISSES, // Last level cache read misses.
+	BENCH_BRANCH_MISSES, // Mispredicted branches.
+	BENCH_DTLB_MISSES, // Data TLB read misses.
+	BENCH_COUNTERS // Number of counters.
+} bench_counter;
+
+// Bit mask with all hardware counters, see bench_options.
+#define BENCH_ALL_COUNTERS ((1u << BENCH_COUNTERS) - 1)
+
+// How to run a phase, see bench_default_options().
+typedef struct bench_options {
+	int warmup; // Number of repetitions that are not measured.
+	int repetitions; // Number of measured repetitions.
+	int batch; // Number of calls per clock reading.
+	unsigned counters; // Bit 1 << c is set to read bench_counter c.
+} bench_options;
+
+// The result of a phase. All times are in nanoseconds per operation,
+// except total which is the sum over all measured operations. best is
+// the mean of the fastest measured repetition, which is less affected
+// by interrupts and other programs than the mean of all repetitions.
+// counters holds the hardware counters per operation, NAN for those
+// that were not read.
+typedef struct bench_result {
+	long samples; // Number of measured operations.
+	double min;
+	double mean;
+	double best;
+	double p50;
+	double p99;
+	double p999;
+	double max;
+	double total;
+	double ops_per_sec;
+	double counters[BENCH_COUNTERS];
+} bench_result;
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * bench_now() - Read the clock.
+ *
+ * Uses CLOCK_MONOTONIC_RAW where available, which is not adjusted by
+ * NTP while a benchmark runs, otherwise CLOCK_MONOTONIC.
+ *
+ * Returns: The time in nanoseconds since an arbitrary point.
+ */
+uint64_t bench_now(void);
+
+/**
+ * bench_clock_overhead() - Return the cost of reading the clock.
+ *
+ * Measured once, on the first call, as the lowest time between two
+ * consecutive calls to bench_now().
+ *
+ * Returns: The cost in nanoseconds.
+ */
+double bench_clock_overhead(void);
+
+/**
+ * bench_default_options() - Return the default options.
+ *
+ * One warm-up repetition, one measured repetition, one call per clock
+ * reading and no hardware counters.
+ *
+ * Returns: The default options.
+ */
+bench_options bench_default_options(void);
+
+/**
+ * bench_run() - Run and measure a benchmark phase.
+ * @p: Phase to run.
+ * @opt: How to run the phase, or NULL for bench_default_options().
+ * @arg: Passed on to the functions of the phase.
+ *
+ * Returns: The measured result.
+ */
+bench_result bench_run(const bench_phase *p, const bench_options *opt,
+		       void *arg);
+
+/**
+ * bench_summarize() - Compute a result from measured times.
+ * @samples: Times in nanoseconds per operation. Will be sorted.
+ * @n: Number of times in samples.
+ *
+ * The times are treated as one repetition, i.e. best equals mean.
+ *
+ * Returns: The result. All times are 0 if n is 0. All counters are NAN.
+ */
+bench_result bench_summarize(double *samples, long n);
+
+/**
+ * bench_counter_name() - Return the name of a hardware counter.
+ * @c: The counter.
+ *
+ * The names are lower case with underscores, e.g. "l1d_misses", so
+ * they can be used as column names and JSON keys.
+ *
+ * Returns: The name, or NULL if c is not a counter.
+ */
+const char *bench_counter_name(bench_counter c);
+
+/**
+ * bench_counters_available() - Check which hardware counters can be read.
+ * @counters: Bit mask with the counters to check, see bench_options.
+ *
+ * Opens and closes each counter. Use this to tell the user why the
+ * counters of the results are NAN.
+ *
+ * Returns: Bit mask with the counters in counters that can be read.
+ */
+unsigned bench_counters_available(unsigned counters);
+
+/**
+ * bench_print_header() - Print the column names for bench_print().
+ * @f: Stream to print to.
+ *
+ * Returns: Nothing.
+ */
+void bench_print_header(FILE *f);
+
+/**
+ * bench_print() - Print a result as one line.
+ * @f: Stream to print to.
+ * @name: Name of the phase.
+ * @r: Result to print.
+ *
+ * Returns: Nothing.
+ */
+void bench_print(FILE *f, const char *name, const bench_result *r);
+
+/**
+ * bench_print_counters() - Print the hardware counters of a result.
+ * @f: Stream to print to.
+ * @r: Result to print.
+ *
+ * Prints one indented line with the name and value per operation of
+ * each counter that was read, or nothing if no counter was read. Meant
+ * to follow the line from bench_print().
+ *
+ * Returns: Nothing.
+ */
+void bench_print_counters(FILE *f, const bench_result *r);
+
+#endif
@@ -25,6 +25,10 @@
  *   v1.1 2023-01-19: Added dlist_pos_equal and dlist_pos_is_valid functions.
  *   v1.2 2023-01-20: Renamed dlist_pos_equal to dlist_pos_are_equal.
  *   v1.3 2023-03-23: Renamed dlist_pos_are_equal to dlist_pos_is_equal.
+ *   v1.4 2026-10-16: Added dlist_empty_with_allocator.
+ *   v1.5 2026-10-16: Added dlist_reserve.
+ *   v1.6 2026-10-17: Added dlist_stats and dlist_stats_reset.
+ *   v1.7 2026-10-17: Added dlist_memory_usage.
  */
 
 // ==========PUBLIC DATA TYPES============
@@ -47,6 +51,32 @@ typedef struct cell *dlist_pos;
  */
 dlist *dlist_empty(free_function free_func);
 
+/**
+ * dlist_empty_with_allocator() - Create an empty dlist using an allocator.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the list. See util.h. NULL selects malloc()/free().
+ *
+ * Returns: A pointer to the new list.
+ */
+dlist *dlist_empty_with_allocator(free_function free_func,
+				  const allocator *alloc);
+
+/**
+ * dlist_reserve() - Make room for more elements in a dlist.
+ * @l: List to manipulate.
+ * @n: Number of elements.
+ *
+ * Pre-allocates cells so that the next n inserts into the list do not
+ * allocate any memory. Removed cells are recycled by the list, so a
+ * list that never holds more than n elements after dlist_reserve(l, n)
+ * makes no further calls to the allocator.
+ *
+ * Returns: Nothing.
+ */
+void dlist_reserve(dlist *l, size_t n);
+
 /**
  * dlist_is_empty() - Check if a dlist is empty.
  * @l: List to check.
@@ -144,6 +174,42 @@ void dlist_kill(dlist *l);
  */
 void dlist_print(const dlist *l, inspect_callback print_func);
 
+/**
+ * dlist_stats() - Return the operation statistics of a list.
+ * @l: List to inspect.
+ *
+ * Counts dlist_insert(), dlist_remove() and dlist_inspect() as
+ * operations, and dlist_next() as traversals. See op_stats in util.h.
+ * All fields are 0 unless the list was compiled with DOA_STATS
+ * defined.
+ *
+ * Returns: The statistics since the list was created or last reset.
+ */
+op_stats dlist_stats(const dlist *l);
+
+/**
+ * dlist_stats_reset() - Reset the operation statistics of a list.
+ * @l: List to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void dlist_stats_reset(dlist *l);
+
+/**
+ * dlist_memory_usage() - Return the memory used by a list.
+ * @l: List to inspect.
+ *
+ * The cells with an element are counted as elements, and the unused
+ * cells in the pool, e.g. after dlist_reserve(), as slack. The list
+ * itself, the head cell and the chunk headers are counted as header.
+ * Takes time proportional to the number of chunks.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage dlist_memory_usage(const dlist *l);
+
 /**
  * dlist_pos_is_valid() - Return true for a valid position in a dlist
  * @l: List to inspect.
@@ -0,0 +1,176 @@
+#ifndef __INDEX_HEAP_H
+#define __INDEX_HEAP_H
+
+#include <stdbool.h>
+#include "util.h"
+
+/*
+ * Declaration of an indexed priority queue for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University. The queue holds integer indexes 0 .. capacity - 1, each
+ * at most once, with a priority (double) for each index. The index
+ * with the lowest priority is at the top. Since the queue knows where
+ * each index is stored, the priority of an index in the queue can be
+ * lowered in O(log n) time, as needed by e.g. Dijkstra's algorithm.
+ *
+ * The queue is a d-ary heap. A larger d gives a shallower heap, which
+ * makes push and decrease_key cheaper and pop more expensive. d = 4 is
+ * usually a good choice. After use, the function index_heap_kill must
+ * be called to de-allocate the dynamic memory used by the queue.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ *   v1.1 2026-10-17: Added index_heap_memory_usage.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+// Queue type.
+typedef struct index_heap index_heap;
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * index_heap_empty() - Create an empty queue.
+ * @capacity: Number of indexes, i.e. the indexes are 0 .. capacity - 1.
+ * @arity: Number of children of each node in the heap, at least 2.
+ *
+ * Returns: A pointer to the new queue.
+ */
+index_heap *index_heap_empty(int capacity, int arity);
+
+/**
+ * index_heap_is_empty() - Check if a queue is empty.
+ * @h: Queue to check.
+ *
+ * Returns: True if the queue is empty, otherwise false.
+ */
+bool index_heap_is_empty(const index_heap *h);
+
+/**
+ * index_heap_size() - Return the number of indexes in a queue.
+ * @h: Queue to inspect.
+ *
+ * Returns: The number of indexes in the queue.
+ */
+int index_heap_size(const index_heap *h);
+
+/**
+ * index_heap_contains() - Check if an index is in a queue.
+ * @h: Queue to inspect.
+ * @i: Index to look for.
+ *
+ * Returns: True if i is in the queue, otherwise false.
+ */
+bool index_heap_contains(const index_heap *h, int i);
+
+/**
+ * index_heap_priority() - Return the priority of an index in a queue.
+ * @h: Queue to inspect.
+ * @i: Index to inspect.
+ *
+ * NOTE: Undefined if i is not in the queue.
+ *
+ * Returns: The priority of i.
+ */
+double index_heap_priority(const index_heap *h, int i);
+
+/**
+ * index_heap_push() - Put an index into a queue.
+ * @h: Queue to manipulate.
+ * @i: Index to put into the queue.
+ * @priority: Priority of i.
+ *
+ * NOTE: Undefined if i is already in the queue.
+ *
+ * Returns: The modified queue.
+ */
+index_heap *index_heap_push(index_heap *h, int i, double priority);
+
+/**
+ * index_heap_decrease_key() - Lower the priority of an index in a queue.
+ * @h: Queue to manipulate.
+ * @i: Index to change the priority of.
+ * @priority: New priority of i.
+ *
+ * NOTE: Undefined if i is not in the queue, or if priority is higher
+ * than the current priority of i.
+ *
+ * Returns: The modified queue.
+ */
+index_heap *index_heap_decrease_key(index_heap *h, int i, double priority);
+
+/**
+ * index_heap_top() - Inspect the index with the lowest priority.
+ * @h: Queue to inspect.
+ *
+ * Returns: The index at the top of the queue.
+ *	    NOTE: The return value is undefined for an empty queue.
+ */
+int index_heap_top(const index_heap *h);
+
+/**
+ * index_heap_top_priority() - Inspect the lowest priority in a queue.
+ * @h: Queue to inspect.
+ *
+ * Returns: The priority of the index at the top of the queue.
+ *	    NOTE: The return value is undefined for an empty queue.
+ */
+double index_heap_top_priority(const index_heap *h);
+
+/**
+ * index_heap_pop() - Remove the index with the lowest priority.
+ * @h: Queue to manipulate.
+ *
+ * The removed index may be pushed into the queue again.
+ * NOTE: Undefined for an empty queue.
+ *
+ * Returns: The modified queue.
+ */
+index_heap *index_heap_pop(index_heap *h);
+
+/**
+ * index_heap_clear() - Remove all indexes from a queue.
+ * @h: Queue to manipulate.
+ *
+ * Takes time proportional to the number of indexes in the queue, not
+ * to its capacity.
+ *
+ * Returns: The modified queue.
+ */
+index_heap *index_heap_clear(index_heap *h);
+
+/**
+ * index_heap_kill() - Destroy a given queue.
+ * @h: Queue to destroy.
+ *
+ * Returns all dynamic memory used by the queue.
+ *
+ * Returns: Nothing.
+ */
+void index_heap_kill(index_heap *h);
+
+/**
+ * index_heap_print() - Print the contents of a queue.
+ * @h: Queue to inspect.
+ *
+ * Prints each index and its priority in heap order, i.e. the top
+ * index first but the rest in no particular order.
+ *
+ * Returns: Nothing.
+ */
+void index_heap_print(const index_heap *h);
+
+/**
+ * index_heap_memory_usage() - Return the memory used by a queue.
+ * @h: Queue to inspect.
+ *
+ * The heap entries of the indexes in the queue are counted as elements
+ * and the rest of the heap as slack. The position of each index is
+ * counted as header.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage index_heap_memory_usage(const index_heap *h);
+
+#endif
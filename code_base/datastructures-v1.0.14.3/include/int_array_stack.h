@@ -0,0 +1,140 @@
+#ifndef __INT_ARRAY_STACK_H
+#define __INT_ARRAY_STACK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "util.h"
+
+/*
+ * Declaration of an integer stack for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University. The integers are stored in a dynamic array that grows
+ * as needed, so unlike int_stack.h there is no maximum stack size and
+ * the stack is never copied. push, pop and top are O(1) (push
+ * amortized). After use, the function int_array_stack_kill must be
+ * called to de-allocate the dynamic memory used by the stack.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-17: int_array_stack_push_n() accepts n = 0.
+ *   v1.2 2026-10-17: Added int_array_stack_memory_usage.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+// Stack type.
+typedef struct int_array_stack int_array_stack;
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * int_array_stack_empty() - Create an empty stack.
+ *
+ * Returns: A pointer to the new stack.
+ */
+int_array_stack *int_array_stack_empty(void);
+
+/**
+ * int_array_stack_is_empty() - Check if a stack is empty.
+ * @s: Stack to check.
+ *
+ * Returns: True if stack is empty, otherwise false.
+ */
+bool int_array_stack_is_empty(const int_array_stack *s);
+
+/**
+ * int_array_stack_size() - Return the number of values on a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The number of values on the stack.
+ */
+size_t int_array_stack_size(const int_array_stack *s);
+
+/**
+ * int_array_stack_push() - Push a value on top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Value (integer) to be put on the stack.
+ *
+ * Returns: The modified stack.
+ */
+int_array_stack *int_array_stack_push(int_array_stack *s, int v);
+
+/**
+ * int_array_stack_push_n() - Push several values on top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Array of values to be put on the stack, may be NULL if n is 0.
+ * @n: Number of values in v.
+ *
+ * The values are pushed in array order, i.e. v[n-1] ends up on top.
+ *
+ * Returns: The modified stack.
+ */
+int_array_stack *int_array_stack_push_n(int_array_stack *s, const int *v,
+					size_t n);
+
+/**
+ * int_array_stack_pop() - Remove the element at the top of a stack.
+ * @s: Stack to manipulate.
+ *
+ * NOTE: Undefined for an empty stack.
+ *
+ * Returns: The modified stack.
+ */
+int_array_stack *int_array_stack_pop(int_array_stack *s);
+
+/**
+ * int_array_stack_pop_n() - Remove several values from the top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Array where the removed values are stored, or NULL.
+ * @n: Maximum number of values to remove.
+ *
+ * Removes up to n values. If v is not NULL, the values are stored in
+ * v in the order they are removed, i.e. the old top value in v[0].
+ *
+ * Returns: The number of values removed, i.e. the smaller of n and
+ * the stack size.
+ */
+size_t int_array_stack_pop_n(int_array_stack *s, int *v, size_t n);
+
+/**
+ * int_array_stack_top() - Inspect the value at the top of the stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The value at the top of the stack.
+ *	    NOTE: The return value is undefined for an empty stack.
+ */
+int int_array_stack_top(const int_array_stack *s);
+
+/**
+ * int_array_stack_kill() - Destroy a given stack.
+ * @s: Stack to destroy.
+ *
+ * Returns all dynamic memory used by the stack.
+ *
+ * Returns: Nothing.
+ */
+void int_array_stack_kill(int_array_stack *s);
+
+/**
+ * int_array_stack_print() - Iterate over the stack elements and print
+ *			     their values.
+ * @s: Stack to inspect.
+ *
+ * Iterates over the stack from the top down and prints each integer.
+ *
+ * Returns: Nothing.
+ */
+void int_array_stack_print(const int_array_stack *s);
+
+/**
+ * int_array_stack_memory_usage() - Return the memory used by a stack.
+ * @s: Stack to inspect.
+ *
+ * The array slots with a value are counted as elements, and the unused
+ * array slots as slack.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage int_array_stack_memory_usage(const int_array_stack *s);
+
+#endif
@@ -25,6 +25,10 @@
  *   v1.1 2023-01-19: Added list_pos_equal and list_pos_is_valid functions.
  *   v1.2 2023-01-20: Renamed list_pos_equal to list_pos_are_equal.
  *   v1.3 2023-03-23: Renamed list_pos_are_equal to list_pos_is_equal.
+ *   v1.4 2026-10-16: Added list_empty_with_allocator.
+ *   v1.5 2026-10-16: Added list_reserve.
+ *   v1.6 2026-10-17: Added list_stats and list_stats_reset.
+ *   v1.7 2026-10-17: Added list_memory_usage.
  */
 
 // ==========PUBLIC DATA TYPES============
@@ -46,6 +50,32 @@ typedef struct cell *list_pos;
  */
 list *list_empty(free_function free_func);
 
+/**
+ * list_empty_with_allocator() - Create an empty list using an allocator.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the list. See util.h. NULL selects malloc()/free().
+ *
+ * Returns: A pointer to the new list.
+ */
+list *list_empty_with_allocator(free_function free_func,
+				const allocator *alloc);
+
+/**
+ * list_reserve() - Make room for more elements in a list.
+ * @l: List to manipulate.
+ * @n: Number of elements.
+ *
+ * Pre-allocates cells so that the next n inserts into the list do not
+ * allocate any memory. Removed cells are recycled by the list, so a
+ * list that never holds more than n elements after list_reserve(l, n)
+ * makes no further calls to the allocator.
+ *
+ * Returns: Nothing.
+ */
+void list_reserve(list *l, size_t n);
+
 /**
  * list_is_empty() - Check if a list is empty.
  * @l: List to check.
@@ -153,6 +183,42 @@ void list_kill(list *l);
  */
 void list_print(const list *l, inspect_callback print_func);
 
+/**
+ * list_stats() - Return the operation statistics of a list.
+ * @l: List to inspect.
+ *
+ * Counts list_insert(), list_remove() and list_inspect() as
+ * operations, and list_next() and list_previous() as traversals. See
+ * op_stats in util.h. All fields are 0 unless the list was compiled
+ * with DOA_STATS defined.
+ *
+ * Returns: The statistics since the list was created or last reset.
+ */
+op_stats list_stats(const list *l);
+
+/**
+ * list_stats_reset() - Reset the operation statistics of a list.
+ * @l: List to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void list_stats_reset(list *l);
+
+/**
+ * list_memory_usage() - Return the memory used by a list.
+ * @l: List to inspect.
+ *
+ * The cells with an element are counted as elements, and the unused
+ * cells in the pool, e.g. after list_reserve(), as slack. The list
+ * itself, the two border cells and the chunk headers are counted as
+ * header. Takes time proportional to the number of chunks.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage list_memory_usage(const list *l);
+
 /**
  * list_pos_is_valid() - Return true for a valid position in a list
  * @l: List to inspect.
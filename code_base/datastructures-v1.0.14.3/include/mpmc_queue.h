@@ -0,0 +1,122 @@
+#ifndef __MPMC_QUEUE_H
+#define __MPMC_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "util.h"
+
+/*
+ * Declaration of a generic, bounded multi-producer/multi-consumer
+ * queue for the "Datastructures and algorithms" courses at the
+ * Department of Computing Science, Umea University. The queue stores
+ * void pointers, so it can be used to store all types of values.
+ *
+ * Any number of threads may enqueue and dequeue values at the same
+ * time. mpmc_queue_empty() and mpmc_queue_kill() must not run
+ * concurrently with any other function. The try functions never wait
+ * and only take a lock to wake up a sleeping consumer.
+ * mpmc_queue_dequeue_timed() waits for a value to arrive, which lets
+ * idle consumer threads sleep instead of spinning. NULL may be
+ * enqueued like any other value.
+ *
+ * After use, the function mpmc_queue_kill must be called to
+ * de-allocate the dynamic memory used by the queue itself. The
+ * de-allocation of any dynamic memory allocated for the element
+ * values is the responsibility of the user of the queue, unless a
+ * free_function is registered in mpmc_queue_empty.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-17: Added mpmc_queue_memory_usage.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+// Queue type.
+typedef struct mpmc_queue mpmc_queue;
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * mpmc_queue_empty() - Create an empty queue.
+ * @capacity: Minimum number of values the queue can hold. Rounded up
+ *	      to a power of two, at least 2.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on kill.
+ *
+ * Returns: A pointer to the new queue, or NULL if not enough memory
+ * was available.
+ */
+mpmc_queue *mpmc_queue_empty(size_t capacity, free_function free_func);
+
+/**
+ * mpmc_queue_capacity() - Return the maximum number of values in a queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The number of values the queue can hold.
+ */
+size_t mpmc_queue_capacity(const mpmc_queue *q);
+
+/**
+ * mpmc_queue_memory_usage() - Return the memory used by a queue.
+ * @q: Queue to inspect.
+ *
+ * The slots with a value are counted as elements and the rest as
+ * slack. The split is only exact if no other thread uses the queue at
+ * the same time, but the total always is.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage mpmc_queue_memory_usage(const mpmc_queue *q);
+
+/**
+ * mpmc_queue_try_enqueue() - Put a value at the end of the queue.
+ * @q: Queue to manipulate.
+ * @v: Value (pointer) to be put in the queue.
+ *
+ * Wakes up one consumer waiting in mpmc_queue_dequeue_timed(), if any.
+ *
+ * Returns: True if the value was put in the queue, false if the queue
+ * was full.
+ */
+bool mpmc_queue_try_enqueue(mpmc_queue *q, void *v);
+
+/**
+ * mpmc_queue_try_dequeue() - Remove the value at the front of the queue.
+ * @q: Queue to manipulate.
+ * @v: Pointer to where the removed value is stored.
+ *
+ * The free_func is not called for the removed value, it is handed
+ * over to the caller.
+ *
+ * Returns: True if a value was removed, false if the queue was empty.
+ */
+bool mpmc_queue_try_dequeue(mpmc_queue *q, void **v);
+
+/**
+ * mpmc_queue_dequeue_timed() - Remove a value, waiting if necessary.
+ * @q: Queue to manipulate.
+ * @v: Pointer to where the removed value is stored.
+ * @timeout_ms: Maximum number of milliseconds to wait for a value.
+ *		A negative value waits for ever.
+ *
+ * If the queue is empty, sleeps until a value is enqueued or the
+ * timeout expires.
+ *
+ * Returns: True if a value was removed, false on timeout.
+ */
+bool mpmc_queue_dequeue_timed(mpmc_queue *q, void **v, long timeout_ms);
+
+/**
+ * mpmc_queue_kill() - Destroy a given queue.
+ * @q: Queue to destroy.
+ *
+ * Return all dynamic memory used by the queue. If a free_func was
+ * registered at queue creation, also calls it for each value left in
+ * the queue.
+ *
+ * Returns: Nothing.
+ */
+void mpmc_queue_kill(mpmc_queue *q);
+
+#endif
@@ -21,6 +21,9 @@
  *
  * Version information:
  *   v1.0 2018-01-28: First public version.
+ *   v1.1 2026-10-16: Added queue_empty_with_allocator.
+ *   v1.2 2026-10-17: Added queue_stats and queue_stats_reset.
+ *   v1.3 2026-10-17: Added queue_memory_usage.
  */
 
 // ==========PUBLIC DATA TYPES============
@@ -39,6 +42,18 @@ typedef struct queue queue;
  */
 queue *queue_empty(free_function free_func);
 
+/**
+ * queue_empty_with_allocator() - Create an empty queue using an allocator.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the queue. See util.h. NULL selects malloc()/free().
+ *
+ * Returns: A pointer to the new queue.
+ */
+queue *queue_empty_with_allocator(free_function free_func,
+				  const allocator *alloc);
+
 /**
  * queue_is_empty() - Check if a queue is empty.
  * @q: Queue to check.
@@ -99,4 +114,37 @@ void queue_kill(queue *q);
  */
 void queue_print(const queue *q, inspect_callback print_func);
 
+/**
+ * queue_stats() - Return the operation statistics of a queue.
+ * @q: Queue to inspect.
+ *
+ * Counts queue_enqueue(), queue_dequeue() and queue_front() as
+ * operations. See op_stats in util.h. All fields are 0 unless the
+ * queue was compiled with DOA_STATS defined.
+ *
+ * Returns: The statistics since the queue was created or last reset.
+ */
+op_stats queue_stats(const queue *q);
+
+/**
+ * queue_stats_reset() - Reset the operation statistics of a queue.
+ * @q: Queue to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void queue_stats_reset(queue *q);
+
+/**
+ * queue_memory_usage() - Return the memory used by a queue.
+ * @q: Queue to inspect.
+ *
+ * The cells or array slots with an element are counted as elements,
+ * and the unused cells or slots as slack.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage queue_memory_usage(const queue *q);
+
 #endif
@@ -0,0 +1,138 @@
+#ifndef __SPSC_QUEUE_H
+#define __SPSC_QUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "util.h"
+
+/*
+ * Declaration of a generic, bounded single-producer/single-consumer
+ * queue for the "Datastructures and algorithms" courses at the
+ * Department of Computing Science, Umea University. The queue stores
+ * void pointers, so it can be used to store all types of values.
+ *
+ * The queue can be used to pass values between two threads without
+ * locks. At any time, at most one thread may call the enqueue
+ * functions (the producer) and at most one thread may call the
+ * dequeue functions (the consumer). spsc_queue_empty() and
+ * spsc_queue_kill() must not run concurrently with any other
+ * function.
+ *
+ * All functions return immediately. If the queue is full (empty), the
+ * enqueue (dequeue) functions report that no values were moved. It is
+ * up to the caller to wait, e.g. by retrying or calling sched_yield().
+ *
+ * After use, the function spsc_queue_kill must be called to
+ * de-allocate the dynamic memory used by the queue itself. The
+ * de-allocation of any dynamic memory allocated for the element
+ * values is the responsibility of the user of the queue, unless a
+ * free_function is registered in spsc_queue_empty.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-17: Added spsc_queue_memory_usage.
+ */
+
+// ==========PUBLIC DATA TYPES============
+
+// Queue type.
+typedef struct spsc_queue spsc_queue;
+
+// ==========DATA STRUCTURE INTERFACE==========
+
+/**
+ * spsc_queue_empty() - Create an empty queue.
+ * @capacity: Minimum number of values the queue can hold. Rounded up
+ *	      to a power of two.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on kill.
+ *
+ * Returns: A pointer to the new queue, or NULL if not enough memory
+ * was available.
+ */
+spsc_queue *spsc_queue_empty(size_t capacity, free_function free_func);
+
+/**
+ * spsc_queue_capacity() - Return the maximum number of values in a queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The number of values the queue can hold.
+ */
+size_t spsc_queue_capacity(const spsc_queue *q);
+
+/**
+ * spsc_queue_memory_usage() - Return the memory used by a queue.
+ * @q: Queue to inspect.
+ *
+ * The slots with a value are counted as elements and the rest as
+ * slack. The split is only exact if no other thread uses the queue at
+ * the same time, but the total always is.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage spsc_queue_memory_usage(const spsc_queue *q);
+
+/**
+ * spsc_queue_try_enqueue() - Put a value at the end of the queue.
+ * @q: Queue to manipulate.
+ * @v: Value (pointer) to be put in the queue.
+ *
+ * May only be called by the producer.
+ *
+ * Returns: True if the value was put in the queue, false if the queue
+ * was full.
+ */
+bool spsc_queue_try_enqueue(spsc_queue *q, void *v);
+
+/**
+ * spsc_queue_try_dequeue() - Remove the value at the front of the queue.
+ * @q: Queue to manipulate.
+ * @v: Pointer to where the removed value is stored.
+ *
+ * May only be called by the consumer. The free_func is not called for
+ * the removed value, it is handed over to the caller.
+ *
+ * Returns: True if a value was removed, false if the queue was empty.
+ */
+bool spsc_queue_try_dequeue(spsc_queue *q, void **v);
+
+/**
+ * spsc_queue_try_enqueue_n() - Put several values at the end of the queue.
+ * @q: Queue to manipulate.
+ * @v: Array of values (pointers) to be put in the queue.
+ * @n: Number of values in v.
+ *
+ * Puts as many values from the start of v as there is room for in the
+ * queue. The values become visible to the consumer all at once. May
+ * only be called by the producer.
+ *
+ * Returns: The number of values put in the queue, 0 <= result <= n.
+ */
+size_t spsc_queue_try_enqueue_n(spsc_queue *q, void *const *v, size_t n);
+
+/**
+ * spsc_queue_try_dequeue_n() - Remove several values from the queue.
+ * @q: Queue to manipulate.
+ * @v: Array where the removed values are stored.
+ * @n: Maximum number of values to remove.
+ *
+ * Removes up to n values from the front of the queue and stores them
+ * in queue order at the start of v. May only be called by the consumer.
+ *
+ * Returns: The number of values removed, 0 <= result <= n.
+ */
+size_t spsc_queue_try_dequeue_n(spsc_queue *q, void **v, size_t n);
+
+/**
+ * spsc_queue_kill() - Destroy a given queue.
+ * @q: Queue to destroy.
+ *
+ * Return all dynamic memory used by the queue. If a free_func was
+ * registered at queue creation, also calls it for each value left in
+ * the queue.
+ *
+ * Returns: Nothing.
+ */
+void spsc_queue_kill(spsc_queue *q);
+
+#endif
@@ -21,6 +21,10 @@
  *
  * Version information:
  *   v1.0 2018-01-28: First public version.
+ *   v1.1 2026-10-16: Added stack_empty_with_allocator.
+ *   v1.2 2026-10-16: Added stack_size and stack_reserve.
+ *   v1.3 2026-10-17: Added stack_stats and stack_stats_reset.
+ *   v1.4 2026-10-17: Added stack_memory_usage.
  */
 
 // ==========PUBLIC DATA TYPES============
@@ -39,6 +43,18 @@ typedef struct stack stack;
  */
 stack *stack_empty(free_function free_func);
 
+/**
+ * stack_empty_with_allocator() - Create an empty stack using an allocator.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the stack. See util.h. NULL selects malloc()/free().
+ *
+ * Returns: A pointer to the new stack.
+ */
+stack *stack_empty_with_allocator(free_function free_func,
+				  const allocator *alloc);
+
 /**
  * stack_is_empty() - Check if a stack is empty.
  * @s: Stack to check.
@@ -47,6 +63,28 @@ stack *stack_empty(free_function free_func);
  */
 bool stack_is_empty(const stack *s);
 
+/**
+ * stack_size() - Return the number of elements in a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The number of elements in the stack.
+ */
+size_t stack_size(const stack *s);
+
+/**
+ * stack_reserve() - Prepare a stack for a number of elements.
+ * @s: Stack to manipulate.
+ * @n: Number of elements.
+ *
+ * Makes room for at least n elements, so that the stack does not
+ * allocate memory in stack_push() until it holds more than n
+ * elements. Implementations that allocate memory per element may
+ * ignore the call.
+ *
+ * Returns: Nothing.
+ */
+void stack_reserve(stack *s, size_t n);
+
 /**
  * stack_push() - Push a value on top of a stack.
  * @s: Stack to manipulate.
@@ -101,4 +139,37 @@ void stack_kill(stack *s);
  */
 void stack_print(const stack *s, inspect_callback print_func);
 
+/**
+ * stack_stats() - Return the operation statistics of a stack.
+ * @s: Stack to inspect.
+ *
+ * Counts stack_push(), stack_pop() and stack_top() as operations. See
+ * op_stats in util.h. All fields are 0 unless the stack was compiled
+ * with DOA_STATS defined.
+ *
+ * Returns: The statistics since the stack was created or last reset.
+ */
+op_stats stack_stats(const stack *s);
+
+/**
+ * stack_stats_reset() - Reset the operation statistics of a stack.
+ * @s: Stack to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void stack_stats_reset(stack *s);
+
+/**
+ * stack_memory_usage() - Return the memory used by a stack.
+ * @s: Stack to inspect.
+ *
+ * The cells or array slots with an element are counted as elements,
+ * and the unused array slots, e.g. after stack_reserve(), as slack.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage stack_memory_usage(const stack *s);
+
 #endif
@@ -28,6 +28,10 @@
  *
  * Version information:
  *   v1.0 2018-02-06: First public version.
+ *   v1.1 2026-10-16: Added table_empty_with_hash().
+ *   v1.2 2026-10-16: Added table_empty_with_allocator().
+ *   v1.3 2026-10-17: Added table_stats() and table_stats_reset().
+ *   v1.4 2026-10-17: Added table_memory_usage().
  */
 
 // ==========PUBLIC DATA TYPES============
@@ -51,6 +55,49 @@ table *table_empty(compare_function key_cmp_func,
 		   free_function key_free_func,
 		   free_function value_free_func);
 
+/**
+ * table_empty_with_hash() - Create an empty table with a key hash function.
+ * @key_cmp_func: A pointer to a function to be used to compare keys. See
+ *                util.h for the definition of compare_function.
+ * @key_hash_func: A pointer to a function to be used to hash keys. See
+ *                 util.h for the definition of hash_function.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ *
+ * Keys that key_cmp_func considers equal must have equal hash values.
+ * Implementations that do not use hashing ignore key_hash_func and
+ * behave as table_empty().
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_with_hash(compare_function key_cmp_func,
+			     hash_function key_hash_func,
+			     free_function key_free_func,
+			     free_function value_free_func);
+
+/**
+ * table_empty_with_allocator() - Create an empty table using an allocator.
+ * @key_cmp_func: A pointer to a function to be used to compare keys. See
+ *                util.h for the definition of compare_function.
+ * @key_hash_func: A pointer to a function (or NULL) to be used to hash
+ *                 keys. See table_empty_with_hash().
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the table. See util.h. NULL selects malloc()/free().
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_with_allocator(compare_function key_cmp_func,
+				  hash_function key_hash_func,
+				  free_function key_free_func,
+				  free_function value_free_func,
+				  const allocator *alloc);
+
 /**
  * table_is_empty() - Check if a table is empty.
  * @t: Table to check.
@@ -135,4 +182,42 @@ void table_kill(table *t);
  */
 void table_print(const table *t, inspect_callback_pair print_func);
 
+/**
+ * table_stats() - Return the operation statistics of a table.
+ * @t: Table to inspect.
+ *
+ * Counts table_insert(), table_lookup(), table_remove() and
+ * table_choose_key() as operations, each call of the key compare
+ * function as a comparison, and each entry or slot passed on the way
+ * to a key as a traversal. See op_stats in util.h. All fields are 0
+ * unless the table was compiled with DOA_STATS defined.
+ *
+ * Returns: The statistics since the table was created or last reset.
+ */
+op_stats table_stats(const table *t);
+
+/**
+ * table_stats_reset() - Reset the operation statistics of a table.
+ * @t: Table to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void table_stats_reset(table *t);
+
+/**
+ * table_memory_usage() - Return the memory used by a table.
+ * @t: Table to inspect.
+ *
+ * The entries, list cells or slots with a key-value pair are counted as
+ * elements, including the control bytes of a swisstable, and the unused
+ * entries or slots as slack. Dividing the total by the number of pairs
+ * gives the memory density of an implementation. Takes time proportional
+ * to the number of pairs for the list based tables.
+ *
+ * Returns: The memory usage, see mem_usage in util.h.
+ */
+mem_usage table_memory_usage(const table *t);
+
 #endif
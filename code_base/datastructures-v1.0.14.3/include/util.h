@@ -14,8 +14,17 @@
  *   v1.0 2018-01-28: First public version.
  *   v1.1 2018-02-06: Updated explanation for the compare_function.
  *   v1.2 2023-01-14: Added version DEFINE constants and strings.
+ *   v1.3 2026-10-16: Added hash_function.
+ *   v1.4 2026-10-16: Added allocator.
+ *   v1.5 2026-10-17: Added op_stats.
+ *   v1.6 2026-10-17: Added mem_usage.
+ *   v1.7 2026-10-17: Added the shared allocator helpers mem_alloc etc.
  */
 
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
 // Macros to create a version string out of version constants
 #define STR_HELPER(x) #x
 #define STR(x) STR_HELPER(x)
@@ -23,8 +32,8 @@
 // Version constants
 #define CODE_BASE_MAJOR_VERSION 1
 #define CODE_BASE_MINOR_VERSION 0
-#define CODE_BASE_REVISION 14
-#define CODE_BASE_PATCH 3
+#define CODE_BASE_REVISION 15
+#define CODE_BASE_PATCH 0
 
 // Create a short version string
 #define CODE_BASE_VERSION "v" \
@@ -66,4 +75,188 @@ typedef void (*inspect_callback_pair)(const void *, const void *);
 // value should be returned.
 typedef int compare_function(const void *,const void *);
 
+// Type definition for hash function, used by e.g. hashed tables.
+//
+// Hash functions should return the same value for any two arguments
+// that the matching compare_function considers equal. The returned
+// value does not need to be well distributed; the data type will mix
+// the bits before use.
+typedef size_t hash_function(const void *);
+
+// Type definition for a memory allocator, used by the
+// *_with_allocator constructors of the data types to allocate the
+// memory they use internally. Memory for element values is still the
+// responsibility of the user (see free_function).
+//
+// All functions get the context pointer as their first argument.
+// alloc should return a pointer to at least size bytes, or NULL.
+// realloc should behave as realloc() for a block of old_size bytes;
+// it may be NULL, in which case alloc/free are used instead. free is
+// given the size that was requested for the block. Passing NULL
+// instead of an allocator, or setting alloc to NULL, selects
+// malloc()/realloc()/free().
+typedef struct allocator {
+	void *(*alloc)(void *context, size_t size);
+	void *(*realloc)(void *context, void *ptr, size_t old_size,
+			 size_t new_size);
+	void (*free)(void *context, void *ptr, size_t size);
+	void *context;
+} allocator;
+
+// Helpers used by the data types to allocate through an allocator.
+// They are static inline so that each data type can still be compiled
+// on its own, e.g. in the minimal working examples.
+
+/**
+ * use_allocator() - Return a copy of a user-supplied allocator.
+ * @alloc: Allocator, or NULL for malloc()/free().
+ *
+ * Returns: A copy of *alloc, or an allocator with all fields NULL.
+ */
+static inline allocator use_allocator(const allocator *alloc)
+{
+	allocator a = { NULL, NULL, NULL, NULL };
+	if (alloc != NULL) {
+		a = *alloc;
+	}
+	return a;
+}
+
+/**
+ * mem_alloc_uninit() - Allocate memory that is not initialized.
+ * @a: Allocator to use. malloc() is used if a->alloc is NULL.
+ * @size: Number of bytes to allocate.
+ *
+ * Use for blocks that are overwritten right away, e.g. a new array
+ * that entries are moved to.
+ *
+ * Returns: A pointer to the memory, or NULL on failure.
+ */
+static inline void *mem_alloc_uninit(const allocator *a, size_t size)
+{
+	if (a->alloc == NULL) {
+		return malloc(size);
+	}
+	return a->alloc(a->context, size);
+}
+
+/**
+ * mem_alloc() - Allocate zeroed memory.
+ * @a: Allocator to use. calloc() is used if a->alloc is NULL.
+ * @size: Number of bytes to allocate.
+ *
+ * Returns: A pointer to the memory, or NULL on failure.
+ */
+static inline void *mem_alloc(const allocator *a, size_t size)
+{
+	if (a->alloc == NULL) {
+		return calloc(1, size);
+	}
+	void *p = a->alloc(a->context, size);
+	if (p != NULL) {
+		memset(p, 0, size);
+	}
+	return p;
+}
+
+/**
+ * mem_realloc() - Resize memory allocated by mem_alloc().
+ * @a: Allocator used for the allocation.
+ * @p: Pointer to the memory.
+ * @old_size: Number of bytes that were allocated.
+ * @new_size: Number of bytes wanted.
+ *
+ * Uses a->realloc if present, otherwise allocates a new block and
+ * copies the contents. Bytes beyond old_size are not initialized.
+ *
+ * Returns: A pointer to the resized memory, or NULL on failure, in
+ * which case p is left unchanged.
+ */
+static inline void *mem_realloc(const allocator *a, void *p,
+				size_t old_size, size_t new_size)
+{
+	if (a->alloc == NULL) {
+		return realloc(p, new_size);
+	}
+	if (a->realloc != NULL) {
+		return a->realloc(a->context, p, old_size, new_size);
+	}
+	void *q = a->alloc(a->context, new_size);
+	if (q != NULL) {
+		memcpy(q, p, old_size < new_size ? old_size : new_size);
+		a->free(a->context, p, old_size);
+	}
+	return q;
+}
+
+/**
+ * mem_free() - Free memory allocated by mem_alloc().
+ * @a: Allocator used for the allocation.
+ * @p: Pointer to the memory.
+ * @size: Number of bytes that were allocated.
+ *
+ * Returns: Nothing.
+ */
+static inline void mem_free(const allocator *a, void *p, size_t size)
+{
+	if (a->alloc == NULL) {
+		free(p);
+	} else {
+		a->free(a->context, p, size);
+	}
+}
+
+// Operation statistics of a data type instance, returned by e.g.
+// list_stats() and table_stats().
+//
+// The statistics are only collected if the data types are compiled
+// with DOA_STATS defined, e.g. "make STATS=1" in lib. Otherwise the
+// data types have neither the statistics fields nor the code that
+// updates them, so there is no overhead, and all fields are 0. Since
+// the data types are opaque, a program compiled without DOA_STATS can
+// be linked with data types compiled with it.
+typedef struct op_stats {
+	unsigned long ops; // Inserts, lookups, inspections and removals.
+	unsigned long comparisons; // Calls to the key compare function.
+	unsigned long traversals; // Links followed or slots probed.
+	unsigned long allocations; // Calls to the allocator.
+	size_t size; // Current number of elements.
+	size_t peak_size; // Largest size since creation or the last reset.
+} op_stats;
+
+// Macros used by the data types to update the op_stats field stats of
+// an instance c. STATS_COUNT may also be used on a const instance. All
+// macros expand to nothing unless DOA_STATS is defined.
+#ifdef DOA_STATS
+#define STATS_COUNT(c, field, n) \
+	((void)(((op_stats *)&(c)->stats)->field += (n)))
+#define STATS_ADD_SIZE(c, n) \
+	((c)->stats.size += (n), \
+	 (void)((c)->stats.size > (c)->stats.peak_size ? \
+		((c)->stats.peak_size = (c)->stats.size) : 0))
+#define STATS_SUB_SIZE(c, n) ((void)((c)->stats.size -= (n)))
+#define STATS_GET(c) ((c)->stats)
+#define STATS_RESET(c) \
+	((void)((c)->stats = (op_stats){ 0, 0, 0, 0, (c)->stats.size, \
+					 (c)->stats.size }))
+#else
+#define STATS_COUNT(c, field, n) ((void)0)
+#define STATS_ADD_SIZE(c, n) ((void)0)
+#define STATS_SUB_SIZE(c, n) ((void)0)
+#define STATS_GET(c) ((void)(c), (op_stats){ 0, 0, 0, 0, 0, 0 })
+#define STATS_RESET(c) ((void)(c))
+#endif
+
+// Memory used by a data type instance, returned by e.g.
+// list_memory_usage() and table_memory_usage(). All sizes are in bytes
+// as requested from the allocator, i.e. without the overhead of the
+// allocator itself. The keys and values that the elements point to are
+// not included.
+typedef struct mem_usage {
+	size_t header; // The instance, border cells, index maps and padding.
+	size_t elements; // Cells, entries or slots that hold an element.
+	size_t slack; // Allocated cells, entries or slots not in use.
+	size_t total; // header + elements + slack.
+} mem_usage;
+
 #endif
@@ -16,6 +16,9 @@
  *
  * Version information:
  *   2018-01-28: v1.0, first public version.
+ *   2026-10-16: v1.1, added array_1d_create_with_allocator.
+ *   2026-10-17: v1.2, added array_1d_memory_usage.
+ *   2026-10-17: v1.3, use the allocator helpers in util.h.
  */
 
 // ===========INTERNAL DATA TYPES============
@@ -26,6 +29,7 @@ struct array_1d {
 	int array_size; // Number of array elements.
 	void **values; // Pointer to where the actual values are stored.
 	free_function free_func;
+	allocator alloc;
 };
 
 // ===========INTERNAL FUNCTION IMPLEMENTATIONS============
@@ -45,8 +49,36 @@ struct array_1d {
  */
 array_1d *array_1d_create(int lo, int hi, free_function free_func)
 {
+	return array_1d_create_with_allocator(lo, hi, free_func, NULL);
+}
+
+/**
+ * array_1d_create_with_allocator() - Create an array using an allocator.
+ * @lo: low index limit.
+ * @hi: high index limit.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the array. NULL selects malloc()/free().
+ *
+ * The index limits are inclusive, i.e. all indices i such that low <=
+ * i <= high are defined.
+ *
+ * Returns: A pointer to the new array, or NULL if not enough memory
+ * was available.
+ */
+array_1d *array_1d_create_with_allocator(int lo, int hi,
+					 free_function free_func,
+					 const allocator *alloc)
+{
+	allocator al = use_allocator(alloc);
+
 	// Allocate array structure.
-	array_1d *a=calloc(1, sizeof(*a));
+	array_1d *a=mem_alloc(&al, sizeof(*a));
+	if (a == NULL) {
+		return NULL;
+	}
+	a->alloc=al;
 	// Store index limit.
 	a->low=lo;
 	a->high=hi;
@@ -57,11 +89,11 @@ array_1d *array_1d_create(int lo, int hi, free_function free_func)
 	// Store free function.
 	a->free_func=free_func;
 
-	a->values=calloc(a->array_size, sizeof(void *));
+	a->values=mem_alloc(&a->alloc, a->array_size * sizeof(void *));
 
 	// Check whether the allocation succeeded.
 	if (a->values == NULL) {
-		free(a);
+		mem_free(&al, a, sizeof(*a));
 		a=NULL;
 	}
 	return a;
@@ -160,9 +192,9 @@ void array_1d_kill(array_1d *a)
 		}
 	}
 	// Free actual storage.
-	free(a->values);
+	mem_free(&a->alloc, a->values, a->array_size * sizeof(void *));
 	// Free array structure.
-	free(a);
+	mem_free(&a->alloc, a, sizeof(*a));
 }
 
 /**
@@ -192,3 +224,26 @@ void array_1d_print(const array_1d *a, inspect_callback print_func)
 	}
 	printf(" ]\n");
 }
+
+/**
+ * array_1d_memory_usage() - Return the memory used by an array.
+ * @a: Array to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage array_1d_memory_usage(const array_1d *a)
+{
+	mem_usage m;
+	size_t num_values = 0;
+
+	for (int i = 0; i < a->array_size; i++) {
+		if (a->values[i] != NULL) {
+			num_values++;
+		}
+	}
+	m.header = sizeof(*a);
+	m.elements = num_values * sizeof(void *);
+	m.slack = (a->array_size - num_values) * sizeof(void *);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
@@ -15,6 +15,9 @@
  * Version information:
  *   v1.0  2018-01-28: First public version.
  *   v1.1  2018-04-03: Moved freehandler to last in create parameter list.
+ *   v1.2  2026-10-16: Added array_2d_create_with_allocator.
+ *   v1.3  2026-10-17: Added array_2d_memory_usage.
+ *   v1.4  2026-10-17: Use the allocator helpers in util.h.
  */
 
 // ===========INTERNAL DATA TYPES============
@@ -25,6 +28,7 @@ struct array_2d {
 	int array_size; // Number of array elements.
 	void **values; // Pointer to where the actual values are stored.
 	free_function free_func;
+	allocator alloc;
 };
 
 // ===========INTERNAL FUNCTION IMPLEMENTATIONS============
@@ -47,8 +51,39 @@ struct array_2d {
 array_2d *array_2d_create(int lo1, int hi1, int lo2, int hi2,
 			  free_function free_func)
 {
+	return array_2d_create_with_allocator(lo1, hi1, lo2, hi2, free_func,
+					      NULL);
+}
+
+/**
+ * array_2d_create_with_allocator() - Create an array using an allocator.
+ * @lo1: low index limit for first dimension.
+ * @hi1: high index limit for first dimension.
+ * @lo2: low index limit for second dimension.
+ * @hi2: high index limit for second dimension.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the array. NULL selects malloc()/free().
+ *
+ * The index limits are inclusive, i.e. all indices i such that low <=
+ * i <= high are defined.
+ *
+ * Returns: A pointer to the new array, or NULL if not enough memory
+ * was available.
+ */
+array_2d *array_2d_create_with_allocator(int lo1, int hi1, int lo2, int hi2,
+					 free_function free_func,
+					 const allocator *alloc)
+{
+	allocator al = use_allocator(alloc);
+
 	// Allocate array structure.
-	array_2d *a=calloc(1, sizeof(*a));
+	array_2d *a=mem_alloc(&al, sizeof(*a));
+	if (a == NULL) {
+		return NULL;
+	}
+	a->alloc=al;
 	// Store index limit.
 	a->low[0]=lo1;
 	a->low[1]=lo2;
@@ -61,11 +96,11 @@ array_2d *array_2d_create(int lo1, int hi1, int lo2, int hi2,
 	// Store free function.
 	a->free_func=free_func;
 
-	a->values=calloc(a->array_size, sizeof(void *));
+	a->values=mem_alloc(&a->alloc, a->array_size * sizeof(void *));
 
 	// Check whether the allocation succeeded.
 	if (a->values == NULL) {
-		free(a);
+		mem_free(&al, a, sizeof(*a));
 		a=NULL;
 	}
 	return a;
@@ -188,9 +223,9 @@ void array_2d_kill(array_2d *a)
 		}
 	}
 	// Free actual storage.
-	free(a->values);
+	mem_free(&a->alloc, a->values, a->array_size * sizeof(void *));
 	// Free array structure.
-	free(a);
+	mem_free(&a->alloc, a, sizeof(*a));
 }
 
 /**
@@ -224,3 +259,27 @@ void array_2d_print(const array_2d *a, inspect_callback print_func)
 	}
 	printf(" ]\n");
 }
+
+/**
+ * array_2d_memory_usage() - Return the memory used by an array.
+ * @a: Array to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage array_2d_memory_usage(const array_2d *a)
+{
+	mem_usage m;
+	size_t num_values = 0;
+
+	// All positions are allocated, so count those without a value.
+	for (int i = 0; i < a->array_size; i++) {
+		if (a->values[i] != NULL) {
+			num_values++;
+		}
+	}
+	m.header = sizeof(*a);
+	m.elements = num_values * sizeof(void *);
+	m.slack = (a->array_size - num_values) * sizeof(void *);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
@@ -0,0 +1,464 @@
+// Needed for clock_gettime() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+// Needed for syscall() with -std=c99.
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include <bench.h>
+
+/*
+ * Implementation of a small benchmark harness for the "Datastructures
+ * and algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * Each clock reading, i.e. each call or batch of calls, gives one time
+ * per call. The times of all measured repetitions are collected in one
+ * array, which is sorted to find the percentiles.
+ *
+ * The hardware counters are opened one by one rather than as a group,
+ * so that a counter the processor lacks does not disable the others.
+ * If there are more counters than the PMU can count at the same time,
+ * the kernel takes turns between them, and each count is scaled by the
+ * time it was enabled divided by the time it was counting.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ *   v1.1 2026-10-17: Added best, the mean of the fastest repetition.
+ *   v1.2 2026-10-17: Added hardware counters.
+ */
+
+// CLOCK_MONOTONIC_RAW is Linux specific.
+#ifdef CLOCK_MONOTONIC_RAW
+#define BENCH_CLOCK CLOCK_MONOTONIC_RAW
+#else
+#define BENCH_CLOCK CLOCK_MONOTONIC
+#endif
+
+// Number of pairs of clock readings used to find the clock overhead.
+#define OVERHEAD_ROUNDS 1000
+
+// Names of the hardware counters, in the order of bench_counter.
+static const char *counter_names[BENCH_COUNTERS] = {
+	"cycles", "instructions", "l1d_misses", "llc_misses",
+	"branch_misses", "dtlb_misses"
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * compare_doubles() - Compare two doubles via pointers, for qsort().
+ * @p1, @p2: Pointers to the doubles to compare.
+ *
+ * Returns: Negative, zero or positive if the first double is smaller
+ *	    than, equal to or larger than the second.
+ */
+static int compare_doubles(const void *p1, const void *p2)
+{
+	double d1 = *(const double *)p1;
+	double d2 = *(const double *)p2;
+	return (d1 > d2) - (d1 < d2);
+}
+
+/**
+ * percentile() - Return a percentile of sorted times.
+ * @sorted: Times in increasing order.
+ * @n: Number of times, at least 1.
+ * @q: The fraction of times that should be at most the result.
+ *
+ * Uses the nearest rank, i.e. the smallest time such that at least
+ * q * n times are at most it.
+ *
+ * Returns: The percentile.
+ */
+static double percentile(const double *sorted, long n, double q)
+{
+	long rank = (long)(q * n + 0.999999);
+	if (rank < 1) {
+		rank = 1;
+	}
+	if (rank > n) {
+		rank = n;
+	}
+	return sorted[rank - 1];
+}
+
+/**
+ * counter_open() - Open a hardware counter for the calling thread.
+ * @c: The counter.
+ *
+ * The counter is disabled and only counts in user mode, which the
+ * kernel allows unless perf_event_paranoid is above 2.
+ *
+ * Returns: A file descriptor, or -1 if the counter cannot be opened.
+ */
+static int counter_open(bench_counter c)
+{
+#ifdef __linux__
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = PERF_TYPE_HARDWARE;
+	switch (c) {
+	case BENCH_CYCLES:
+		attr.config = PERF_COUNT_HW_CPU_CYCLES;
+		break;
+	case BENCH_INSTRUCTIONS:
+		attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+		break;
+	case BENCH_BRANCH_MISSES:
+		attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+		break;
+	default:
+		attr.type = PERF_TYPE_HW_CACHE;
+		attr.config = (c == BENCH_L1D_MISSES ? PERF_COUNT_HW_CACHE_L1D :
+			       c == BENCH_LLC_MISSES ? PERF_COUNT_HW_CACHE_LL :
+			       PERF_COUNT_HW_CACHE_DTLB) |
+			(PERF_COUNT_HW_CACHE_OP_READ << 8) |
+			(PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		break;
+	}
+	attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+		PERF_FORMAT_TOTAL_TIME_RUNNING;
+	attr.disabled = 1;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+	(void)c;
+	return -1;
+#endif
+}
+
+/**
+ * counter_read() - Read a hardware counter.
+ * @fd: File descriptor from counter_open().
+ *
+ * Returns: The count, scaled if the counter was not counting all the
+ *	    time it was enabled, or NAN if it did not count at all.
+ */
+static double counter_read(int fd)
+{
+	uint64_t values[3]; // Count, time enabled, time running.
+	if (read(fd, values, sizeof(values)) != sizeof(values) ||
+	    values[2] == 0) {
+		return NAN;
+	}
+	return (double)values[0] * values[1] / values[2];
+}
+
+/**
+ * count_phase() - Run a phase once with hardware counters.
+ * @p: Phase to run.
+ * @counters: Bit mask with the counters to read.
+ * @arg: Passed on to the functions of the phase.
+ * @result: Result where the counters per operation are stored.
+ *
+ * The operations are not timed, so the counts do not include the
+ * clock readings.
+ *
+ * Returns: Nothing.
+ */
+static void count_phase(const bench_phase *p, unsigned counters, void *arg,
+			bench_result *result)
+{
+	int fds[BENCH_COUNTERS];
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		fds[c] = counters & (1u << c) ? counter_open(c) : -1;
+	}
+	if (p->setup != NULL) {
+		p->setup(arg);
+	}
+#ifdef __linux__
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		if (fds[c] >= 0) {
+			ioctl(fds[c], PERF_EVENT_IOC_RESET, 0);
+			ioctl(fds[c], PERF_EVENT_IOC_ENABLE, 0);
+		}
+	}
+#endif
+	for (int i = 0; i < p->ops; i++) {
+		p->op(arg, i);
+	}
+#ifdef __linux__
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		if (fds[c] >= 0) {
+			ioctl(fds[c], PERF_EVENT_IOC_DISABLE, 0);
+		}
+	}
+#endif
+	if (p->teardown != NULL) {
+		p->teardown(arg);
+	}
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		if (fds[c] >= 0) {
+			result->counters[c] = counter_read(fds[c]) / p->ops;
+			close(fds[c]);
+		}
+	}
+}
+
+/**
+ * bench_now() - Read the clock.
+ *
+ * Uses CLOCK_MONOTONIC_RAW where available, which is not adjusted by
+ * NTP while a benchmark runs, otherwise CLOCK_MONOTONIC.
+ *
+ * Returns: The time in nanoseconds since an arbitrary point.
+ */
+uint64_t bench_now(void)
+{
+	struct timespec ts;
+	clock_gettime(BENCH_CLOCK, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * bench_clock_overhead() - Return the cost of reading the clock.
+ *
+ * Measured once, on the first call, as the lowest time between two
+ * consecutive calls to bench_now().
+ *
+ * Returns: The cost in nanoseconds.
+ */
+double bench_clock_overhead(void)
+{
+	static double overhead = -1;
+	if (overhead < 0) {
+		uint64_t lowest = UINT64_MAX;
+		for (int i = 0; i < OVERHEAD_ROUNDS; i++) {
+			uint64_t t0 = bench_now();
+			uint64_t t1 = bench_now();
+			if (t1 - t0 < lowest) {
+				lowest = t1 - t0;
+			}
+		}
+		overhead = lowest;
+	}
+	return overhead;
+}
+
+/**
+ * bench_default_options() - Return the default options.
+ *
+ * One warm-up repetition, one measured repetition, one call per clock
+ * reading and no hardware counters.
+ *
+ * Returns: The default options.
+ */
+bench_options bench_default_options(void)
+{
+	bench_options opt = { 1, 1, 1, 0 };
+	return opt;
+}
+
+/**
+ * bench_run() - Run and measure a benchmark phase.
+ * @p: Phase to run.
+ * @opt: How to run the phase, or NULL for bench_default_options().
+ * @arg: Passed on to the functions of the phase.
+ *
+ * Returns: The measured result.
+ */
+bench_result bench_run(const bench_phase *p, const bench_options *opt,
+		       void *arg)
+{
+	bench_options o = opt != NULL ? *opt : bench_default_options();
+	int batch = o.batch > 0 ? o.batch : 1;
+	int ops = p->ops > 0 ? p->ops : 0;
+	long capacity = (long)ops * (o.repetitions > 0 ? o.repetitions : 0);
+	double *samples = malloc((capacity > 0 ? capacity : 1) *
+				 sizeof(*samples));
+	if (samples == NULL) {
+		fprintf(stderr, "bench_run: Out of memory.\n");
+		exit(EXIT_FAILURE);
+	}
+	double overhead = bench_clock_overhead();
+	long n = 0;
+	double best = -1;
+
+	// The warm-up repetitions have negative numbers.
+	for (int r = -o.warmup; r < o.repetitions; r++) {
+		if (p->setup != NULL) {
+			p->setup(arg);
+		}
+		for (int i = 0; i < ops; i += batch) {
+			int end = i + batch < ops ? i + batch : ops;
+			uint64_t start = bench_now();
+			for (int k = i; k < end; k++) {
+				p->op(arg, k);
+			}
+			uint64_t stop = bench_now();
+			if (r >= 0) {
+				double t = ((double)(stop - start) - overhead) /
+					(end - i);
+				if (t < 0) {
+					t = 0;
+				}
+				for (int k = i; k < end; k++) {
+					samples[n++] = t;
+				}
+			}
+		}
+		if (p->teardown != NULL) {
+			p->teardown(arg);
+		}
+		if (r >= 0 && ops > 0) {
+			double sum = 0;
+			for (long k = n - ops; k < n; k++) {
+				sum += samples[k];
+			}
+			if (best < 0 || sum / ops < best) {
+				best = sum / ops;
+			}
+		}
+	}
+
+	bench_result result = bench_summarize(samples, n);
+	if (best >= 0) {
+		result.best = best;
+	}
+	free(samples);
+	if (o.counters != 0 && ops > 0) {
+		count_phase(p, o.counters, arg, &result);
+	}
+	return result;
+}
+
+/**
+ * bench_summarize() - Compute a result from measured times.
+ * @samples: Times in nanoseconds per operation. Will be sorted.
+ * @n: Number of times in samples.
+ *
+ * The times are treated as one repetition, i.e. best equals mean.
+ *
+ * Returns: The result. All times are 0 if n is 0. All counters are NAN.
+ */
+bench_result bench_summarize(double *samples, long n)
+{
+	bench_result r = { 0 };
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		r.counters[c] = NAN;
+	}
+	if (n <= 0) {
+		return r;
+	}
+	qsort(samples, n, sizeof(*samples), compare_doubles);
+	for (long i = 0; i < n; i++) {
+		r.total += samples[i];
+	}
+	r.samples = n;
+	r.min = samples[0];
+	r.max = samples[n - 1];
+	r.mean = r.total / n;
+	r.best = r.mean;
+	r.p50 = percentile(samples, n, 0.50);
+	r.p99 = percentile(samples, n, 0.99);
+	r.p999 = percentile(samples, n, 0.999);
+	r.ops_per_sec = r.total > 0 ? n / (r.total * 1e-9) : 0;
+	return r;
+}
+
+/**
+ * bench_print_header() - Print the column names for bench_print().
+ * @f: Stream to print to.
+ *
+ * Returns: Nothing.
+ */
+void bench_print_header(FILE *f)
+{
+	fprintf(f, "%-36s %9s %10s %10s %10s %10s %13s\n", "phase", "ops",
+		"mean ns", "p50 ns", "p99 ns", "p99.9 ns", "ops/s");
+}
+
+/**
+ * bench_print() - Print a result as one line.
+ * @f: Stream to print to.
+ * @name: Name of the phase.
+ * @r: Result to print.
+ *
+ * Returns: Nothing.
+ */
+void bench_print(FILE *f, const char *name, const bench_result *r)
+{
+	fprintf(f, "%-36s %9ld %10.1f %10.1f %10.1f %10.1f %13.0f\n", name,
+		r->samples, r->mean, r->p50, r->p99, r->p999,
+		r->ops_per_sec);
+}
+
+/**
+ * bench_counter_name() - Return the name of a hardware counter.
+ * @c: The counter.
+ *
+ * The names are lower case with underscores, e.g. "l1d_misses", so
+ * they can be used as column names and JSON keys.
+ *
+ * Returns: The name, or NULL if c is not a counter.
+ */
+const char *bench_counter_name(bench_counter c)
+{
+	if ((int)c < 0 || c >= BENCH_COUNTERS) {
+		return NULL;
+	}
+	return counter_names[c];
+}
+
+/**
+ * bench_counters_available() - Check which hardware counters can be read.
+ * @counters: Bit mask with the counters to check, see bench_options.
+ *
+ * Opens and closes each counter. Use this to tell the user why the
+ * counters of the results are NAN.
+ *
+ * Returns: Bit mask with the counters in counters that can be read.
+ */
+unsigned bench_counters_available(unsigned counters)
+{
+	unsigned available = 0;
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		if (counters & (1u << c)) {
+			int fd = counter_open(c);
+			if (fd >= 0) {
+				available |= 1u << c;
+				close(fd);
+			}
+		}
+	}
+	return available;
+}
+
+/**
+ * bench_print_counters() - Print the hardware counters of a result.
+ * @f: Stream to print to.
+ * @r: Result to print.
+ *
+ * Prints one indented line with the name and value per operation of
+ * each counter that was read, or nothing if no counter was read. Meant
+ * to follow the line from bench_print().
+ *
+ * Returns: Nothing.
+ */
+void bench_print_counters(FILE *f, const bench_result *r)
+{
+	bool any = false;
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		if (!isnan(r->counters[c])) {
+			fprintf(f, "%s%s %.2f", any ? ", " : "  per op: ",
+				counter_names[c], r->counters[c]);
+			any = true;
+		}
+	}
+	if (any) {
+		fprintf(f, "\n");
+	}
+}
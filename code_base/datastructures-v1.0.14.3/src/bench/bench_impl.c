@@ -0,0 +1,89 @@
+/*
+ * Wrapper that links one table, queue or stack implementation into
+ * bench_suite.c, see bench_suite.h. Compiled once per implementation
+ * with e.g.
+ *
+ *   -DBENCH_TABLE -DBENCH_IMPL=hashtable -DBENCH_SRC='"../table/hashtable.c"'
+ *
+ * The public functions of the implementation are renamed with macros
+ * before the implementation is included, so the object file defines
+ * hashtable_table_insert() etc. instead of table_insert().
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ *   v1.1 2026-10-17: Renamed the statistics functions.
+ *   v1.2 2026-10-17: Added memory_usage to the structs.
+ */
+
+#include <util.h>
+
+// Give a name the prefix BENCH_IMPL, e.g. table_insert becomes
+// hashtable_table_insert. The extra level makes BENCH_IMPL expand
+// before it is pasted.
+#define BENCH_NAME(name) BENCH_PASTE(BENCH_IMPL, name)
+#define BENCH_PASTE(impl, name) BENCH_PASTE2(impl, name)
+#define BENCH_PASTE2(impl, name) impl##_##name
+
+#if defined(BENCH_TABLE)
+#define table_empty BENCH_NAME(table_empty)
+#define table_empty_with_hash BENCH_NAME(table_empty_with_hash)
+#define table_empty_with_allocator BENCH_NAME(table_empty_with_allocator)
+#define table_is_empty BENCH_NAME(table_is_empty)
+#define table_insert BENCH_NAME(table_insert)
+#define table_lookup BENCH_NAME(table_lookup)
+#define table_choose_key BENCH_NAME(table_choose_key)
+#define table_remove BENCH_NAME(table_remove)
+#define table_kill BENCH_NAME(table_kill)
+#define table_print BENCH_NAME(table_print)
+#define table_stats BENCH_NAME(table_stats)
+#define table_stats_reset BENCH_NAME(table_stats_reset)
+#define table_memory_usage BENCH_NAME(table_memory_usage)
+#elif defined(BENCH_QUEUE)
+#define queue_empty BENCH_NAME(queue_empty)
+#define queue_empty_with_allocator BENCH_NAME(queue_empty_with_allocator)
+#define queue_is_empty BENCH_NAME(queue_is_empty)
+#define queue_enqueue BENCH_NAME(queue_enqueue)
+#define queue_dequeue BENCH_NAME(queue_dequeue)
+#define queue_front BENCH_NAME(queue_front)
+#define queue_kill BENCH_NAME(queue_kill)
+#define queue_print BENCH_NAME(queue_print)
+#define queue_stats BENCH_NAME(queue_stats)
+#define queue_stats_reset BENCH_NAME(queue_stats_reset)
+#define queue_memory_usage BENCH_NAME(queue_memory_usage)
+#elif defined(BENCH_STACK)
+#define stack_empty BENCH_NAME(stack_empty)
+#define stack_empty_with_allocator BENCH_NAME(stack_empty_with_allocator)
+#define stack_is_empty BENCH_NAME(stack_is_empty)
+#define stack_size BENCH_NAME(stack_size)
+#define stack_reserve BENCH_NAME(stack_reserve)
+#define stack_push BENCH_NAME(stack_push)
+#define stack_pop BENCH_NAME(stack_pop)
+#define stack_top BENCH_NAME(stack_top)
+#define stack_kill BENCH_NAME(stack_kill)
+#define stack_print BENCH_NAME(stack_print)
+#define stack_stats BENCH_NAME(stack_stats)
+#define stack_stats_reset BENCH_NAME(stack_stats_reset)
+#define stack_memory_usage BENCH_NAME(stack_memory_usage)
+#else
+#error "Define one of BENCH_TABLE, BENCH_QUEUE and BENCH_STACK."
+#endif
+
+#include BENCH_SRC
+#include "bench_suite.h"
+
+#if defined(BENCH_TABLE)
+const struct table_impl BENCH_NAME(table_impl) = {
+	STR(BENCH_IMPL), table_empty_with_hash, table_insert, table_lookup,
+	table_remove, table_kill, table_memory_usage
+};
+#elif defined(BENCH_QUEUE)
+const struct queue_impl BENCH_NAME(queue_impl) = {
+	STR(BENCH_IMPL), queue_empty, queue_is_empty, queue_enqueue,
+	queue_dequeue, queue_front, queue_kill, queue_memory_usage
+};
+#else
+const struct stack_impl BENCH_NAME(stack_impl) = {
+	STR(BENCH_IMPL), stack_empty, stack_is_empty, stack_push, stack_pop,
+	stack_top, stack_kill, stack_memory_usage
+};
+#endif
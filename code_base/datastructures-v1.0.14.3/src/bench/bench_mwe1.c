@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <bench.h>
+
+/*
+ * Minimum working example for bench.c. Measures linear and binary
+ * search for random values in a sorted array.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-17"
+
+// Number of values in the array.
+#define SIZE 10000
+
+// Number of searches per repetition.
+#define SEARCHES 20000
+
+// Data shared by the functions of the phases.
+struct search {
+	int values[SIZE];
+	int keys[SEARCHES];
+	long found;
+};
+
+// Setup: pick new random values to search for.
+static void pick_keys(void *arg)
+{
+	struct search *s = arg;
+	for (int i = 0; i < SEARCHES; i++) {
+		s->keys[i] = rand() % (2 * SIZE);
+	}
+}
+
+// Search for the i:th key by looking at each value in turn.
+static void linear_search(void *arg, int i)
+{
+	struct search *s = arg;
+	for (int k = 0; k < SIZE && s->values[k] <= s->keys[i]; k++) {
+		if (s->values[k] == s->keys[i]) {
+			s->found++;
+			return;
+		}
+	}
+}
+
+// Search for the i:th key by halving the interval.
+static void binary_search(void *arg, int i)
+{
+	struct search *s = arg;
+	int low = 0;
+	int high = SIZE - 1;
+	while (low <= high) {
+		int mid = (low + high) / 2;
+		if (s->values[mid] == s->keys[i]) {
+			s->found++;
+			return;
+		} else if (s->values[mid] < s->keys[i]) {
+			low = mid + 1;
+		} else {
+			high = mid - 1;
+		}
+	}
+}
+
+int main(void)
+{
+	printf("%s, %s %s: Measure searches in a sorted array.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	// The even numbers 0, 2, ..., so half of the searches succeed.
+	struct search *s = malloc(sizeof(*s));
+	for (int i = 0; i < SIZE; i++) {
+		s->values[i] = 2 * i;
+	}
+	s->found = 0;
+
+	bench_phase phases[] = {
+		{ "linear search", SEARCHES, pick_keys, linear_search, NULL },
+		{ "binary search", SEARCHES, pick_keys, binary_search, NULL },
+	};
+
+	// Two warm-up repetitions, five measured.
+	bench_options opt = bench_default_options();
+	opt.warmup = 2;
+	opt.repetitions = 5;
+
+	printf("Clock overhead: %.0f ns.\n\n", bench_clock_overhead());
+	bench_print_header(stdout);
+	for (int p = 0; p < 2; p++) {
+		bench_result r = bench_run(&phases[p], &opt, s);
+		bench_print(stdout, phases[p].name, &r);
+	}
+
+	// Binary search is so fast that the clock overhead is a large
+	// part of the time. Read the clock once per 100 searches instead.
+	opt.batch = 100;
+	bench_result r = bench_run(&phases[1], &opt, s);
+	bench_print(stdout, "binary search (batch of 100)", &r);
+
+	printf("\n%ld searches found the value.\n", s->found);
+	free(s);
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
@@ -0,0 +1,1750 @@
+// Needed for localtime_r() and sysconf() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <bench.h>
+#include <list.h>
+#include <dlist.h>
+#include <array_1d.h>
+#include <array_2d.h>
+#include <int_array_stack.h>
+#include <spsc_queue.h>
+#include <mpmc_queue.h>
+#include <index_heap.h>
+#ifdef BENCH_GRAPH
+#include <graph.h>
+#endif
+#include "bench_suite.h"
+
+/*
+ * Benchmark suite for the data types of the code base. For each
+ * selected data type, implementation and size, a number of phases,
+ * e.g. insert, lookup and remove, are measured with bench_run(). The
+ * results are printed as a text table, JSON or CSV, together with the
+ * commit, compiler and CPU used, and the exponent k of the best fit of
+ * the time of each phase to c * n^k, i.e. about 1 for a phase with n
+ * operations of constant time and about 2 for one with n operations of
+ * linear time.
+ *
+ * All table, queue and stack implementations are linked into the
+ * program, see bench_suite.h. The graph needs an implementation of
+ * graph.h, which is not part of the code base, and is only included if
+ * the program is compiled with e.g. "make suite GRAPH=.../graph.c".
+ *
+ * With -p, the hardware counters given, e.g. cycles and cache misses,
+ * are also read for each phase and printed per operation, see bench.h.
+ * Counters that cannot be read are printed as "-", null or empty.
+ *
+ * With -m memory, nothing is timed. Instead each data type is filled
+ * with n elements and the memory it uses, from e.g.
+ * table_memory_usage(), is printed in bytes and in bytes per element,
+ * so the implementations can be compared by memory density.
+ *
+ * Usage: bench_suite [-c containers] [-i implementations] [-n sizes]
+ *		      [-w warmup] [-r repetitions] [-b batch]
+ *		      [-p counters] [-m time|memory] [-f text|json|csv]
+ *		      [-o file]
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ *   v1.1 2026-10-17: Added hardware counters with -p.
+ *   v1.2 2026-10-17: Added memory usage with -m memory.
+ *   v1.3 2026-10-17: Added spsc_queue, mpmc_queue and index_heap.
+ *   v1.4 2026-10-17: Added int_array_stack.
+ */
+
+#define VERSION "v1.4"
+#define VERSION_DATE "2026-10-17"
+
+// Set by the Makefile.
+#ifndef BENCH_COMMIT
+#define BENCH_COMMIT "unknown"
+#endif
+#ifndef BENCH_CFLAGS
+#define BENCH_CFLAGS "unknown"
+#endif
+#ifndef BENCH_GRAPH_NAME
+#define BENCH_GRAPH_NAME "graph"
+#endif
+
+#if defined(__clang__) || !defined(__GNUC__)
+#ifdef __VERSION__
+#define COMPILER __VERSION__
+#else
+#define COMPILER "unknown"
+#endif
+#elif defined(__VERSION__)
+#define COMPILER "gcc " __VERSION__
+#else
+#define COMPILER "unknown"
+#endif
+
+// Sizes used if no -n is given.
+#define DEFAULT_SIZES "1000,2000,4000,8000"
+
+// Most sizes in a sweep.
+#define MAX_SIZES 32
+
+// Longest name, label or line read.
+#define MAX_LENGTH 256
+
+// Number of edges from each node in the graph benchmark.
+#define EDGES_PER_NODE 4
+
+// Number of values per call of int_array_stack_push_n() and
+// int_array_stack_pop_n().
+#define BULK 64
+
+// Longest node label in the graph benchmark.
+#define LABEL_LENGTH 16
+
+// ===========INTERNAL DATA TYPES============
+
+// One measured phase.
+struct result {
+	const char *container;
+	const char *impl;
+	const char *phase;
+	int n;
+	bench_result r;
+	double exponent; // NAN if not fitted.
+};
+
+// All measured phases, in the order they were run.
+struct results {
+	struct result *items;
+	int count;
+	int capacity;
+};
+
+// The memory used by one data type filled with n elements.
+struct memory_result {
+	const char *container;
+	const char *impl;
+	int n;
+	mem_usage m;
+};
+
+// All memory results, in the order they were measured.
+struct memory_results {
+	struct memory_result *items;
+	int count;
+	int capacity;
+};
+
+// Options from the command line.
+struct suite_options {
+	const char *containers; // Comma-separated, or NULL for all.
+	const char *impls; // Comma-separated, or NULL for all.
+	int sizes[MAX_SIZES];
+	int num_sizes;
+	bench_options bench;
+	bool memory; // Measure memory usage instead of time.
+	const char *format;
+	const char *output;
+};
+
+/*
+ * Data shared by the functions of the phases. keys holds 2n distinct
+ * keys in random order, of which the first n are inserted, and order
+ * a random permutation of 0 .. n - 1. The other fields are set by the
+ * setup of the phase.
+ */
+struct suite_data {
+	int n;
+	int *keys;
+	int *order;
+	const void *impl;
+	void *container;
+	list_pos list_pos;
+	dlist_pos dlist_pos;
+	int side; // Side of the array_2d.
+#ifdef BENCH_GRAPH
+	char (*labels)[LABEL_LENGTH];
+	node **nodes;
+#endif
+};
+
+// A data type with its implementations.
+struct container {
+	const char *name;
+	int num_impls;
+	const void *impls[4];
+	const char *impl_names[4];
+	void (*run)(struct suite_data *d, const bench_options *opt,
+		    struct results *res, const char *impl);
+	// Fill the data type with d->n elements and return its memory
+	// usage, or NULL if the data type has no *_memory_usage().
+	mem_usage (*memory)(struct suite_data *d);
+};
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+// Check if a name is in a comma-separated list.
+static bool in_list(const char *list, const char *name)
+{
+	if (list == NULL) {
+		return true;
+	}
+	size_t len = strlen(name);
+	const char *p = list;
+	while (*p != '\0') {
+		const char *end = strchr(p, ',');
+		if (end == NULL) {
+			end = p + strlen(p);
+		}
+		if ((size_t)(end - p) == len && strncmp(p, name, len) == 0) {
+			return true;
+		}
+		p = *end == ',' ? end + 1 : end;
+	}
+	return false;
+}
+
+// Add a result.
+static void add_result(struct results *res, const char *container,
+		       const char *impl, const char *phase, int n,
+		       const bench_result *r)
+{
+	if (res->count == res->capacity) {
+		res->capacity = res->capacity > 0 ? 2 * res->capacity : 64;
+		res->items = realloc(res->items,
+				     res->capacity * sizeof(*res->items));
+		if (res->items == NULL) {
+			fprintf(stderr, "bench_suite: Out of memory.\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	struct result *item = &res->items[res->count++];
+	item->container = container;
+	item->impl = impl;
+	item->phase = phase;
+	item->n = n;
+	item->r = *r;
+	item->exponent = NAN;
+}
+
+// Add a memory result.
+static void add_memory_result(struct memory_results *res,
+			      const char *container, const char *impl, int n,
+			      const mem_usage *m)
+{
+	if (res->count == res->capacity) {
+		res->capacity = res->capacity > 0 ? 2 * res->capacity : 64;
+		res->items = realloc(res->items,
+				     res->capacity * sizeof(*res->items));
+		if (res->items == NULL) {
+			fprintf(stderr, "bench_suite: Out of memory.\n");
+			exit(EXIT_FAILURE);
+		}
+	}
+	struct memory_result *item = &res->items[res->count++];
+	item->container = container;
+	item->impl = impl;
+	item->n = n;
+	item->m = *m;
+}
+
+// Run a phase and add its result.
+static void measure(struct results *res, const char *container,
+		    const char *impl, const bench_phase *p,
+		    const bench_options *opt, struct suite_data *d)
+{
+	fprintf(stderr, "  %s %s %s n=%d\n", container, impl, p->name, d->n);
+	bench_result r = bench_run(p, opt, d);
+	add_result(res, container, impl, p->name, d->n, &r);
+}
+
+// Compare two integers via pointers, for the tables.
+static int compare_ints(const void *p1, const void *p2)
+{
+	int i1 = *(const int *)p1;
+	int i2 = *(const int *)p2;
+	return (i1 > i2) - (i1 < i2);
+}
+
+// Hash an integer via a pointer, for the hashed tables.
+static size_t hash_int(const void *p)
+{
+	return (size_t)*(const int *)p;
+}
+
+// Shuffle an array of integers.
+static void shuffle(int *a, int n)
+{
+	for (int i = n - 1; i > 0; i--) {
+		int k = rand() % (i + 1);
+		int t = a[i];
+		a[i] = a[k];
+		a[k] = t;
+	}
+}
+
+// Create the keys and the order for size n. The same n always gives
+// the same keys, whatever was run before.
+static void make_data(struct suite_data *d, int n)
+{
+	d->n = n;
+	d->keys = malloc(2 * (size_t)n * sizeof(int));
+	d->order = malloc(n * sizeof(int));
+	if (d->keys == NULL || d->order == NULL) {
+		fprintf(stderr, "bench_suite: Out of memory.\n");
+		exit(EXIT_FAILURE);
+	}
+	srand(n);
+	for (int i = 0; i < 2 * n; i++) {
+		d->keys[i] = i;
+	}
+	shuffle(d->keys, 2 * n);
+	for (int i = 0; i < n; i++) {
+		d->order[i] = i;
+	}
+	shuffle(d->order, n);
+}
+
+// ===========ARRAYS============
+
+static void array_1d_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	d->container = array_1d_create(0, d->n - 1, NULL);
+}
+
+static void array_1d_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	array_1d_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		array_1d_set_value(d->container, &d->keys[i], i);
+	}
+}
+
+static void array_1d_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	array_1d_kill(d->container);
+}
+
+static void array_1d_op_set(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	array_1d_set_value(d->container, &d->keys[i], i);
+}
+
+static void array_1d_op_inspect(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	array_1d_inspect_value(d->container, d->order[i]);
+}
+
+// Measure sequential writes and random reads of an array_1d.
+static void run_array_1d(struct suite_data *d, const bench_options *opt,
+			 struct results *res, const char *impl)
+{
+	bench_phase set = { "set", d->n, array_1d_setup, array_1d_op_set,
+			    array_1d_teardown };
+	bench_phase inspect = { "inspect", d->n, array_1d_setup_filled,
+				array_1d_op_inspect, array_1d_teardown };
+	measure(res, "array_1d", impl, &set, opt, d);
+	measure(res, "array_1d", impl, &inspect, opt, d);
+}
+
+static mem_usage memory_array_1d(struct suite_data *d)
+{
+	array_1d_setup_filled(d);
+	mem_usage m = array_1d_memory_usage(d->container);
+	array_1d_teardown(d);
+	return m;
+}
+
+static void array_2d_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	d->container = array_2d_create(0, d->side - 1, 0, d->side - 1, NULL);
+}
+
+static void array_2d_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	array_2d_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		array_2d_set_value(d->container, &d->keys[i], i / d->side,
+				   i % d->side);
+	}
+}
+
+static void array_2d_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	array_2d_kill(d->container);
+}
+
+static void array_2d_op_set(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	array_2d_set_value(d->container, &d->keys[i], i / d->side,
+			   i % d->side);
+}
+
+static void array_2d_op_inspect(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	int k = d->order[i];
+	array_2d_inspect_value(d->container, k / d->side, k % d->side);
+}
+
+// Measure row-wise writes and random reads of an array_2d with
+// at least n cells.
+static void run_array_2d(struct suite_data *d, const bench_options *opt,
+			 struct results *res, const char *impl)
+{
+	d->side = (int)ceil(sqrt(d->n));
+	bench_phase set = { "set", d->n, array_2d_setup, array_2d_op_set,
+			    array_2d_teardown };
+	bench_phase inspect = { "inspect", d->n, array_2d_setup_filled,
+				array_2d_op_inspect, array_2d_teardown };
+	measure(res, "array_2d", impl, &set, opt, d);
+	measure(res, "array_2d", impl, &inspect, opt, d);
+}
+
+static mem_usage memory_array_2d(struct suite_data *d)
+{
+	d->side = (int)ceil(sqrt(d->n));
+	array_2d_setup_filled(d);
+	mem_usage m = array_2d_memory_usage(d->container);
+	array_2d_teardown(d);
+	return m;
+}
+
+// ===========LISTS============
+
+static void list_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	d->container = list_empty(NULL);
+	d->list_pos = list_end(d->container);
+}
+
+static void list_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	list_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		list_insert(d->container, &d->keys[i], d->list_pos);
+	}
+	d->list_pos = list_first(d->container);
+}
+
+static void list_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	list_kill(d->container);
+}
+
+static void list_op_insert(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	list_insert(d->container, &d->keys[i], d->list_pos);
+}
+
+static void list_op_traverse(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	list_inspect(d->container, d->list_pos);
+	d->list_pos = list_next(d->container, d->list_pos);
+}
+
+static void list_op_remove(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	list_remove(d->container, list_first(d->container));
+}
+
+// Measure inserts at the end, a traversal and removal from the
+// front of a list.
+static void run_list(struct suite_data *d, const bench_options *opt,
+		     struct results *res, const char *impl)
+{
+	bench_phase insert = { "insert", d->n, list_setup, list_op_insert,
+			       list_teardown };
+	bench_phase traverse = { "traverse", d->n, list_setup_filled,
+				 list_op_traverse, list_teardown };
+	bench_phase remove_first = { "remove", d->n, list_setup_filled,
+				     list_op_remove, list_teardown };
+	measure(res, "list", impl, &insert, opt, d);
+	measure(res, "list", impl, &traverse, opt, d);
+	measure(res, "list", impl, &remove_first, opt, d);
+}
+
+static mem_usage memory_list(struct suite_data *d)
+{
+	list_setup_filled(d);
+	mem_usage m = list_memory_usage(d->container);
+	list_teardown(d);
+	return m;
+}
+
+static void dlist_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	d->container = dlist_empty(NULL);
+	d->dlist_pos = dlist_first(d->container);
+}
+
+static void dlist_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	dlist_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		d->dlist_pos = dlist_next(d->container,
+					  dlist_insert(d->container,
+						       &d->keys[i],
+						       d->dlist_pos));
+	}
+	d->dlist_pos = dlist_first(d->container);
+}
+
+static void dlist_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	dlist_kill(d->container);
+}
+
+static void dlist_op_insert(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	d->dlist_pos = dlist_next(d->container,
+				  dlist_insert(d->container, &d->keys[i],
+					       d->dlist_pos));
+}
+
+static void dlist_op_traverse(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	dlist_inspect(d->container, d->dlist_pos);
+	d->dlist_pos = dlist_next(d->container, d->dlist_pos);
+}
+
+static void dlist_op_remove(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	dlist_remove(d->container, dlist_first(d->container));
+}
+
+// Measure inserts at the end, a traversal and removal from the
+// front of a dlist.
+static void run_dlist(struct suite_data *d, const bench_options *opt,
+		      struct results *res, const char *impl)
+{
+	bench_phase insert = { "insert", d->n, dlist_setup, dlist_op_insert,
+			       dlist_teardown };
+	bench_phase traverse = { "traverse", d->n, dlist_setup_filled,
+				 dlist_op_traverse, dlist_teardown };
+	bench_phase remove_first = { "remove", d->n, dlist_setup_filled,
+				     dlist_op_remove, dlist_teardown };
+	measure(res, "dlist", impl, &insert, opt, d);
+	measure(res, "dlist", impl, &traverse, opt, d);
+	measure(res, "dlist", impl, &remove_first, opt, d);
+}
+
+static mem_usage memory_dlist(struct suite_data *d)
+{
+	dlist_setup_filled(d);
+	mem_usage m = dlist_memory_usage(d->container);
+	dlist_teardown(d);
+	return m;
+}
+
+// ===========QUEUES AND STACKS============
+
+static void queue_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	const struct queue_impl *q = d->impl;
+	d->container = q->empty(NULL);
+}
+
+static void queue_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	const struct queue_impl *q = d->impl;
+	queue_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		q->enqueue(d->container, &d->keys[i]);
+	}
+}
+
+static void queue_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	const struct queue_impl *q = d->impl;
+	q->kill(d->container);
+}
+
+static void queue_op_enqueue(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	const struct queue_impl *q = d->impl;
+	d->container = q->enqueue(d->container, &d->keys[i]);
+}
+
+static void queue_op_dequeue(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	const struct queue_impl *q = d->impl;
+	q->front(d->container);
+	d->container = q->dequeue(d->container);
+}
+
+// Measure enqueue and front + dequeue of a queue.
+static void run_queue(struct suite_data *d, const bench_options *opt,
+		      struct results *res, const char *impl)
+{
+	bench_phase enqueue = { "enqueue", d->n, queue_setup,
+				queue_op_enqueue, queue_teardown };
+	bench_phase dequeue = { "dequeue", d->n, queue_setup_filled,
+				queue_op_dequeue, queue_teardown };
+	measure(res, "queue", impl, &enqueue, opt, d);
+	measure(res, "queue", impl, &dequeue, opt, d);
+}
+
+static mem_usage memory_queue(struct suite_data *d)
+{
+	const struct queue_impl *q = d->impl;
+	queue_setup_filled(d);
+	mem_usage m = q->memory_usage(d->container);
+	queue_teardown(d);
+	return m;
+}
+
+static void stack_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	const struct stack_impl *s = d->impl;
+	d->container = s->empty(NULL);
+}
+
+static void stack_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	const struct stack_impl *s = d->impl;
+	stack_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		d->container = s->push(d->container, &d->keys[i]);
+	}
+}
+
+static void stack_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	const struct stack_impl *s = d->impl;
+	s->kill(d->container);
+}
+
+static void stack_op_push(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	const struct stack_impl *s = d->impl;
+	d->container = s->push(d->container, &d->keys[i]);
+}
+
+static void stack_op_pop(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	const struct stack_impl *s = d->impl;
+	s->top(d->container);
+	d->container = s->pop(d->container);
+}
+
+// Measure push and top + pop of a stack.
+static void run_stack(struct suite_data *d, const bench_options *opt,
+		      struct results *res, const char *impl)
+{
+	bench_phase push = { "push", d->n, stack_setup, stack_op_push,
+			     stack_teardown };
+	bench_phase pop = { "pop", d->n, stack_setup_filled, stack_op_pop,
+			    stack_teardown };
+	measure(res, "stack", impl, &push, opt, d);
+	measure(res, "stack", impl, &pop, opt, d);
+}
+
+static mem_usage memory_stack(struct suite_data *d)
+{
+	const struct stack_impl *s = d->impl;
+	stack_setup_filled(d);
+	mem_usage m = s->memory_usage(d->container);
+	stack_teardown(d);
+	return m;
+}
+
+static void int_array_stack_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	d->container = int_array_stack_empty();
+}
+
+static void int_array_stack_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	int_array_stack_setup(d);
+	int_array_stack_push_n(d->container, d->keys, d->n);
+}
+
+static void int_array_stack_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	int_array_stack_kill(d->container);
+}
+
+static void int_array_stack_op_push(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	int_array_stack_push(d->container, d->keys[i]);
+}
+
+static void int_array_stack_op_pop(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	int_array_stack_top(d->container);
+	int_array_stack_pop(d->container);
+}
+
+// Push the keys i * BULK .. i * BULK + BULK - 1, or the rest of them.
+static void int_array_stack_op_push_n(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	int first = i * BULK;
+	int n = d->n - first < BULK ? d->n - first : BULK;
+	int_array_stack_push_n(d->container, &d->keys[first], n);
+}
+
+static void int_array_stack_op_pop_n(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	int values[BULK];
+	int_array_stack_pop_n(d->container, values, BULK);
+}
+
+// Measure push, top + pop, and push_n and pop_n of BULK values at a
+// time, of an int_array_stack. The bulk phases are timed per call.
+static void run_int_array_stack(struct suite_data *d,
+				const bench_options *opt,
+				struct results *res, const char *impl)
+{
+	int calls = (d->n + BULK - 1) / BULK;
+	bench_phase push = { "push", d->n, int_array_stack_setup,
+			     int_array_stack_op_push,
+			     int_array_stack_teardown };
+	bench_phase pop = { "pop", d->n, int_array_stack_setup_filled,
+			    int_array_stack_op_pop, int_array_stack_teardown };
+	bench_phase push_n = { "push_n", calls, int_array_stack_setup,
+			       int_array_stack_op_push_n,
+			       int_array_stack_teardown };
+	bench_phase pop_n = { "pop_n", calls, int_array_stack_setup_filled,
+			      int_array_stack_op_pop_n,
+			      int_array_stack_teardown };
+	measure(res, "int_array_stack", impl, &push, opt, d);
+	measure(res, "int_array_stack", impl, &pop, opt, d);
+	measure(res, "int_array_stack", impl, &push_n, opt, d);
+	measure(res, "int_array_stack", impl, &pop_n, opt, d);
+}
+
+static mem_usage memory_int_array_stack(struct suite_data *d)
+{
+	int_array_stack_setup_filled(d);
+	mem_usage m = int_array_stack_memory_usage(d->container);
+	int_array_stack_teardown(d);
+	return m;
+}
+
+// The single-threaded cost of the lock-free queues. Each queue is
+// created with room for n elements, so try_enqueue never fails.
+
+static void spsc_queue_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	d->container = spsc_queue_empty(d->n, NULL);
+}
+
+static void spsc_queue_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	spsc_queue_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		spsc_queue_try_enqueue(d->container, &d->keys[i]);
+	}
+}
+
+static void spsc_queue_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	spsc_queue_kill(d->container);
+}
+
+static void spsc_queue_op_try_enqueue(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	spsc_queue_try_enqueue(d->container, &d->keys[i]);
+}
+
+static void spsc_queue_op_try_dequeue(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	void *v;
+	spsc_queue_try_dequeue(d->container, &v);
+}
+
+// Measure try_enqueue and try_dequeue of an spsc_queue from one thread.
+static void run_spsc_queue(struct suite_data *d, const bench_options *opt,
+			   struct results *res, const char *impl)
+{
+	bench_phase enqueue = { "try_enqueue", d->n, spsc_queue_setup,
+				spsc_queue_op_try_enqueue,
+				spsc_queue_teardown };
+	bench_phase dequeue = { "try_dequeue", d->n, spsc_queue_setup_filled,
+				spsc_queue_op_try_dequeue,
+				spsc_queue_teardown };
+	measure(res, "spsc_queue", impl, &enqueue, opt, d);
+	measure(res, "spsc_queue", impl, &dequeue, opt, d);
+}
+
+static mem_usage memory_spsc_queue(struct suite_data *d)
+{
+	spsc_queue_setup_filled(d);
+	mem_usage m = spsc_queue_memory_usage(d->container);
+	spsc_queue_teardown(d);
+	return m;
+}
+
+static void mpmc_queue_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	d->container = mpmc_queue_empty(d->n, NULL);
+}
+
+static void mpmc_queue_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	mpmc_queue_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		mpmc_queue_try_enqueue(d->container, &d->keys[i]);
+	}
+}
+
+static void mpmc_queue_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	mpmc_queue_kill(d->container);
+}
+
+static void mpmc_queue_op_try_enqueue(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	mpmc_queue_try_enqueue(d->container, &d->keys[i]);
+}
+
+static void mpmc_queue_op_try_dequeue(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	void *v;
+	mpmc_queue_try_dequeue(d->container, &v);
+}
+
+// Measure try_enqueue and try_dequeue of an mpmc_queue from one thread.
+static void run_mpmc_queue(struct suite_data *d, const bench_options *opt,
+			   struct results *res, const char *impl)
+{
+	bench_phase enqueue = { "try_enqueue", d->n, mpmc_queue_setup,
+				mpmc_queue_op_try_enqueue,
+				mpmc_queue_teardown };
+	bench_phase dequeue = { "try_dequeue", d->n, mpmc_queue_setup_filled,
+				mpmc_queue_op_try_dequeue,
+				mpmc_queue_teardown };
+	measure(res, "mpmc_queue", impl, &enqueue, opt, d);
+	measure(res, "mpmc_queue", impl, &dequeue, opt, d);
+}
+
+static mem_usage memory_mpmc_queue(struct suite_data *d)
+{
+	mpmc_queue_setup_filled(d);
+	mem_usage m = mpmc_queue_memory_usage(d->container);
+	mpmc_queue_teardown(d);
+	return m;
+}
+
+// ===========PRIORITY QUEUES============
+
+// Number of children of each node in the index_heap.
+#define INDEX_HEAP_ARITY 4
+
+static void index_heap_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	d->container = index_heap_empty(d->n, INDEX_HEAP_ARITY);
+}
+
+// Push the indexes 0 .. n - 1 with the priorities 2n + keys[i], so
+// that decrease_key can lower each of them to keys[i].
+static void index_heap_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	index_heap_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		index_heap_push(d->container, i, 2 * d->n + d->keys[i]);
+	}
+}
+
+static void index_heap_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	index_heap_kill(d->container);
+}
+
+static void index_heap_op_push(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	index_heap_push(d->container, i, d->keys[i]);
+}
+
+static void index_heap_op_pop(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	index_heap_top(d->container);
+	index_heap_pop(d->container);
+}
+
+static void index_heap_op_decrease_key(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	int j = d->order[i];
+	index_heap_decrease_key(d->container, j, d->keys[j]);
+}
+
+// Measure push, top + pop and decrease_key of an index_heap.
+static void run_index_heap(struct suite_data *d, const bench_options *opt,
+			   struct results *res, const char *impl)
+{
+	bench_phase push = { "push", d->n, index_heap_setup,
+			     index_heap_op_push, index_heap_teardown };
+	bench_phase pop = { "pop", d->n, index_heap_setup_filled,
+			    index_heap_op_pop, index_heap_teardown };
+	bench_phase decrease_key = { "decrease_key", d->n,
+				     index_heap_setup_filled,
+				     index_heap_op_decrease_key,
+				     index_heap_teardown };
+	measure(res, "index_heap", impl, &push, opt, d);
+	measure(res, "index_heap", impl, &pop, opt, d);
+	measure(res, "index_heap", impl, &decrease_key, opt, d);
+}
+
+static mem_usage memory_index_heap(struct suite_data *d)
+{
+	index_heap_setup_filled(d);
+	mem_usage m = index_heap_memory_usage(d->container);
+	index_heap_teardown(d);
+	return m;
+}
+
+// ===========TABLES============
+
+static void table_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	const struct table_impl *t = d->impl;
+	d->container = t->empty(compare_ints, hash_int, NULL, NULL);
+}
+
+static void table_setup_filled(void *arg)
+{
+	struct suite_data *d = arg;
+	const struct table_impl *t = d->impl;
+	table_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		t->insert(d->container, &d->keys[i], &d->keys[i]);
+	}
+}
+
+static void table_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	const struct table_impl *t = d->impl;
+	t->kill(d->container);
+}
+
+static void table_op_insert(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	const struct table_impl *t = d->impl;
+	t->insert(d->container, &d->keys[i], &d->keys[i]);
+}
+
+static void table_op_lookup(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	const struct table_impl *t = d->impl;
+	t->lookup(d->container, &d->keys[d->order[i]]);
+}
+
+static void table_op_lookup_missing(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	const struct table_impl *t = d->impl;
+	t->lookup(d->container, &d->keys[d->n + i]);
+}
+
+static void table_op_remove(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	const struct table_impl *t = d->impl;
+	t->remove(d->container, &d->keys[d->order[i]]);
+}
+
+// Measure inserts, lookups of existing and missing keys and
+// removes in random order of a table.
+static void run_table(struct suite_data *d, const bench_options *opt,
+		      struct results *res, const char *impl)
+{
+	bench_phase insert = { "insert", d->n, table_setup, table_op_insert,
+			       table_teardown };
+	bench_phase lookup = { "lookup", d->n, table_setup_filled,
+			       table_op_lookup, table_teardown };
+	bench_phase missing = { "lookup_missing", d->n, table_setup_filled,
+				table_op_lookup_missing, table_teardown };
+	bench_phase remove_keys = { "remove", d->n, table_setup_filled,
+				    table_op_remove, table_teardown };
+	measure(res, "table", impl, &insert, opt, d);
+	measure(res, "table", impl, &lookup, opt, d);
+	measure(res, "table", impl, &missing, opt, d);
+	measure(res, "table", impl, &remove_keys, opt, d);
+}
+
+static mem_usage memory_table(struct suite_data *d)
+{
+	const struct table_impl *t = d->impl;
+	table_setup_filled(d);
+	mem_usage m = t->memory_usage(d->container);
+	table_teardown(d);
+	return m;
+}
+
+// ===========GRAPH============
+
+#ifdef BENCH_GRAPH
+
+static void graph_setup(void *arg)
+{
+	struct suite_data *d = arg;
+	d->container = graph_empty(d->n);
+}
+
+static void graph_setup_nodes(void *arg)
+{
+	struct suite_data *d = arg;
+	graph_setup(d);
+	for (int i = 0; i < d->n; i++) {
+		d->container = graph_insert_node(d->container, d->labels[i]);
+	}
+	for (int i = 0; i < d->n; i++) {
+		d->nodes[i] = graph_find_node(d->container, d->labels[i]);
+	}
+}
+
+static void graph_setup_edges(void *arg)
+{
+	struct suite_data *d = arg;
+	graph_setup_nodes(d);
+	for (int i = 0; i < d->n * EDGES_PER_NODE; i++) {
+		int k = d->order[i % d->n];
+		d->container = graph_insert_edge(d->container,
+						 d->nodes[i / EDGES_PER_NODE],
+						 d->nodes[k]);
+	}
+}
+
+static void graph_teardown(void *arg)
+{
+	struct suite_data *d = arg;
+	graph_kill(d->container);
+}
+
+static void graph_op_insert_node(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	d->container = graph_insert_node(d->container, d->labels[i]);
+}
+
+static void graph_op_find_node(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	graph_find_node(d->container, d->labels[d->order[i]]);
+}
+
+static void graph_op_insert_edge(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	int k = d->order[i % d->n];
+	d->container = graph_insert_edge(d->container,
+					 d->nodes[i / EDGES_PER_NODE],
+					 d->nodes[k]);
+}
+
+static void graph_op_neighbours(void *arg, int i)
+{
+	struct suite_data *d = arg;
+	dlist_kill(graph_neighbours(d->container, d->nodes[d->order[i]]));
+}
+
+// Measure node and edge inserts, node lookups and neighbour
+// lists of a graph with EDGES_PER_NODE edges from each node.
+static void run_graph(struct suite_data *d, const bench_options *opt,
+		      struct results *res, const char *impl)
+{
+	d->labels = malloc(d->n * sizeof(*d->labels));
+	d->nodes = malloc(d->n * sizeof(*d->nodes));
+	for (int i = 0; i < d->n; i++) {
+		sprintf(d->labels[i], "%d", d->keys[i]);
+	}
+	bench_phase insert_node = { "insert_node", d->n, graph_setup,
+				    graph_op_insert_node, graph_teardown };
+	bench_phase find_node = { "find_node", d->n, graph_setup_nodes,
+				  graph_op_find_node, graph_teardown };
+	bench_phase insert_edge = { "insert_edge", d->n * EDGES_PER_NODE,
+				    graph_setup_nodes, graph_op_insert_edge,
+				    graph_teardown };
+	bench_phase neighbours = { "neighbours", d->n, graph_setup_edges,
+				   graph_op_neighbours, graph_teardown };
+	measure(res, "graph", impl, &insert_node, opt, d);
+	measure(res, "graph", impl, &find_node, opt, d);
+	measure(res, "graph", impl, &insert_edge, opt, d);
+	measure(res, "graph", impl, &neighbours, opt, d);
+	free(d->labels);
+	free(d->nodes);
+}
+
+#endif
+
+// ===========FITTING AND OUTPUT============
+
+// Fit the time of each series of results to c * n^k.
+//
+// A series is the results with the same data type, implementation and
+// phase. k is the slope of the least squares line through the points
+// (log n, log t), where t is n times the time per operation in the
+// fastest repetition. k is stored in every result of a series with at
+// least two sizes.
+static void fit_exponents(struct results *res)
+{
+	for (int i = 0; i < res->count; i++) {
+		struct result *first = &res->items[i];
+		if (!isnan(first->exponent)) {
+			continue;
+		}
+		double sx = 0, sy = 0, sxx = 0, sxy = 0;
+		int m = 0;
+		for (int j = i; j < res->count; j++) {
+			struct result *r = &res->items[j];
+			if (strcmp(r->container, first->container) != 0 ||
+			    strcmp(r->impl, first->impl) != 0 ||
+			    strcmp(r->phase, first->phase) != 0 ||
+			    r->r.best <= 0) {
+				continue;
+			}
+			double x = log(r->n);
+			double y = log(r->r.best * r->n);
+			sx += x;
+			sy += y;
+			sxx += x * x;
+			sxy += x * y;
+			m++;
+		}
+		double det = m * sxx - sx * sx;
+		if (m < 2 || det <= 0) {
+			continue;
+		}
+		double k = (m * sxy - sx * sy) / det;
+		for (int j = i; j < res->count; j++) {
+			struct result *r = &res->items[j];
+			if (strcmp(r->container, first->container) == 0 &&
+			    strcmp(r->impl, first->impl) == 0 &&
+			    strcmp(r->phase, first->phase) == 0) {
+				r->exponent = k;
+			}
+		}
+	}
+}
+
+// Read the name of the CPU.
+static const char *cpu_name(char *buf)
+{
+	FILE *f = fopen("/proc/cpuinfo", "r");
+	if (f == NULL) {
+		return "unknown";
+	}
+	char line[MAX_LENGTH];
+	const char *name = "unknown";
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char *colon = strchr(line, ':');
+		if (strncmp(line, "model name", 10) == 0 && colon != NULL) {
+			colon++;
+			while (*colon == ' ' || *colon == '\t') {
+				colon++;
+			}
+			colon[strcspn(colon, "\n")] = '\0';
+			strcpy(buf, colon);
+			name = buf;
+			break;
+		}
+	}
+	fclose(f);
+	return name;
+}
+
+// Print a string as a JSON string.
+static void print_json_string(FILE *f, const char *s)
+{
+	fputc('"', f);
+	for (; *s != '\0'; s++) {
+		if (*s == '"' || *s == '\\') {
+			fprintf(f, "\\%c", *s);
+		} else if ((unsigned char)*s < 0x20) {
+			fprintf(f, "\\u%04x", *s);
+		} else {
+			fputc(*s, f);
+		}
+	}
+	fputc('"', f);
+}
+
+// Metadata printed with the results.
+struct metadata {
+	const char *keys[10];
+	char values[10][MAX_LENGTH];
+	int count;
+};
+
+// Write the names of the counters in a mask to buf, with those that
+// are not in available marked.
+static void counter_list(char *buf, unsigned counters, unsigned available)
+{
+	buf[0] = '\0';
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		if (counters & (1u << c)) {
+			sprintf(buf + strlen(buf), "%s%s%s",
+				buf[0] != '\0' ? ", " : "",
+				bench_counter_name(c),
+				available & (1u << c) ? "" : " (not available)");
+		}
+	}
+}
+
+// Collect the metadata of a run.
+static void collect_metadata(struct metadata *md,
+			     const struct suite_options *opt)
+{
+	char cpu[MAX_LENGTH];
+	time_t now = time(NULL);
+	struct tm tm;
+	localtime_r(&now, &tm);
+
+	md->count = 0;
+	md->keys[md->count] = "suite";
+	sprintf(md->values[md->count++], "bench_suite %s", VERSION);
+	md->keys[md->count] = "code_base";
+	sprintf(md->values[md->count++], "%s", CODE_BASE_VERSION);
+	md->keys[md->count] = "commit";
+	snprintf(md->values[md->count++], MAX_LENGTH, "%s", BENCH_COMMIT);
+	md->keys[md->count] = "compiler";
+	snprintf(md->values[md->count++], MAX_LENGTH, "%s", COMPILER);
+	md->keys[md->count] = "cflags";
+	snprintf(md->values[md->count++], MAX_LENGTH, "%s", BENCH_CFLAGS);
+	md->keys[md->count] = "cpu";
+	snprintf(md->values[md->count++], MAX_LENGTH, "%s", cpu_name(cpu));
+	md->keys[md->count] = "cpus";
+	sprintf(md->values[md->count++], "%ld", sysconf(_SC_NPROCESSORS_ONLN));
+	md->keys[md->count] = "date";
+	strftime(md->values[md->count++], MAX_LENGTH, "%Y-%m-%dT%H:%M:%S%z",
+		 &tm);
+	if (opt->memory) {
+		md->keys[md->count] = "mode";
+		sprintf(md->values[md->count++], "memory after n inserts");
+		return;
+	}
+	md->keys[md->count] = "repetitions";
+	sprintf(md->values[md->count++], "%d warm-up, %d measured, batch %d",
+		opt->bench.warmup, opt->bench.repetitions, opt->bench.batch);
+	if (opt->bench.counters != 0) {
+		md->keys[md->count] = "counters";
+		counter_list(md->values[md->count++], opt->bench.counters,
+			     bench_counters_available(opt->bench.counters));
+	}
+}
+
+// Print the results as a text table, with one column per counter in
+// counters.
+static void print_text(FILE *f, const struct metadata *md,
+		       const struct results *res, unsigned counters)
+{
+	for (int i = 0; i < md->count; i++) {
+		fprintf(f, "%-12s %s\n", md->keys[i], md->values[i]);
+	}
+	fprintf(f, "\n%-15s %-15s %-14s %8s %9s %9s %9s %9s %9s %11s %8s",
+		"type", "impl", "phase", "n", "mean ns", "best ns", "p50 ns",
+		"p99 ns", "p99.9 ns", "ops/s", "exponent");
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		if (counters & (1u << c)) {
+			fprintf(f, " %13s", bench_counter_name(c));
+		}
+	}
+	fprintf(f, "\n");
+	for (int i = 0; i < res->count; i++) {
+		const struct result *r = &res->items[i];
+		fprintf(f, "%-15s %-15s %-14s %8d %9.1f %9.1f %9.1f %9.1f %9.1f "
+			"%11.0f %8.2f", r->container, r->impl, r->phase,
+			r->n, r->r.mean, r->r.best, r->r.p50, r->r.p99,
+			r->r.p999, r->r.ops_per_sec, r->exponent);
+		for (int c = 0; c < BENCH_COUNTERS; c++) {
+			if (!(counters & (1u << c))) {
+				continue;
+			}
+			if (isnan(r->r.counters[c])) {
+				fprintf(f, " %13s", "-");
+			} else {
+				fprintf(f, " %13.2f", r->r.counters[c]);
+			}
+		}
+		fprintf(f, "\n");
+	}
+}
+
+// Print the results as JSON.
+//
+// The object has a "metadata" object with the metadata as strings and
+// a "results" array with one object per result. "exponent" is null if
+// it was not fitted. If counters is not 0, each result also has a
+// "counters" object with the counters per operation, null if they
+// could not be read.
+static void print_json(FILE *f, const struct metadata *md,
+		       const struct results *res, unsigned counters)
+{
+	fprintf(f, "{\n  \"metadata\": {\n");
+	for (int i = 0; i < md->count; i++) {
+		fprintf(f, "    ");
+		print_json_string(f, md->keys[i]);
+		fprintf(f, ": ");
+		print_json_string(f, md->values[i]);
+		fprintf(f, i < md->count - 1 ? ",\n" : "\n");
+	}
+	fprintf(f, "  },\n  \"results\": [\n");
+	for (int i = 0; i < res->count; i++) {
+		const struct result *r = &res->items[i];
+		fprintf(f, "    {\"container\": \"%s\", \"implementation\": "
+			"\"%s\", \"phase\": \"%s\", \"n\": %d, \"samples\": "
+			"%ld, \"mean_ns\": %.1f, \"best_ns\": %.1f, "
+			"\"p50_ns\": %.1f, "
+			"\"p99_ns\": %.1f, \"p999_ns\": %.1f, "
+			"\"ops_per_sec\": %.0f, \"exponent\": ",
+			r->container, r->impl, r->phase, r->n, r->r.samples,
+			r->r.mean, r->r.best, r->r.p50, r->r.p99, r->r.p999,
+			r->r.ops_per_sec);
+		if (isnan(r->exponent)) {
+			fprintf(f, "null");
+		} else {
+			fprintf(f, "%.3f", r->exponent);
+		}
+		if (counters != 0) {
+			const char *sep = ", \"counters\": {";
+			for (int c = 0; c < BENCH_COUNTERS; c++) {
+				if (!(counters & (1u << c))) {
+					continue;
+				}
+				fprintf(f, "%s\"%s\": ", sep,
+					bench_counter_name(c));
+				if (isnan(r->r.counters[c])) {
+					fprintf(f, "null");
+				} else {
+					fprintf(f, "%.3f", r->r.counters[c]);
+				}
+				sep = ", ";
+			}
+			fprintf(f, "}");
+		}
+		fprintf(f, i < res->count - 1 ? "},\n" : "}\n");
+	}
+	fprintf(f, "  ]\n}\n");
+}
+
+// Print the results as CSV.
+//
+// The metadata is printed first as lines starting with '#'. There is
+// one column per counter in counters. The exponent and counter columns
+// are empty if the value was not fitted or read.
+static void print_csv(FILE *f, const struct metadata *md,
+		      const struct results *res, unsigned counters)
+{
+	for (int i = 0; i < md->count; i++) {
+		fprintf(f, "# %s: %s\n", md->keys[i], md->values[i]);
+	}
+	fprintf(f, "container,implementation,phase,n,samples,mean_ns,best_ns,"
+		"p50_ns,p99_ns,p999_ns,ops_per_sec,exponent");
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		if (counters & (1u << c)) {
+			fprintf(f, ",%s", bench_counter_name(c));
+		}
+	}
+	fprintf(f, "\n");
+	for (int i = 0; i < res->count; i++) {
+		const struct result *r = &res->items[i];
+		fprintf(f, "%s,%s,%s,%d,%ld,%.1f,%.1f,%.1f,%.1f,%.1f,%.0f,",
+			r->container, r->impl, r->phase, r->n, r->r.samples,
+			r->r.mean, r->r.best, r->r.p50, r->r.p99, r->r.p999,
+			r->r.ops_per_sec);
+		if (!isnan(r->exponent)) {
+			fprintf(f, "%.3f", r->exponent);
+		}
+		for (int c = 0; c < BENCH_COUNTERS; c++) {
+			if (!(counters & (1u << c))) {
+				continue;
+			}
+			fprintf(f, ",");
+			if (!isnan(r->r.counters[c])) {
+				fprintf(f, "%.3f", r->r.counters[c]);
+			}
+		}
+		fprintf(f, "\n");
+	}
+}
+
+// Print the memory results as a text table.
+static void print_memory_text(FILE *f, const struct metadata *md,
+			      const struct memory_results *res)
+{
+	for (int i = 0; i < md->count; i++) {
+		fprintf(f, "%-12s %s\n", md->keys[i], md->values[i]);
+	}
+	fprintf(f, "\n%-15s %-15s %8s %12s %10s %12s %12s %10s\n",
+		"type", "impl", "n", "total", "header", "elements", "slack",
+		"bytes/elem");
+	for (int i = 0; i < res->count; i++) {
+		const struct memory_result *r = &res->items[i];
+		fprintf(f, "%-15s %-15s %8d %12zu %10zu %12zu %12zu %10.2f\n",
+			r->container, r->impl, r->n, r->m.total, r->m.header,
+			r->m.elements, r->m.slack, (double)r->m.total / r->n);
+	}
+}
+
+// Print the memory results as JSON, with the same metadata object as
+// print_json() and one object per result in "results".
+static void print_memory_json(FILE *f, const struct metadata *md,
+			      const struct memory_results *res)
+{
+	fprintf(f, "{\n  \"metadata\": {\n");
+	for (int i = 0; i < md->count; i++) {
+		fprintf(f, "    ");
+		print_json_string(f, md->keys[i]);
+		fprintf(f, ": ");
+		print_json_string(f, md->values[i]);
+		fprintf(f, i < md->count - 1 ? ",\n" : "\n");
+	}
+	fprintf(f, "  },\n  \"results\": [\n");
+	for (int i = 0; i < res->count; i++) {
+		const struct memory_result *r = &res->items[i];
+		fprintf(f, "    {\"container\": \"%s\", \"implementation\": "
+			"\"%s\", \"n\": %d, \"total_bytes\": %zu, "
+			"\"header_bytes\": %zu, \"element_bytes\": %zu, "
+			"\"slack_bytes\": %zu, \"bytes_per_element\": %.3f",
+			r->container, r->impl, r->n, r->m.total, r->m.header,
+			r->m.elements, r->m.slack, (double)r->m.total / r->n);
+		fprintf(f, i < res->count - 1 ? "},\n" : "}\n");
+	}
+	fprintf(f, "  ]\n}\n");
+}
+
+// Print the memory results as CSV, with the metadata first as lines
+// starting with '#'.
+static void print_memory_csv(FILE *f, const struct metadata *md,
+			     const struct memory_results *res)
+{
+	for (int i = 0; i < md->count; i++) {
+		fprintf(f, "# %s: %s\n", md->keys[i], md->values[i]);
+	}
+	fprintf(f, "container,implementation,n,total_bytes,header_bytes,"
+		"element_bytes,slack_bytes,bytes_per_element\n");
+	for (int i = 0; i < res->count; i++) {
+		const struct memory_result *r = &res->items[i];
+		fprintf(f, "%s,%s,%d,%zu,%zu,%zu,%zu,%.3f\n", r->container,
+			r->impl, r->n, r->m.total, r->m.header, r->m.elements,
+			r->m.slack, (double)r->m.total / r->n);
+	}
+}
+
+// ===========COMMAND LINE============
+
+// Print usage information and exit.
+static void usage(const char *name)
+{
+	fprintf(stderr,
+		"Usage: %s [-c containers] [-i implementations] [-n sizes]\n"
+		"\t[-w warmup] [-r repetitions] [-b batch] [-p counters]\n"
+		"\t[-m time|memory] [-f text|json|csv] [-o file]\n\n"
+		"\t-c: comma-separated data types (default all): array_1d,\n"
+		"\t    array_2d, list, dlist, queue, stack, int_array_stack,\n"
+		"\t    spsc_queue, mpmc_queue, index_heap, table"
+#ifdef BENCH_GRAPH
+		", graph"
+#endif
+		".\n"
+		"\t-i: comma-separated implementations (default all):\n"
+		"\t    table, table2, hashtable, swisstable, queue,\n"
+		"\t    ringqueue, stack, arraystack. The other data types\n"
+		"\t    have one implementation with the name of the type.\n"
+		"\t-n: comma-separated sizes (default %s).\n"
+		"\t-w: warm-up repetitions of each phase (default 1).\n"
+		"\t-r: measured repetitions of each phase (default 3).\n"
+		"\t-b: operations per clock reading (default 1).\n"
+		"\t-p: comma-separated hardware counters to read, or all:\n"
+		"\t    cycles, instructions, l1d_misses, llc_misses,\n"
+		"\t    branch_misses, dtlb_misses (default none).\n"
+		"\t-m: measure time per operation or memory used after\n"
+		"\t    n inserts (default time).\n"
+		"\t-f: output format (default text).\n"
+		"\t-o: output file (default stdout).\n",
+		name, DEFAULT_SIZES);
+	exit(EXIT_FAILURE);
+}
+
+// Parse a comma-separated list of sizes.
+static bool parse_sizes(const char *s, struct suite_options *opt)
+{
+	opt->num_sizes = 0;
+	while (*s != '\0') {
+		char *end;
+		long n = strtol(s, &end, 10);
+		if (end == s || n < 1 || n > 100000000 ||
+		    opt->num_sizes == MAX_SIZES ||
+		    (*end != ',' && *end != '\0')) {
+			return false;
+		}
+		opt->sizes[opt->num_sizes++] = (int)n;
+		s = *end == ',' ? end + 1 : end;
+	}
+	return opt->num_sizes > 0;
+}
+
+// Parse a comma-separated list of counters, or "all".
+static bool parse_counters(const char *s, struct suite_options *opt)
+{
+	if (strcmp(s, "all") == 0) {
+		opt->bench.counters = BENCH_ALL_COUNTERS;
+		return true;
+	}
+	opt->bench.counters = 0;
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		if (in_list(s, bench_counter_name(c))) {
+			opt->bench.counters |= 1u << c;
+		}
+	}
+	// Each name in s must be a counter.
+	int names = 1;
+	for (const char *p = s; *p != '\0'; p++) {
+		names += *p == ',';
+	}
+	int found = 0;
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		found += (opt->bench.counters & (1u << c)) != 0;
+	}
+	return found == names;
+}
+
+// Parse the command line.
+static void parse_options(int argc, char **argv, struct suite_options *opt)
+{
+	opt->containers = NULL;
+	opt->impls = NULL;
+	parse_sizes(DEFAULT_SIZES, opt);
+	opt->bench = bench_default_options();
+	opt->bench.repetitions = 3;
+	opt->memory = false;
+	opt->format = "text";
+	opt->output = NULL;
+
+	for (int i = 1; i < argc; i++) {
+		const char *s = argv[i];
+		if (s[0] != '-' || strlen(s) != 2 || i + 1 >= argc) {
+			usage(argv[0]);
+		}
+		const char *value = argv[++i];
+		switch (s[1]) {
+		case 'c':
+			opt->containers = value;
+			break;
+		case 'i':
+			opt->impls = value;
+			break;
+		case 'n':
+			if (!parse_sizes(value, opt)) {
+				usage(argv[0]);
+			}
+			break;
+		case 'w':
+			opt->bench.warmup = atoi(value);
+			break;
+		case 'r':
+			opt->bench.repetitions = atoi(value);
+			break;
+		case 'b':
+			opt->bench.batch = atoi(value);
+			break;
+		case 'p':
+			if (!parse_counters(value, opt)) {
+				usage(argv[0]);
+			}
+			break;
+		case 'm':
+			if (strcmp(value, "memory") == 0) {
+				opt->memory = true;
+			} else if (strcmp(value, "time") == 0) {
+				opt->memory = false;
+			} else {
+				usage(argv[0]);
+			}
+			break;
+		case 'f':
+			opt->format = value;
+			break;
+		case 'o':
+			opt->output = value;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+	if (opt->bench.warmup < 0 || opt->bench.repetitions < 1 ||
+	    opt->bench.batch < 1 ||
+	    (strcmp(opt->format, "text") != 0 &&
+	     strcmp(opt->format, "json") != 0 &&
+	     strcmp(opt->format, "csv") != 0)) {
+		usage(argv[0]);
+	}
+}
+
+// ===========MAIN============
+
+int main(int argc, char **argv)
+{
+	struct suite_options opt;
+	parse_options(argc, argv, &opt);
+	unsigned missing = opt.bench.counters &
+		~bench_counters_available(opt.bench.counters);
+	if (missing != 0) {
+		char names[MAX_LENGTH];
+		counter_list(names, missing, missing);
+		fprintf(stderr, "%s: Cannot read the counters %s. They need "
+			"Linux, a PMU and perf_event_paranoid at most 2.\n",
+			argv[0], names);
+	}
+
+	struct container containers[] = {
+		{ "array_1d", 1, { NULL }, { "array_1d" }, run_array_1d,
+		  memory_array_1d },
+		{ "array_2d", 1, { NULL }, { "array_2d" }, run_array_2d,
+		  memory_array_2d },
+		{ "list", 1, { NULL }, { "list" }, run_list, memory_list },
+		{ "dlist", 1, { NULL }, { "dlist" }, run_dlist, memory_dlist },
+		{ "queue", 2, { &queue_queue_impl, &ringqueue_queue_impl },
+		  { "queue", "ringqueue" }, run_queue, memory_queue },
+		{ "stack", 2, { &stack_stack_impl, &arraystack_stack_impl },
+		  { "stack", "arraystack" }, run_stack, memory_stack },
+		{ "int_array_stack", 1, { NULL }, { "int_array_stack" },
+		  run_int_array_stack, memory_int_array_stack },
+		{ "spsc_queue", 1, { NULL }, { "spsc_queue" }, run_spsc_queue,
+		  memory_spsc_queue },
+		{ "mpmc_queue", 1, { NULL }, { "mpmc_queue" }, run_mpmc_queue,
+		  memory_mpmc_queue },
+		{ "index_heap", 1, { NULL }, { "index_heap" }, run_index_heap,
+		  memory_index_heap },
+		{ "table", 4, { &table_table_impl, &table2_table_impl,
+				&hashtable_table_impl,
+				&swisstable_table_impl },
+		  { "table", "table2", "hashtable", "swisstable" },
+		  run_table, memory_table },
+#ifdef BENCH_GRAPH
+		{ "graph", 1, { NULL }, { BENCH_GRAPH_NAME }, run_graph,
+		  NULL },
+#endif
+	};
+	int num_containers = sizeof(containers) / sizeof(containers[0]);
+
+	struct results res = { NULL, 0, 0 };
+	struct memory_results mres = { NULL, 0, 0 };
+	struct suite_data d;
+	for (int c = 0; c < num_containers; c++) {
+		struct container *ct = &containers[c];
+		if (!in_list(opt.containers, ct->name) ||
+		    (opt.memory && ct->memory == NULL)) {
+			continue;
+		}
+		for (int k = 0; k < ct->num_impls; k++) {
+			if (!in_list(opt.impls, ct->impl_names[k])) {
+				continue;
+			}
+			for (int s = 0; s < opt.num_sizes; s++) {
+				make_data(&d, opt.sizes[s]);
+				d.impl = ct->impls[k];
+				if (opt.memory) {
+					mem_usage m = ct->memory(&d);
+					add_memory_result(&mres, ct->name,
+							  ct->impl_names[k],
+							  d.n, &m);
+				} else {
+					ct->run(&d, &opt.bench, &res,
+						ct->impl_names[k]);
+				}
+				free(d.keys);
+				free(d.order);
+			}
+		}
+	}
+	if (res.count == 0 && mres.count == 0) {
+		fprintf(stderr, "%s: No data type or implementation "
+			"selected.\n", argv[0]);
+		exit(EXIT_FAILURE);
+	}
+	fit_exponents(&res);
+
+	FILE *f = stdout;
+	if (opt.output != NULL) {
+		f = fopen(opt.output, "w");
+		if (f == NULL) {
+			perror(opt.output);
+			exit(EXIT_FAILURE);
+		}
+	}
+	struct metadata md;
+	collect_metadata(&md, &opt);
+	if (opt.memory && strcmp(opt.format, "json") == 0) {
+		print_memory_json(f, &md, &mres);
+	} else if (opt.memory && strcmp(opt.format, "csv") == 0) {
+		print_memory_csv(f, &md, &mres);
+	} else if (opt.memory) {
+		print_memory_text(f, &md, &mres);
+	} else if (strcmp(opt.format, "json") == 0) {
+		print_json(f, &md, &res, opt.bench.counters);
+	} else if (strcmp(opt.format, "csv") == 0) {
+		print_csv(f, &md, &res, opt.bench.counters);
+	} else {
+		print_text(f, &md, &res, opt.bench.counters);
+	}
+	if (f != stdout) {
+		fclose(f);
+	}
+	free(res.items);
+	free(mres.items);
+	return 0;
+}
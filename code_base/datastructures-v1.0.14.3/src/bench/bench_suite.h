@@ -0,0 +1,72 @@
+#ifndef __BENCH_SUITE_H
+#define __BENCH_SUITE_H
+
+#include <table.h>
+#include <queue.h>
+#include <stack.h>
+
+/*
+ * Declaration of the implementations linked into bench_suite.c.
+ *
+ * The table, queue and stack implementations of the code base define
+ * the same functions, e.g. table_insert() in both table.c and
+ * hashtable.c, so normally only one of each can be linked into a
+ * program. bench_impl.c is compiled once per implementation and gives
+ * the functions a prefix with the name of the implementation, e.g.
+ * hashtable_table_insert(). It also defines a struct with pointers to
+ * the functions, e.g. hashtable_table_impl, which the suite uses.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ *   v1.1 2026-10-17: Added memory_usage.
+ */
+
+// The table functions used by the suite.
+struct table_impl {
+	const char *name;
+	table *(*empty)(compare_function *key_cmp_func,
+			hash_function *key_hash_func,
+			free_function key_free_func,
+			free_function value_free_func);
+	void (*insert)(table *t, void *key, void *value);
+	void *(*lookup)(const table *t, const void *key);
+	void (*remove)(table *t, const void *key);
+	void (*kill)(table *t);
+	mem_usage (*memory_usage)(const table *t);
+};
+
+// The queue functions used by the suite.
+struct queue_impl {
+	const char *name;
+	queue *(*empty)(free_function free_func);
+	bool (*is_empty)(const queue *q);
+	queue *(*enqueue)(queue *q, void *v);
+	queue *(*dequeue)(queue *q);
+	void *(*front)(const queue *q);
+	void (*kill)(queue *q);
+	mem_usage (*memory_usage)(const queue *q);
+};
+
+// The stack functions used by the suite.
+struct stack_impl {
+	const char *name;
+	stack *(*empty)(free_function free_func);
+	bool (*is_empty)(const stack *s);
+	stack *(*push)(stack *s, void *v);
+	stack *(*pop)(stack *s);
+	void *(*top)(const stack *s);
+	void (*kill)(stack *s);
+	mem_usage (*memory_usage)(const stack *s);
+};
+
+// Implementations built by the Makefile, see TABLES, QUEUES and STACKS.
+extern const struct table_impl table_table_impl;
+extern const struct table_impl table2_table_impl;
+extern const struct table_impl hashtable_table_impl;
+extern const struct table_impl swisstable_table_impl;
+extern const struct queue_impl queue_queue_impl;
+extern const struct queue_impl ringqueue_queue_impl;
+extern const struct stack_impl stack_stack_impl;
+extern const struct stack_impl arraystack_stack_impl;
+
+#endif
@@ -0,0 +1,234 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <bench.h>
+
+/*
+ * Test program for bench.c. Checks the statistics of
+ * bench_summarize() on known times, and that bench_run() calls the
+ * functions of a phase the right number of times in the right order
+ * for several options. The hardware counters are checked if the
+ * kernel allows them to be read, otherwise only that they are NAN.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ *   v1.1 2026-10-17: Added hardware counters.
+ */
+
+#define VERSION "v1.1"
+#define VERSION_DATE "2026-10-17"
+
+// Print an error message and exit.
+static void fail(const char *msg)
+{
+	fprintf(stderr, "FAIL: %s\n", msg);
+	exit(EXIT_FAILURE);
+}
+
+// Calls counted by the functions of the test phase.
+struct counts {
+	int setups;
+	int ops;
+	int teardowns;
+	int next; // Expected i of the next call of op.
+	int in_repetition; // 1 between setup and teardown.
+};
+
+static void count_setup(void *arg)
+{
+	struct counts *c = arg;
+	if (c->in_repetition) {
+		fail("Setup called twice.");
+	}
+	c->setups++;
+	c->next = 0;
+	c->in_repetition = 1;
+}
+
+static void count_op(void *arg, int i)
+{
+	struct counts *c = arg;
+	if (!c->in_repetition || i != c->next) {
+		fail("Operation called out of order.");
+	}
+	c->ops++;
+	c->next++;
+}
+
+static void count_teardown(void *arg)
+{
+	struct counts *c = arg;
+	if (!c->in_repetition) {
+		fail("Teardown called without setup.");
+	}
+	c->teardowns++;
+	c->in_repetition = 0;
+}
+
+// An operation that does nothing.
+static void do_nothing(void *arg, int i)
+{
+}
+
+// Check the result of bench_summarize() for the times 1, 2, ..., 1000
+// in random order.
+static void test_summarize(void)
+{
+	double samples[1000];
+	for (int i = 0; i < 1000; i++) {
+		samples[i] = i + 1;
+	}
+	for (int i = 999; i > 0; i--) {
+		int k = rand() % (i + 1);
+		double t = samples[i];
+		samples[i] = samples[k];
+		samples[k] = t;
+	}
+	bench_result r = bench_summarize(samples, 1000);
+	if (r.samples != 1000 || r.min != 1 || r.max != 1000) {
+		fail("Wrong number of samples, min or max.");
+	}
+	if (r.p50 != 500 || r.p99 != 990 || r.p999 != 999) {
+		fail("Wrong percentiles.");
+	}
+	if (r.total != 500500 || fabs(r.mean - 500.5) > 1e-9 ||
+	    r.best != r.mean) {
+		fail("Wrong total or mean.");
+	}
+	if (fabs(r.ops_per_sec - 1000 / 500500e-9) > 1e-3) {
+		fail("Wrong throughput.");
+	}
+	for (int i = 1; i < 1000; i++) {
+		if (samples[i - 1] > samples[i]) {
+			fail("Samples not sorted.");
+		}
+	}
+
+	for (int c = 0; c < BENCH_COUNTERS; c++) {
+		if (!isnan(r.counters[c])) {
+			fail("Counter not NAN without counters.");
+		}
+	}
+
+	bench_result empty = bench_summarize(samples, 0);
+	if (empty.samples != 0 || empty.p50 != 0 || empty.ops_per_sec != 0 ||
+	    !isnan(empty.counters[BENCH_CYCLES])) {
+		fail("Wrong result for no samples.");
+	}
+
+	double one = 42;
+	r = bench_summarize(&one, 1);
+	if (r.p50 != 42 || r.p99 != 42 || r.p999 != 42) {
+		fail("Wrong percentiles for one sample.");
+	}
+}
+
+// Check the calls made by bench_run() for some options. With counters,
+// the phase is run once more.
+static void test_run(int warmup, int repetitions, int batch, int ops,
+		     unsigned counters)
+{
+	struct counts c = { 0 };
+	bench_phase p = { "count", ops, count_setup, count_op,
+			  count_teardown };
+	bench_options opt = { warmup, repetitions, batch, counters };
+	bench_result r = bench_run(&p, &opt, &c);
+	int runs = warmup + repetitions + (counters != 0 && ops > 0);
+	if (c.setups != runs || c.teardowns != runs || c.in_repetition) {
+		fail("Wrong number of setups or teardowns.");
+	}
+	if (c.ops != runs * ops) {
+		fail("Wrong number of operations.");
+	}
+	if (r.samples != (long)repetitions * ops) {
+		fail("Wrong number of samples.");
+	}
+	if (r.min < 0 || r.min > r.p50 || r.p50 > r.p99 || r.p99 > r.p999 ||
+	    r.p999 > r.max) {
+		fail("Percentiles out of order.");
+	}
+	if (r.best > r.mean + 1e-9 || (ops > 0 && r.best < r.min - 1e-9)) {
+		fail("Fastest repetition slower than the mean.");
+	}
+}
+
+// Check the hardware counters of bench_run(). Counters that cannot be
+// read must be NAN, the others must be plausible for a loop.
+static void test_counters(void)
+{
+	if (bench_counter_name(BENCH_CYCLES) == NULL ||
+	    bench_counter_name(BENCH_COUNTERS) != NULL) {
+		fail("Wrong counter names.");
+	}
+	unsigned available = bench_counters_available(BENCH_ALL_COUNTERS);
+	if ((available & ~BENCH_ALL_COUNTERS) != 0 ||
+	    bench_counters_available(0) != 0) {
+		fail("Unknown counters available.");
+	}
+	printf("(%s) ", available == 0 ? "no counters available" :
+	       available == BENCH_ALL_COUNTERS ? "all counters available" :
+	       "some counters available");
+
+	struct counts c = { 0 };
+	bench_phase p = { "count", 1000, count_setup, count_op,
+			  count_teardown };
+	bench_options opt = bench_default_options();
+	opt.counters = 1u << BENCH_INSTRUCTIONS | 1u << BENCH_BRANCH_MISSES;
+	bench_result r = bench_run(&p, &opt, &c);
+	for (int k = 0; k < BENCH_COUNTERS; k++) {
+		bool read = (opt.counters & available & (1u << k)) != 0;
+		if (read != !isnan(r.counters[k])) {
+			fail("Counter read or not read wrongly.");
+		}
+		if (read && r.counters[k] < 0) {
+			fail("Negative counter.");
+		}
+	}
+	if (!isnan(r.counters[BENCH_INSTRUCTIONS]) &&
+	    r.counters[BENCH_INSTRUCTIONS] < 1) {
+		fail("Operation took less than one instruction.");
+	}
+}
+
+int main(void)
+{
+	printf("%s, %s %s: Test of bench.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	printf("Testing bench_summarize...");
+	fflush(stdout);
+	test_summarize();
+	printf("done.\n");
+
+	printf("Testing bench_run...");
+	fflush(stdout);
+	test_run(0, 1, 1, 100, 0);
+	test_run(2, 3, 1, 100, 0);
+	test_run(1, 2, 7, 100, 0);
+	test_run(1, 2, 1000, 100, 0);
+	test_run(1, 1, 1, 0, 0);
+	test_run(1, 2, 1, 100, BENCH_ALL_COUNTERS);
+	test_run(1, 1, 1, 0, BENCH_ALL_COUNTERS);
+
+	// Functions that may be NULL.
+	bench_phase p = { "no setup", 10, NULL, do_nothing, NULL };
+	bench_result r = bench_run(&p, NULL, NULL);
+	if (r.samples != 10) {
+		fail("Wrong number of samples with default options.");
+	}
+	printf("done.\n");
+
+	printf("Testing hardware counters...");
+	fflush(stdout);
+	test_counters();
+	printf("done.\n");
+
+	if (bench_clock_overhead() < 0 || bench_now() == 0) {
+		fail("Bad clock.");
+	}
+
+	printf("\nSUCCESS: Implementation passed all tests. Normal exit.\n\n");
+	return 0;
+}
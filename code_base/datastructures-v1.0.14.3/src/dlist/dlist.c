@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 #include <dlist.h>
 
@@ -18,10 +19,22 @@
  *   v1.0 2018-01-28: First public version.
  *   v1.1 2023-01-19: Added dlist_pos_are_equal and dlist_pos_is_valid functions.
  *   v1.2 2023-03-23: Renamed dlist_pos_are_equal to dlist_pos_is_equal.
+ *   v1.3 2026-10-16: Added dlist_empty_with_allocator.
+ *   v1.4 2026-10-16: Recycle cells through a per-list pool. Added dlist_reserve.
+ *   v1.5 2026-10-17: Added dlist_stats and dlist_stats_reset.
+ *   v1.6 2026-10-17: Added dlist_memory_usage.
+ *   v1.7 2026-10-17: Use the allocator helpers in util.h.
  */
 
 // ===========INTERNAL DATA TYPES============
 
+// Size of a cache line in bytes. Cell chunks are aligned to this.
+#define CACHE_LINE_SIZE 64
+// Number of cells in the first chunk.
+#define FIRST_CHUNK_CELLS 16
+// Maximum number of cells in a chunk.
+#define MAX_CHUNK_CELLS 1024
+
 /*
  * The list elements are implemented as one-cells with a forward link.
  * The list position is a pointer to the internal cell before the cell
@@ -32,14 +45,107 @@ struct cell {
 	void *value;
 };
 
+/*
+ * Cells are allocated in chunks and recycled through a free list, so
+ * removed cells are reused by later inserts without calling the
+ * allocator. All chunks are returned when the list is killed.
+ */
+struct cell_chunk {
+	struct cell_chunk *next;
+	size_t size; // Number of bytes allocated for the chunk.
+	size_t num_cells;
+};
 
 struct dlist {
 	struct cell *head;
 	free_function free_func;
+	allocator alloc;
+	struct cell *free_cells; // Recycled cells, linked by next.
+	size_t num_free_cells;
+	struct cell_chunk *chunks; // Last allocated chunk, or NULL.
+#ifdef DOA_STATS
+	op_stats stats;
+#endif
 };
 
 // ===========INTERNAL FUNCTION IMPLEMENTATIONS============
 
+/**
+ * add_chunk() - Allocate a chunk of cells and put them on the free list.
+ * @l: List to manipulate.
+ * @n: Number of cells in the chunk.
+ *
+ * The first cell of the chunk is aligned to a cache line.
+ *
+ * Returns: Nothing.
+ */
+static void add_chunk(dlist *l, size_t n)
+{
+	// Leave room to align the first cell.
+	size_t size = sizeof(struct cell_chunk) + CACHE_LINE_SIZE +
+		n * sizeof(struct cell);
+	struct cell_chunk *chunk = mem_alloc(&l->alloc, size);
+	STATS_COUNT(l, allocations, 1);
+	chunk->size = size;
+	chunk->num_cells = n;
+	chunk->next = l->chunks;
+	l->chunks = chunk;
+
+	uintptr_t start = (uintptr_t)(chunk + 1);
+	start = (start + CACHE_LINE_SIZE - 1) &
+		~(uintptr_t)(CACHE_LINE_SIZE - 1);
+	struct cell *cells = (struct cell *)start;
+
+	// Link the new cells into the free list so that they are
+	// handed out in address order.
+	for (size_t i = n; i > 0; i--) {
+		cells[i - 1].next = l->free_cells;
+		l->free_cells = &cells[i - 1];
+	}
+	l->num_free_cells += n;
+}
+
+/**
+ * cell_alloc() - Get an unused cell from the pool.
+ * @l: List to manipulate.
+ *
+ * Allocates a new chunk if the free list is empty. Each chunk is
+ * twice as large as the previous one, up to MAX_CHUNK_CELLS.
+ *
+ * Returns: Pointer to an unused cell.
+ */
+static struct cell *cell_alloc(dlist *l)
+{
+	if (l->free_cells == NULL) {
+		size_t n = FIRST_CHUNK_CELLS;
+		if (l->chunks != NULL) {
+			n = 2 * l->chunks->num_cells;
+			if (n > MAX_CHUNK_CELLS) {
+				n = MAX_CHUNK_CELLS;
+			}
+		}
+		add_chunk(l, n);
+	}
+	struct cell *c = l->free_cells;
+	l->free_cells = c->next;
+	l->num_free_cells--;
+	return c;
+}
+
+/**
+ * cell_release() - Return a cell to the pool.
+ * @l: List to manipulate.
+ * @c: Cell to release. Must not be linked into the list.
+ *
+ * Returns: Nothing.
+ */
+static void cell_release(dlist *l, struct cell *c)
+{
+	c->next = l->free_cells;
+	l->free_cells = c;
+	l->num_free_cells++;
+}
+
 /**
  * dlist_empty() - Create an empty dlist.
  * @free_func: A pointer to a function (or NULL) to be called to
@@ -49,11 +155,31 @@ struct dlist {
  */
 dlist *dlist_empty(free_function free_func)
 {
+	return dlist_empty_with_allocator(free_func, NULL);
+}
+
+/**
+ * dlist_empty_with_allocator() - Create an empty dlist using an allocator.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the list. NULL selects malloc()/free().
+ *
+ * Returns: A pointer to the new list.
+ */
+dlist *dlist_empty_with_allocator(free_function free_func,
+				  const allocator *alloc)
+{
+	allocator a = use_allocator(alloc);
+
 	// Allocate memory for the list structure.
-	dlist *l = calloc(1, sizeof(*l));
+	dlist *l = mem_alloc(&a, sizeof(*l));
+	l->alloc = a;
 
 	// Allocate memory for the list head.
-	l->head = calloc(1, sizeof(struct cell));
+	l->head = mem_alloc(&l->alloc, sizeof(struct cell));
+	// The list structure and the head.
+	STATS_COUNT(l, allocations, 2);
 
 	// No elements in list so far.
 	l->head->next = NULL;
@@ -64,6 +190,25 @@ dlist *dlist_empty(free_function free_func)
 	return l;
 }
 
+/**
+ * dlist_reserve() - Make room for more elements in a dlist.
+ * @l: List to manipulate.
+ * @n: Number of elements.
+ *
+ * Pre-allocates cells so that the next n inserts into the list, with
+ * no removes in between, do not allocate any memory. Removed cells are
+ * always reused, so a list that never holds more than n elements
+ * after dlist_reserve(l, n) never allocates again.
+ *
+ * Returns: Nothing.
+ */
+void dlist_reserve(dlist *l, size_t n)
+{
+	if (l->num_free_cells < n) {
+		add_chunk(l, n - l->num_free_cells);
+	}
+}
+
 /**
  * dlist_is_empty() - Check if a dlist is empty.
  * @l: List to check.
@@ -102,6 +247,7 @@ dlist_pos dlist_next(const dlist *l, const dlist_pos p)
 		fprintf(stderr,"dlist_next: Warning: Trying to navigate "
 			"past end of list!");
 	}
+	STATS_COUNT(l, traversals, 1);
 	return p->next;
 }
 
@@ -133,6 +279,7 @@ void *dlist_inspect(const dlist *l, const dlist_pos p)
 		fprintf(stderr,"dlist_inspect: Warning: Trying to inspect "
 			"position at end of list!\n");
 	}
+	STATS_COUNT(l, ops, 1);
 	return p->next->value;
 }
 
@@ -149,8 +296,8 @@ void *dlist_inspect(const dlist *l, const dlist_pos p)
  */
 dlist_pos dlist_insert(dlist *l, void *v, const dlist_pos p)
 {
-	// Create new element.
-	dlist_pos new_pos=calloc(1, sizeof(struct cell));
+	// Get a new element from the pool.
+	dlist_pos new_pos=cell_alloc(l);
 	// Set value.
 	new_pos->value=v;
 
@@ -158,6 +305,9 @@ dlist_pos dlist_insert(dlist *l, void *v, const dlist_pos p)
 	new_pos->next=p->next;
 	p->next=new_pos;
 
+	STATS_COUNT(l, ops, 1);
+	STATS_ADD_SIZE(l, 1);
+
 	return p;
 }
 
@@ -185,8 +335,10 @@ dlist_pos dlist_remove(dlist *l, const dlist_pos p)
 		// Free any user-allocated memory for the value.
 		l->free_func(c->value);
 	}
-	// Free the memory allocated to the cell itself.
-	free(c);
+	// Return the cell itself to the pool.
+	cell_release(l, c);
+	STATS_COUNT(l, ops, 1);
+	STATS_SUB_SIZE(l, 1);
 	// Return the position of the next element.
 	return p;
 }
@@ -214,9 +366,16 @@ void dlist_kill(dlist *l)
 		p = dlist_remove(l, p);
 	}
 
+	// Free all cell chunks.
+	struct cell_chunk *chunk = l->chunks;
+	while (chunk != NULL) {
+		struct cell_chunk *next = chunk->next;
+		mem_free(&l->alloc, chunk, chunk->size);
+		chunk = next;
+	}
 	// Free the head and the list itself.
-	free(l->head);
-	free(l);
+	mem_free(&l->alloc, l->head, sizeof(struct cell));
+	mem_free(&l->alloc, l, sizeof(*l));
 }
 
 /**
@@ -249,6 +408,56 @@ void dlist_print(const dlist *l, inspect_callback print_func)
 	printf(" )\n");
 }
 
+/**
+ * dlist_stats() - Return the operation statistics of a list.
+ * @l: List to inspect.
+ *
+ * Returns: The statistics since the list was created or last reset.
+ *	    All fields are 0 unless compiled with DOA_STATS defined.
+ */
+op_stats dlist_stats(const dlist *l)
+{
+	return STATS_GET(l);
+}
+
+/**
+ * dlist_stats_reset() - Reset the operation statistics of a list.
+ * @l: List to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void dlist_stats_reset(dlist *l)
+{
+	STATS_RESET(l);
+}
+
+/**
+ * dlist_memory_usage() - Return the memory used by a list.
+ * @l: List to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage dlist_memory_usage(const dlist *l)
+{
+	mem_usage m;
+	size_t num_cells = 0;
+
+	// The list, its head cell and the chunk headers, including
+	// the room left to align the cells.
+	m.header = sizeof(*l) + sizeof(struct cell);
+	for (struct cell_chunk *chunk = l->chunks; chunk != NULL;
+	     chunk = chunk->next) {
+		m.header += chunk->size - chunk->num_cells * sizeof(struct cell);
+		num_cells += chunk->num_cells;
+	}
+	m.elements = (num_cells - l->num_free_cells) * sizeof(struct cell);
+	m.slack = l->num_free_cells * sizeof(struct cell);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
+
 /**
  * dlist_pos_is_equal() - Return true if two positions in a dlist are equal.
  * @l: List to inspect.
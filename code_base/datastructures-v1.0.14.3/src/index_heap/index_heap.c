@@ -0,0 +1,353 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <index_heap.h>
+
+/*
+ * Implementation of an indexed priority queue for the "Datastructures
+ * and algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The heap is stored in an array with the root at position 0 and the
+ * children of position p at positions d*p + 1 .. d*p + d. Each element
+ * holds an index together with its priority, so that the children of
+ * a node are compared without looking anywhere else in memory. "pos"
+ * maps each index to its position in the array, or -1 if the index is
+ * not in the queue.
+ *
+ * The elements are moved with a hole instead of swaps: sift_up() and
+ * sift_down() move the elements in the way one step each and write the
+ * moved element only once, at its final position.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ *   v1.1 2026-10-17: Added index_heap_memory_usage.
+ */
+
+// ===========INTERNAL DATA TYPES============
+
+struct element {
+	double priority;
+	int index;
+};
+
+struct index_heap {
+	struct element *elements; // The heap, size elements.
+	int *pos; // Position of each index in elements, or -1.
+	int size; // Number of indexes in the queue.
+	int capacity; // Number of indexes.
+	int arity; // Number of children of each node.
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * place() - Store an element at a position in a heap.
+ * @h: Queue to manipulate.
+ * @p: Position in the heap.
+ * @e: Element to store.
+ *
+ * Returns: Nothing.
+ */
+static void place(index_heap *h, int p, struct element e)
+{
+	h->elements[p] = e;
+	h->pos[e.index] = p;
+}
+
+/**
+ * sift_up() - Move an element up from a position to its place.
+ * @h: Queue to manipulate.
+ * @p: Position of the hole to start from.
+ * @e: Element to put into the heap.
+ *
+ * Returns: Nothing.
+ */
+static void sift_up(index_heap *h, int p, struct element e)
+{
+	while (p > 0) {
+		int parent = (p - 1) / h->arity;
+		if (h->elements[parent].priority <= e.priority) {
+			break;
+		}
+		place(h, p, h->elements[parent]);
+		p = parent;
+	}
+	place(h, p, e);
+}
+
+/**
+ * sift_down() - Move an element down from a position to its place.
+ * @h: Queue to manipulate.
+ * @p: Position of the hole to start from.
+ * @e: Element to put into the heap.
+ *
+ * Returns: Nothing.
+ */
+static void sift_down(index_heap *h, int p, struct element e)
+{
+	for (;;) {
+		int first = h->arity * p + 1;
+		if (first >= h->size) {
+			break;
+		}
+		int last = first + h->arity < h->size ?
+			first + h->arity : h->size;
+
+		// Find the child with the lowest priority.
+		int min = first;
+		for (int c = first + 1; c < last; c++) {
+			if (h->elements[c].priority <
+			    h->elements[min].priority) {
+				min = c;
+			}
+		}
+		if (h->elements[min].priority >= e.priority) {
+			break;
+		}
+		place(h, p, h->elements[min]);
+		p = min;
+	}
+	place(h, p, e);
+}
+
+/**
+ * index_heap_empty() - Create an empty queue.
+ * @capacity: Number of indexes, i.e. the indexes are 0 .. capacity - 1.
+ * @arity: Number of children of each node in the heap, at least 2.
+ *
+ * Returns: A pointer to the new queue.
+ */
+index_heap *index_heap_empty(int capacity, int arity)
+{
+	index_heap *h = calloc(1, sizeof(*h));
+	int n = capacity > 0 ? capacity : 1;
+	h->elements = malloc(n * sizeof(struct element));
+	h->pos = malloc(n * sizeof(int));
+	if (h->elements == NULL || h->pos == NULL) {
+		fprintf(stderr, "index_heap: Out of memory.\n");
+		exit(EXIT_FAILURE);
+	}
+	for (int i = 0; i < capacity; i++) {
+		h->pos[i] = -1;
+	}
+	h->size = 0;
+	h->capacity = capacity;
+	h->arity = arity < 2 ? 2 : arity;
+	return h;
+}
+
+/**
+ * index_heap_is_empty() - Check if a queue is empty.
+ * @h: Queue to check.
+ *
+ * Returns: True if the queue is empty, otherwise false.
+ */
+bool index_heap_is_empty(const index_heap *h)
+{
+	return h->size == 0;
+}
+
+/**
+ * index_heap_size() - Return the number of indexes in a queue.
+ * @h: Queue to inspect.
+ *
+ * Returns: The number of indexes in the queue.
+ */
+int index_heap_size(const index_heap *h)
+{
+	return h->size;
+}
+
+/**
+ * index_heap_contains() - Check if an index is in a queue.
+ * @h: Queue to inspect.
+ * @i: Index to look for.
+ *
+ * Returns: True if i is in the queue, otherwise false.
+ */
+bool index_heap_contains(const index_heap *h, int i)
+{
+	return h->pos[i] >= 0;
+}
+
+/**
+ * index_heap_priority() - Return the priority of an index in a queue.
+ * @h: Queue to inspect.
+ * @i: Index to inspect.
+ *
+ * NOTE: Undefined if i is not in the queue.
+ *
+ * Returns: The priority of i.
+ */
+double index_heap_priority(const index_heap *h, int i)
+{
+	return h->elements[h->pos[i]].priority;
+}
+
+/**
+ * index_heap_push() - Put an index into a queue.
+ * @h: Queue to manipulate.
+ * @i: Index to put into the queue.
+ * @priority: Priority of i.
+ *
+ * NOTE: Undefined if i is already in the queue.
+ *
+ * Returns: The modified queue.
+ */
+index_heap *index_heap_push(index_heap *h, int i, double priority)
+{
+	struct element e = { priority, i };
+	// Start with a hole at the first free position.
+	h->size++;
+	sift_up(h, h->size - 1, e);
+	return h;
+}
+
+/**
+ * index_heap_decrease_key() - Lower the priority of an index in a queue.
+ * @h: Queue to manipulate.
+ * @i: Index to change the priority of.
+ * @priority: New priority of i.
+ *
+ * NOTE: Undefined if i is not in the queue, or if priority is higher
+ * than the current priority of i.
+ *
+ * Returns: The modified queue.
+ */
+index_heap *index_heap_decrease_key(index_heap *h, int i, double priority)
+{
+	struct element e = { priority, i };
+	sift_up(h, h->pos[i], e);
+	return h;
+}
+
+/**
+ * index_heap_top() - Inspect the index with the lowest priority.
+ * @h: Queue to inspect.
+ *
+ * Returns: The index at the top of the queue.
+ *	    NOTE: The return value is undefined for an empty queue.
+ */
+int index_heap_top(const index_heap *h)
+{
+	if (index_heap_is_empty(h)) {
+		fprintf(stderr, "index_heap_top: Warning: top on "
+			"empty queue\n");
+		return -1;
+	}
+	return h->elements[0].index;
+}
+
+/**
+ * index_heap_top_priority() - Inspect the lowest priority in a queue.
+ * @h: Queue to inspect.
+ *
+ * Returns: The priority of the index at the top of the queue.
+ *	    NOTE: The return value is undefined for an empty queue.
+ */
+double index_heap_top_priority(const index_heap *h)
+{
+	if (index_heap_is_empty(h)) {
+		fprintf(stderr, "index_heap_top_priority: Warning: top on "
+			"empty queue\n");
+		return 0;
+	}
+	return h->elements[0].priority;
+}
+
+/**
+ * index_heap_pop() - Remove the index with the lowest priority.
+ * @h: Queue to manipulate.
+ *
+ * The removed index may be pushed into the queue again.
+ * NOTE: Undefined for an empty queue.
+ *
+ * Returns: The modified queue.
+ */
+index_heap *index_heap_pop(index_heap *h)
+{
+	if (index_heap_is_empty(h)) {
+		fprintf(stderr, "index_heap_pop: Warning: pop on "
+			"empty queue\n");
+		return h;
+	}
+	h->pos[h->elements[0].index] = -1;
+	h->size--;
+	// Move the last element into the hole at the root.
+	if (h->size > 0) {
+		sift_down(h, 0, h->elements[h->size]);
+	}
+	return h;
+}
+
+/**
+ * index_heap_clear() - Remove all indexes from a queue.
+ * @h: Queue to manipulate.
+ *
+ * Takes time proportional to the number of indexes in the queue, not
+ * to its capacity.
+ *
+ * Returns: The modified queue.
+ */
+index_heap *index_heap_clear(index_heap *h)
+{
+	for (int p = 0; p < h->size; p++) {
+		h->pos[h->elements[p].index] = -1;
+	}
+	h->size = 0;
+	return h;
+}
+
+/**
+ * index_heap_kill() - Destroy a given queue.
+ * @h: Queue to destroy.
+ *
+ * Returns all dynamic memory used by the queue.
+ *
+ * Returns: Nothing.
+ */
+void index_heap_kill(index_heap *h)
+{
+	free(h->elements);
+	free(h->pos);
+	free(h);
+}
+
+/**
+ * index_heap_print() - Print the contents of a queue.
+ * @h: Queue to inspect.
+ *
+ * Prints each index and its priority in heap order, i.e. the top
+ * index first but the rest in no particular order.
+ *
+ * Returns: Nothing.
+ */
+void index_heap_print(const index_heap *h)
+{
+	printf("{ ");
+	for (int p = 0; p < h->size; p++) {
+		printf("[%d: %g]", h->elements[p].index,
+		       h->elements[p].priority);
+		if (p < h->size - 1) {
+			printf(", ");
+		}
+	}
+	printf(" }\n");
+}
+
+/**
+ * index_heap_memory_usage() - Return the memory used by a queue.
+ * @h: Queue to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage index_heap_memory_usage(const index_heap *h)
+{
+	mem_usage m;
+	m.header = sizeof(*h) + h->capacity * sizeof(*h->pos);
+	m.elements = h->size * sizeof(struct element);
+	m.slack = (h->capacity - h->size) * sizeof(struct element);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
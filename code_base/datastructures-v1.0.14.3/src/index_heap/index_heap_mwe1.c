@@ -0,0 +1,53 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <index_heap.h>
+
+/*
+ * Minimum working example for index_heap.c.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-17"
+
+int main(void)
+{
+	printf("%s, %s %s: Create indexed 4-ary heap.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	// Create a queue for the indexes 0..9.
+	index_heap *h = index_heap_empty(10, 4);
+
+	// Put some indexes into the queue.
+	double priorities[] = { 7.5, 3.0, 9.25, 5.0, 1.5 };
+	for (int i = 0; i < 5; i++) {
+		h = index_heap_push(h, i, priorities[i]);
+	}
+
+	printf("--QUEUE after pushing 5 indexes--\n");
+	index_heap_print(h);
+
+	// Lower the priority of index 2, which moves it to the top.
+	h = index_heap_decrease_key(h, 2, 0.5);
+
+	printf("--QUEUE after lowering the priority of index 2 to 0.5--\n");
+	index_heap_print(h);
+
+	// Empty the queue in priority order.
+	printf("--Indexes in priority order--\n");
+	while (!index_heap_is_empty(h)) {
+		printf("%d (%g)\n", index_heap_top(h),
+		       index_heap_top_priority(h));
+		h = index_heap_pop(h);
+	}
+
+	// Kill queue.
+	index_heap_kill(h);
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
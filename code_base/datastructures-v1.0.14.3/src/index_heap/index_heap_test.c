@@ -0,0 +1,159 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include <index_heap.h>
+
+/*
+ * Test program for index_heap.c. Random sequences of push,
+ * decrease_key, pop and clear are run on heaps of several arities,
+ * and the result of each operation is compared with a simple array
+ * of priorities that is searched linearly.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-17"
+
+// Number of indexes in each heap.
+#define CAPACITY 500
+
+// Number of random operations per arity.
+#define OPERATIONS 200000
+
+// Print an error message and exit.
+static void fail(const char *msg)
+{
+	fprintf(stderr, "FAIL: %s\n", msg);
+	exit(EXIT_FAILURE);
+}
+
+// Return the index with the lowest priority in the reference, or -1.
+static int reference_min(const bool *in, const double *priority)
+{
+	int min = -1;
+	for (int i = 0; i < CAPACITY; i++) {
+		if (in[i] && (min == -1 || priority[i] < priority[min])) {
+			min = i;
+		}
+	}
+	return min;
+}
+
+// Check that a queue is empty and behaves as such.
+static void test_empty(int arity)
+{
+	index_heap *h = index_heap_empty(CAPACITY, arity);
+	if (!index_heap_is_empty(h) || index_heap_size(h) != 0) {
+		fail("New queue is not empty.");
+	}
+	for (int i = 0; i < CAPACITY; i++) {
+		if (index_heap_contains(h, i)) {
+			fail("New queue contains an index.");
+		}
+	}
+	index_heap_kill(h);
+}
+
+// Check that equal priorities are handled and that a popped index
+// can be pushed again.
+static void test_equal_priorities(int arity)
+{
+	index_heap *h = index_heap_empty(CAPACITY, arity);
+	for (int round = 0; round < 2; round++) {
+		for (int i = 0; i < CAPACITY; i++) {
+			h = index_heap_push(h, i, 1.0);
+		}
+		bool *seen = calloc(CAPACITY, sizeof(bool));
+		while (!index_heap_is_empty(h)) {
+			int i = index_heap_top(h);
+			if (seen[i] || index_heap_top_priority(h) != 1.0) {
+				fail("Wrong top with equal priorities.");
+			}
+			seen[i] = true;
+			h = index_heap_pop(h);
+			if (index_heap_contains(h, i)) {
+				fail("Popped index is still in the queue.");
+			}
+		}
+		free(seen);
+	}
+	index_heap_kill(h);
+}
+
+// Run random operations and compare with the reference.
+static void test_random(int arity)
+{
+	index_heap *h = index_heap_empty(CAPACITY, arity);
+	bool in[CAPACITY] = { false };
+	double priority[CAPACITY];
+	int size = 0;
+
+	srand(arity);
+	for (int op = 0; op < OPERATIONS; op++) {
+		int i = rand() % CAPACITY;
+		int r = rand() % 100;
+		if (r < 40) {
+			double p = rand() % 1000;
+			if (in[i]) {
+				// Lower the priority, sometimes to the same value.
+				p = priority[i] - rand() % 10;
+				h = index_heap_decrease_key(h, i, p);
+			} else {
+				h = index_heap_push(h, i, p);
+				in[i] = true;
+				size++;
+			}
+			priority[i] = p;
+		} else if (r < 99) {
+			if (size > 0) {
+				int min = reference_min(in, priority);
+				int top = index_heap_top(h);
+				if (!in[top] || priority[top] != priority[min] ||
+				    index_heap_top_priority(h) != priority[min]) {
+					fail("Top is not the lowest priority.");
+				}
+				h = index_heap_pop(h);
+				in[top] = false;
+				size--;
+			}
+		} else {
+			h = index_heap_clear(h);
+			for (int k = 0; k < CAPACITY; k++) {
+				in[k] = false;
+			}
+			size = 0;
+		}
+
+		if (index_heap_size(h) != size ||
+		    index_heap_is_empty(h) != (size == 0)) {
+			fail("Wrong size.");
+		}
+		if (index_heap_contains(h, i) != in[i] ||
+		    (in[i] && index_heap_priority(h, i) != priority[i])) {
+			fail("Wrong contents.");
+		}
+	}
+	index_heap_kill(h);
+}
+
+int main(void)
+{
+	printf("%s, %s %s: Test of index_heap.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	for (int arity = 2; arity <= 8; arity++) {
+		printf("Testing arity %d...", arity);
+		fflush(stdout);
+		test_empty(arity);
+		test_equal_priorities(arity);
+		test_random(arity);
+		printf("done.\n");
+	}
+
+	printf("\nSUCCESS: Implementation passed all tests. Normal exit.\n\n");
+	return 0;
+}
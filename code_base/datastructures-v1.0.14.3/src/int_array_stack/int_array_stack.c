@@ -0,0 +1,252 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <int_array_stack.h>
+
+/*
+ * Implementation of an integer stack for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The values are stored in a dynamic array with the bottom of the
+ * stack at index 0. The array is doubled when it is full, so a
+ * sequence of n pushes copies O(n) values in total.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-17: int_array_stack_push_n() accepts n = 0.
+ *   v1.2 2026-10-17: Added int_array_stack_memory_usage.
+ */
+
+// Number of elements in the array of a new stack.
+#define STACK_INITIAL_CAPACITY 16
+
+// ===========INTERNAL DATA TYPES============
+
+struct int_array_stack {
+	int *elements;
+	size_t size; // Number of values on the stack.
+	size_t capacity; // Number of array elements.
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * reserve() - Make sure that a stack has room for a number of values.
+ * @s: Stack to manipulate.
+ * @n: Number of values.
+ *
+ * Doubles the array until it can hold n values.
+ *
+ * Returns: Nothing.
+ */
+static void reserve(int_array_stack *s, size_t n)
+{
+	if (n <= s->capacity) {
+		return;
+	}
+	size_t capacity = s->capacity;
+	while (capacity < n) {
+		capacity *= 2;
+	}
+	int *elements = realloc(s->elements, capacity * sizeof(int));
+	if (elements == NULL) {
+		fprintf(stderr, "int_array_stack: Out of memory.\n");
+		exit(EXIT_FAILURE);
+	}
+	s->elements = elements;
+	s->capacity = capacity;
+}
+
+/**
+ * int_array_stack_empty() - Create an empty stack.
+ *
+ * Returns: A pointer to the new stack.
+ */
+int_array_stack *int_array_stack_empty(void)
+{
+	int_array_stack *s = calloc(1, sizeof(*s));
+	s->capacity = STACK_INITIAL_CAPACITY;
+	s->elements = malloc(s->capacity * sizeof(int));
+	s->size = 0;
+	return s;
+}
+
+/**
+ * int_array_stack_is_empty() - Check if a stack is empty.
+ * @s: Stack to check.
+ *
+ * Returns: True if stack is empty, otherwise false.
+ */
+bool int_array_stack_is_empty(const int_array_stack *s)
+{
+	return s->size == 0;
+}
+
+/**
+ * int_array_stack_size() - Return the number of values on a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The number of values on the stack.
+ */
+size_t int_array_stack_size(const int_array_stack *s)
+{
+	return s->size;
+}
+
+/**
+ * int_array_stack_push() - Push a value on top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Value (integer) to be put on the stack.
+ *
+ * Returns: The modified stack.
+ */
+int_array_stack *int_array_stack_push(int_array_stack *s, int v)
+{
+	if (s->size == s->capacity) {
+		reserve(s, s->size + 1);
+	}
+	// Store value at first free position.
+	s->elements[s->size] = v;
+	s->size++;
+	return s;
+}
+
+/**
+ * int_array_stack_push_n() - Push several values on top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Array of values to be put on the stack, may be NULL if n is 0.
+ * @n: Number of values in v.
+ *
+ * The values are pushed in array order, i.e. v[n-1] ends up on top.
+ *
+ * Returns: The modified stack.
+ */
+int_array_stack *int_array_stack_push_n(int_array_stack *s, const int *v,
+					size_t n)
+{
+	// memcpy() must not be given a NULL pointer, even for 0 bytes.
+	if (n == 0) {
+		return s;
+	}
+
+	// Grow at most once, then copy all values at once.
+	reserve(s, s->size + n);
+	memcpy(s->elements + s->size, v, n * sizeof(int));
+	s->size += n;
+	return s;
+}
+
+/**
+ * int_array_stack_pop() - Remove the element at the top of a stack.
+ * @s: Stack to manipulate.
+ *
+ * NOTE: Undefined for an empty stack.
+ *
+ * Returns: The modified stack.
+ */
+int_array_stack *int_array_stack_pop(int_array_stack *s)
+{
+	if (int_array_stack_is_empty(s)) {
+		fprintf(stderr, "int_array_stack_pop: Warning: pop on "
+			"empty stack\n");
+	} else {
+		s->size--;
+	}
+	return s;
+}
+
+/**
+ * int_array_stack_pop_n() - Remove several values from the top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Array where the removed values are stored, or NULL.
+ * @n: Maximum number of values to remove.
+ *
+ * Removes up to n values. If v is not NULL, the values are stored in
+ * v in the order they are removed, i.e. the old top value in v[0].
+ *
+ * Returns: The number of values removed, i.e. the smaller of n and
+ * the stack size.
+ */
+size_t int_array_stack_pop_n(int_array_stack *s, int *v, size_t n)
+{
+	if (n > s->size) {
+		n = s->size;
+	}
+	if (v != NULL) {
+		for (size_t i = 0; i < n; i++) {
+			v[i] = s->elements[s->size - 1 - i];
+		}
+	}
+	s->size -= n;
+	return n;
+}
+
+/**
+ * int_array_stack_top() - Inspect the value at the top of the stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The value at the top of the stack.
+ *	    NOTE: The return value is undefined for an empty stack.
+ */
+int int_array_stack_top(const int_array_stack *s)
+{
+	if (int_array_stack_is_empty(s)) {
+		fprintf(stderr, "int_array_stack_top: Warning: top on "
+			"empty stack\n");
+		return 0;
+	}
+	return s->elements[s->size - 1];
+}
+
+/**
+ * int_array_stack_kill() - Destroy a given stack.
+ * @s: Stack to destroy.
+ *
+ * Returns all dynamic memory used by the stack.
+ *
+ * Returns: Nothing.
+ */
+void int_array_stack_kill(int_array_stack *s)
+{
+	free(s->elements);
+	free(s);
+}
+
+/**
+ * int_array_stack_print() - Iterate over the stack elements and print
+ *			     their values.
+ * @s: Stack to inspect.
+ *
+ * Iterates over the stack from the top down and prints each integer.
+ *
+ * Returns: Nothing.
+ */
+void int_array_stack_print(const int_array_stack *s)
+{
+	printf("{ ");
+	for (size_t i = s->size; i > 0; i--) {
+		printf("[%d]", s->elements[i - 1]);
+		if (i > 1) {
+			printf(", ");
+		}
+	}
+	printf(" }\n");
+}
+
+/**
+ * int_array_stack_memory_usage() - Return the memory used by a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage int_array_stack_memory_usage(const int_array_stack *s)
+{
+	mem_usage m;
+	m.header = sizeof(*s);
+	m.elements = s->size * sizeof(int);
+	m.slack = (s->capacity - s->size) * sizeof(int);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
@@ -0,0 +1,152 @@
+// Needed for clock_gettime() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <int_stack.h>
+#include <int_array_stack.h>
+
+/*
+ * Benchmark of int_array_stack.c against the by-value int_stack.c.
+ * Both stacks perform the same sequence of operations: fill the stack
+ * to a given depth with push, then empty it with top/pop, repeated
+ * until a total number of operations is reached. int_stack can hold
+ * at most MAX_STACK_SIZE values, so the comparison uses that depth.
+ * int_array_stack is also run with a deep stack and with the bulk
+ * push_n/pop_n functions.
+ *
+ * Usage: int_array_stack_bench [number of operations]
+ *
+ * Compile with -O2.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-17: The bulk test pushes exactly depth values.
+ *   v1.2 2026-10-17: The bulk test sums all popped values.
+ */
+
+#define VERSION "v1.2"
+#define VERSION_DATE "2026-10-17"
+
+// Default number of operations (push or pop).
+#define DEFAULT_OPS 1000000
+
+// Number of values per call in the bulk test.
+#define BULK 64
+
+// Return the current time in seconds.
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Print one result line.
+static void report(const char *name, long depth, long ops, double elapsed,
+		   long sum)
+{
+	printf("%-28s %8ld %10.3f ms %8.2f ns/op  (checksum %ld)\n", name,
+	       depth, elapsed * 1e3, elapsed * 1e9 / ops, sum);
+}
+
+// Run the test on the by-value int_stack.
+static void bench_int_stack(long depth, long ops)
+{
+	long sum = 0;
+	double start = now();
+	stack s = stack_empty();
+	for (long done = 0; done < ops; done += 2 * depth) {
+		for (long i = 0; i < depth; i++) {
+			s = stack_push(s, (int)i);
+		}
+		for (long i = 0; i < depth; i++) {
+			sum += stack_top(s);
+			s = stack_pop(s);
+		}
+	}
+	stack_kill(s);
+	report("int_stack (by value)", depth, ops, now() - start, sum);
+}
+
+// Run the test on int_array_stack.
+static void bench_int_array_stack(long depth, long ops)
+{
+	long sum = 0;
+	double start = now();
+	int_array_stack *s = int_array_stack_empty();
+	for (long done = 0; done < ops; done += 2 * depth) {
+		for (long i = 0; i < depth; i++) {
+			s = int_array_stack_push(s, (int)i);
+		}
+		for (long i = 0; i < depth; i++) {
+			sum += int_array_stack_top(s);
+			s = int_array_stack_pop(s);
+		}
+	}
+	int_array_stack_kill(s);
+	report("int_array_stack", depth, ops, now() - start, sum);
+}
+
+// Run the test on int_array_stack with push_n/pop_n.
+static void bench_int_array_stack_bulk(long depth, long ops)
+{
+	// Push the same values 0 .. depth - 1 as the other tests and sum
+	// all popped values, so that the checksums can be compared.
+	int *values = malloc(depth * sizeof(int));
+	int out[BULK];
+	long sum = 0;
+	if (values == NULL) {
+		fprintf(stderr, "int_array_stack_bench: Out of memory.\n");
+		exit(EXIT_FAILURE);
+	}
+	for (long i = 0; i < depth; i++) {
+		values[i] = (int)i;
+	}
+	double start = now();
+	int_array_stack *s = int_array_stack_empty();
+	for (long done = 0; done < ops; done += 2 * depth) {
+		// The last call pushes the remainder, so that the depth
+		// and the number of operations are the same as in the
+		// other tests.
+		for (long i = 0; i < depth; i += BULK) {
+			long n = depth - i < BULK ? depth - i : BULK;
+			s = int_array_stack_push_n(s, values + i, n);
+		}
+		size_t n;
+		while ((n = int_array_stack_pop_n(s, out, BULK)) > 0) {
+			for (size_t k = 0; k < n; k++) {
+				sum += out[k];
+			}
+		}
+	}
+	int_array_stack_kill(s);
+	report("int_array_stack push_n/pop_n", depth, ops, now() - start,
+	       sum);
+	free(values);
+}
+
+int main(int argc, char *argv[])
+{
+	printf("%s, %s %s: int_stack vs int_array_stack.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	long ops = DEFAULT_OPS;
+	if (argc > 1) {
+		ops = atol(argv[1]);
+	}
+	printf("%ld operations per test.\n\n", ops);
+	printf("%-28s %8s %13s %14s\n", "implementation", "depth", "time",
+	       "per op");
+
+	bench_int_stack(MAX_STACK_SIZE, ops);
+	bench_int_array_stack(MAX_STACK_SIZE, ops);
+	bench_int_array_stack(ops / 2, ops);
+	bench_int_array_stack_bulk(ops / 2, ops);
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
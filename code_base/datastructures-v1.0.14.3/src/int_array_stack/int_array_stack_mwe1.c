@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <int_array_stack.h>
+
+/*
+ * Minimum working example for int_array_stack.c.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-16"
+
+int main(void)
+{
+	printf("%s, %s %s: Create growable integer stack.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	// Create the stack.
+	int_array_stack *s = int_array_stack_empty();
+
+	for (int i = 1; i <= 3; i++) {
+		// Push value on stack.
+		s = int_array_stack_push(s, i);
+	}
+
+	printf("--STACK before popping--\n");
+	int_array_stack_print(s);
+
+	// Pop element from stack.
+	s = int_array_stack_pop(s);
+
+	printf("--STACK after popping--\n");
+	int_array_stack_print(s);
+
+	// Push several values at once.
+	int values[] = { 4, 5, 6, 7 };
+	s = int_array_stack_push_n(s, values, 4);
+
+	printf("--STACK after pushing 4 values--\n");
+	int_array_stack_print(s);
+
+	// Pop three values at once.
+	int popped[3];
+	size_t n = int_array_stack_pop_n(s, popped, 3);
+
+	printf("--STACK after popping %zu values: %d, %d, %d--\n", n,
+	       popped[0], popped[1], popped[2]);
+	int_array_stack_print(s);
+
+	// Kill stack.
+	int_array_stack_kill(s);
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 
 #include <list.h>
 
@@ -20,10 +21,22 @@
  *   v1.2 2023-01-20: Renamed list_pos_equal to list_pos_are_equal.
  *   v1.3 2023-02-25: Renamed list header fields head and tail.
  *   v1.4 2023-03-23: Renamed list_pos_are_equal to list_pos_is_equal.
+ *   v1.5 2026-10-16: Added list_empty_with_allocator.
+ *   v1.6 2026-10-16: Recycle cells through a per-list pool. Added list_reserve.
+ *   v1.7 2026-10-17: Added list_stats and list_stats_reset.
+ *   v1.8 2026-10-17: Added list_memory_usage.
+ *   v1.9 2026-10-17: Use the allocator helpers in util.h.
  */
 
 // ===========INTERNAL DATA TYPES============
 
+// Size of a cache line in bytes. Cell chunks are aligned to this.
+#define CACHE_LINE_SIZE 64
+// Number of cells in the first chunk.
+#define FIRST_CHUNK_CELLS 16
+// Maximum number of cells in a chunk.
+#define MAX_CHUNK_CELLS 1024
+
 /*
  * The list elements are implemented as two-cells with forward and
  * backward links and a void * for the value. The list uses two border
@@ -35,12 +48,110 @@ struct cell {
 	void *value;
 };
 
+/*
+ * Cells are allocated in chunks and recycled through a free list, so
+ * removed cells are reused by later inserts without calling the
+ * allocator. All chunks are returned when the list is killed.
+ */
+struct cell_chunk {
+	struct cell_chunk *next;
+	size_t size; // Number of bytes allocated for the chunk.
+	size_t num_cells;
+};
+
 struct list {
 	struct cell *head;
 	struct cell *tail;
 	free_function free_func;
+	allocator alloc;
+	struct cell *free_cells; // Recycled cells, linked by next.
+	size_t num_free_cells;
+	struct cell_chunk *chunks; // Last allocated chunk, or NULL.
+#ifdef DOA_STATS
+	op_stats stats;
+#endif
 };
 
+/*
+ * Internal functions
+ */
+
+/**
+ * add_chunk() - Allocate a chunk of cells and put them on the free list.
+ * @l: List to manipulate.
+ * @n: Number of cells in the chunk.
+ *
+ * The first cell of the chunk is aligned to a cache line.
+ *
+ * Returns: Nothing.
+ */
+static void add_chunk(list *l, size_t n)
+{
+	// Leave room to align the first cell.
+	size_t size = sizeof(struct cell_chunk) + CACHE_LINE_SIZE +
+		n * sizeof(struct cell);
+	struct cell_chunk *chunk = mem_alloc(&l->alloc, size);
+	STATS_COUNT(l, allocations, 1);
+	chunk->size = size;
+	chunk->num_cells = n;
+	chunk->next = l->chunks;
+	l->chunks = chunk;
+
+	uintptr_t start = (uintptr_t)(chunk + 1);
+	start = (start + CACHE_LINE_SIZE - 1) &
+		~(uintptr_t)(CACHE_LINE_SIZE - 1);
+	struct cell *cells = (struct cell *)start;
+
+	// Link the new cells into the free list so that they are
+	// handed out in address order.
+	for (size_t i = n; i > 0; i--) {
+		cells[i - 1].next = l->free_cells;
+		l->free_cells = &cells[i - 1];
+	}
+	l->num_free_cells += n;
+}
+
+/**
+ * cell_alloc() - Get an unused cell from the pool.
+ * @l: List to manipulate.
+ *
+ * Allocates a new chunk if the free list is empty. Each chunk is
+ * twice as large as the previous one, up to MAX_CHUNK_CELLS.
+ *
+ * Returns: Pointer to an unused cell.
+ */
+static struct cell *cell_alloc(list *l)
+{
+	if (l->free_cells == NULL) {
+		size_t n = FIRST_CHUNK_CELLS;
+		if (l->chunks != NULL) {
+			n = 2 * l->chunks->num_cells;
+			if (n > MAX_CHUNK_CELLS) {
+				n = MAX_CHUNK_CELLS;
+			}
+		}
+		add_chunk(l, n);
+	}
+	struct cell *c = l->free_cells;
+	l->free_cells = c->next;
+	l->num_free_cells--;
+	return c;
+}
+
+/**
+ * cell_release() - Return a cell to the pool.
+ * @l: List to manipulate.
+ * @c: Cell to release. Must not be linked into the list.
+ *
+ * Returns: Nothing.
+ */
+static void cell_release(list *l, struct cell *c)
+{
+	c->next = l->free_cells;
+	l->free_cells = c;
+	l->num_free_cells++;
+}
+
 /*
  * Data structure interface
  */
@@ -54,12 +165,32 @@ struct list {
  */
 list *list_empty(free_function free_func)
 {
+	return list_empty_with_allocator(free_func, NULL);
+}
+
+/**
+ * list_empty_with_allocator() - Create an empty list using an allocator.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the list. NULL selects malloc()/free().
+ *
+ * Returns: A pointer to the new list.
+ */
+list *list_empty_with_allocator(free_function free_func,
+				const allocator *alloc)
+{
+	allocator a = use_allocator(alloc);
+
 	// Allocate memory for the list head.
-	list *l = calloc(1, sizeof(list));
+	list *l = mem_alloc(&a, sizeof(list));
+	l->alloc = a;
 
 	// Allocate memory for the border cells.
-	l->head = calloc(1, sizeof(struct cell));
-	l->tail = calloc(1, sizeof(struct cell));
+	l->head = mem_alloc(&l->alloc, sizeof(struct cell));
+	l->tail = mem_alloc(&l->alloc, sizeof(struct cell));
+	// The list head and the two border cells.
+	STATS_COUNT(l, allocations, 3);
 
 	// Set consistent links between border elements.
 	l->head->next = l->tail;
@@ -71,6 +202,25 @@ list *list_empty(free_function free_func)
 	return l;
 }
 
+/**
+ * list_reserve() - Make room for more elements in a list.
+ * @l: List to manipulate.
+ * @n: Number of elements.
+ *
+ * Pre-allocates cells so that the next n inserts into the list, with
+ * no removes in between, do not allocate any memory. Removed cells are
+ * always reused, so a list that never holds more than n elements
+ * after list_reserve(l, n) never allocates again.
+ *
+ * Returns: Nothing.
+ */
+void list_reserve(list *l, size_t n)
+{
+	if (l->num_free_cells < n) {
+		add_chunk(l, n - l->num_free_cells);
+	}
+}
+
 /**
  * list_is_empty() - Check if a list is empty.
  * @l: List to check.
@@ -124,6 +274,7 @@ list_pos list_next(const list * l, const list_pos p)
 		fprintf(stderr,"list_next: Warning: Trying to navigate "
 			"past end of list!");
 	}
+	STATS_COUNT(l, traversals, 1);
 	return p->next;
 }
 
@@ -142,6 +293,7 @@ list_pos list_previous(const list * l, const list_pos p)
 		fprintf(stderr,"list_previous: Warning: Trying to navigate "
 			"past beginning of list!\n");
 	}
+	STATS_COUNT(l, traversals, 1);
 	return p->previous;
 }
 
@@ -161,6 +313,7 @@ void *list_inspect(const list * l, const list_pos p)
 		fprintf(stderr,"list_inspect: Warning: Trying to inspect "
 			"position at end of list!\n");
 	}
+	STATS_COUNT(l, ops, 1);
 	return p->value;
 }
 
@@ -177,8 +330,8 @@ void *list_inspect(const list * l, const list_pos p)
  */
 list_pos list_insert(list * l, void *v, const list_pos p)
 {
-	// Allocate memory for a new cell.
-	list_pos elem = malloc(sizeof(struct cell));
+	// Get a new cell from the pool.
+	list_pos elem = cell_alloc(l);
 
 	// Store the value.
 	elem->value = v;
@@ -188,6 +341,8 @@ list_pos list_insert(list * l, void *v, const list_pos p)
 	p->previous = elem;
 	elem->previous->next = elem;
 
+	STATS_COUNT(l, ops, 1);
+	STATS_ADD_SIZE(l, 1);
 	// Return the position of the new cell.
 	return elem;
 }
@@ -216,8 +371,10 @@ list_pos list_remove(list *l, const list_pos p)
 		// Free any user-allocated memory for the value.
 		l->free_func(p->value);
 	}
-	// Free the memory allocated to the cell itself.
-	free(p);
+	// Return the cell itself to the pool.
+	cell_release(l, p);
+	STATS_COUNT(l, ops, 1);
+	STATS_SUB_SIZE(l, 1);
 	// Return the position of the next element.
 	return next_pos;
 }
@@ -245,10 +402,17 @@ void list_kill(list * l)
 		p = list_remove(l, p);
 	}
 
+	// Free all cell chunks.
+	struct cell_chunk *chunk = l->chunks;
+	while (chunk != NULL) {
+		struct cell_chunk *next = chunk->next;
+		mem_free(&l->alloc, chunk, chunk->size);
+		chunk = next;
+	}
 	// Free border elements and the list head.
-	free(l->head);
-	free(l->tail);
-	free(l);
+	mem_free(&l->alloc, l->head, sizeof(struct cell));
+	mem_free(&l->alloc, l->tail, sizeof(struct cell));
+	mem_free(&l->alloc, l, sizeof(list));
 }
 
 /**
@@ -281,6 +445,56 @@ void list_print(const list * l, inspect_callback print_func)
 	printf(" )\n");
 }
 
+/**
+ * list_stats() - Return the operation statistics of a list.
+ * @l: List to inspect.
+ *
+ * Returns: The statistics since the list was created or last reset.
+ *	    All fields are 0 unless compiled with DOA_STATS defined.
+ */
+op_stats list_stats(const list *l)
+{
+	return STATS_GET(l);
+}
+
+/**
+ * list_stats_reset() - Reset the operation statistics of a list.
+ * @l: List to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void list_stats_reset(list *l)
+{
+	STATS_RESET(l);
+}
+
+/**
+ * list_memory_usage() - Return the memory used by a list.
+ * @l: List to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage list_memory_usage(const list *l)
+{
+	mem_usage m;
+	size_t num_cells = 0;
+
+	// The list, its border cells and the chunk headers, including
+	// the room left to align the cells.
+	m.header = sizeof(*l) + 2 * sizeof(struct cell);
+	for (struct cell_chunk *chunk = l->chunks; chunk != NULL;
+	     chunk = chunk->next) {
+		m.header += chunk->size - chunk->num_cells * sizeof(struct cell);
+		num_cells += chunk->num_cells;
+	}
+	m.elements = (num_cells - l->num_free_cells) * sizeof(struct cell);
+	m.slack = l->num_free_cells * sizeof(struct cell);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
+
 /**
  * list_pos_is_equal() - Return true if two positions in a list are equal.
  * @l: List to inspect.
@@ -0,0 +1,121 @@
+#include <stdlib.h>
+#include <stdio.h>
+
+#include <list.h>
+
+/*
+ * Minimum working example for list.c. Creates a list that gets all
+ * its internal memory from a user-supplied allocator. The allocator
+ * counts the number of allocations and the number of bytes in use,
+ * and forwards the calls to malloc()/free().
+ *
+ * The list recycles removed cells. After list_reserve(), a list that
+ * stays within the reserved size makes no calls to the allocator.
+ *
+ * Version information:
+ *   v1.0  2026-10-16: First public version.
+ *   v1.1  2026-10-16: Added list_reserve and a queue-like loop.
+ */
+
+#define VERSION "v1.1"
+#define VERSION_DATE "2026-10-16"
+
+// Book-keeping for the counting allocator.
+struct counter {
+	size_t allocs; // Number of calls to alloc.
+	size_t frees; // Number of calls to free.
+	size_t bytes_in_use; // Number of bytes currently allocated.
+};
+
+// Allocate size bytes and update the counter in context.
+static void *counting_alloc(void *context, size_t size)
+{
+	struct counter *c = context;
+	c->allocs++;
+	c->bytes_in_use += size;
+	return malloc(size);
+}
+
+// Free the memory at ptr and update the counter in context.
+static void counting_free(void *context, void *ptr, size_t size)
+{
+	struct counter *c = context;
+	c->frees++;
+	c->bytes_in_use -= size;
+	free(ptr);
+}
+
+// Print the current counter values.
+static void print_counter(const struct counter *c)
+{
+	printf("allocs: %zu, frees: %zu, bytes in use: %zu\n",
+	       c->allocs, c->frees, c->bytes_in_use);
+}
+
+// Integers are stored via int pointers stored as void pointers.
+// Convert the given pointer and print the dereferenced value.
+static void print_ints(const void *data)
+{
+	const int *v = data;
+	printf("[%d]", *v);
+}
+
+int main(void)
+{
+	printf("%s, %s %s: Create integer list with a counting allocator.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	struct counter c = { 0, 0, 0 };
+	// The list makes a copy of the allocator, so it may live on
+	// the stack. No realloc function is needed.
+	allocator alloc = { counting_alloc, NULL, counting_free, &c };
+
+	// Create the list. The values are stored on the stack, so the
+	// list should not free them.
+	list *l = list_empty_with_allocator(NULL, &alloc);
+
+	printf("Allocator after creating the list:\n");
+	print_counter(&c);
+
+	// Make room for three elements.
+	list_reserve(l, 3);
+
+	printf("Allocator after reserving three elements:\n");
+	print_counter(&c);
+
+	int values[] = { 5, 8, 2 };
+	for (int i = 0; i < 3; i++) {
+		list_insert(l, &values[i], list_end(l));
+	}
+
+	printf("List after inserting three values:\n");
+	list_print(l, print_ints);
+	printf("Allocator after inserting three values:\n");
+	print_counter(&c);
+
+	// Remove first element.
+	list_remove(l, list_first(l));
+
+	printf("Allocator after removing one value:\n");
+	print_counter(&c);
+
+	// Use the list as a queue: insert last, remove first. The
+	// removed cells are reused, so no memory is allocated.
+	for (int i = 0; i < 1000; i++) {
+		list_insert(l, &values[i % 3], list_end(l));
+		list_remove(l, list_first(l));
+	}
+
+	printf("Allocator after 1000 insert/remove pairs:\n");
+	print_counter(&c);
+
+	// Done, kill the list. All memory is returned to the allocator.
+	list_kill(l);
+
+	printf("Allocator after killing the list:\n");
+	print_counter(&c);
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
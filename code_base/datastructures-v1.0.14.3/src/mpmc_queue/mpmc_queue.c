@@ -0,0 +1,382 @@
+// Needed for clock_gettime() and pthread_condattr_setclock() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <pthread.h>
+
+#include <mpmc_queue.h>
+
+/*
+ * Implementation of a generic, bounded multi-producer/multi-consumer
+ * queue for the "Datastructures and algorithms" courses at the
+ * Department of Computing Science, Umea University.
+ *
+ * The lock-free part follows Dmitry Vyukov's bounded MPMC queue. The
+ * values are stored in a circular array of cells whose size is a
+ * power of two. Each cell has a sequence number that tells which
+ * position in the queue the cell is ready for:
+ *
+ *   seq == pos:		the cell is free for the enqueue at pos.
+ *   seq == pos + 1:		the cell holds the value at pos.
+ *   seq == pos + capacity:	the value was dequeued, the cell is free
+ *				for the enqueue one lap later.
+ *
+ * A thread claims a position with a compare-and-swap on the shared
+ * enqueue (dequeue) counter and then publishes the cell with a release
+ * store of its sequence number. The two counters are kept on separate
+ * cache lines.
+ *
+ * Blocking dequeue uses a mutex and a condition variable. A consumer
+ * that finds the queue empty registers itself as a waiter while
+ * holding the mutex, retries, and then sleeps. Producers only take the
+ * mutex when there is a waiter, so the fast path stays lock-free.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-17: Added mpmc_queue_memory_usage.
+ */
+
+// Size of a cache line in bytes.
+#define CACHE_LINE_SIZE 64
+
+// Number of failed tries before a consumer goes to sleep.
+#define SPIN_TRIES 64
+
+// ===========INTERNAL DATA TYPES============
+
+struct cell {
+	atomic_size_t seq;
+	void *value;
+};
+
+struct mpmc_queue {
+	// Read-only after creation.
+	struct cell *cells;
+	size_t mask; // Capacity - 1.
+	free_function free_func;
+	char pad0[CACHE_LINE_SIZE];
+
+	atomic_size_t enqueue_pos; // Next position to enqueue.
+	char pad1[CACHE_LINE_SIZE];
+
+	atomic_size_t dequeue_pos; // Next position to dequeue.
+	char pad2[CACHE_LINE_SIZE];
+
+	// Used by mpmc_queue_dequeue_timed().
+	atomic_int waiters; // Number of sleeping consumers.
+	pthread_mutex_t lock;
+	pthread_cond_t nonempty;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * wake_waiter() - Wake up one sleeping consumer, if any.
+ * @q: Queue to manipulate.
+ *
+ * Returns: Nothing.
+ */
+static void wake_waiter(mpmc_queue *q)
+{
+	// Order the publication of the new value before the load of
+	// waiters. Pairs with the fence in mpmc_queue_dequeue_timed().
+	atomic_thread_fence(memory_order_seq_cst);
+	if (atomic_load_explicit(&q->waiters, memory_order_relaxed) > 0) {
+		pthread_mutex_lock(&q->lock);
+		pthread_cond_signal(&q->nonempty);
+		pthread_mutex_unlock(&q->lock);
+	}
+}
+
+/**
+ * deadline() - Compute an absolute time a number of milliseconds ahead.
+ * @timeout_ms: Number of milliseconds.
+ *
+ * Returns: The current CLOCK_MONOTONIC time plus timeout_ms.
+ */
+static struct timespec deadline(long timeout_ms)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	ts.tv_sec += timeout_ms / 1000;
+	ts.tv_nsec += (timeout_ms % 1000) * 1000000;
+	if (ts.tv_nsec >= 1000000000) {
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000;
+	}
+	return ts;
+}
+
+/**
+ * mpmc_queue_empty() - Create an empty queue.
+ * @capacity: Minimum number of values the queue can hold. Rounded up
+ *	      to a power of two, at least 2.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on kill.
+ *
+ * Returns: A pointer to the new queue, or NULL if not enough memory
+ * was available.
+ */
+mpmc_queue *mpmc_queue_empty(size_t capacity, free_function free_func)
+{
+	// Round the capacity up to a power of two. The sequence numbers
+	// need at least two cells to tell a full cell from a free one.
+	size_t n = 2;
+	while (n < capacity) {
+		n *= 2;
+	}
+
+	mpmc_queue *q = calloc(1, sizeof(*q));
+	if (q == NULL) {
+		return NULL;
+	}
+	q->cells = calloc(n, sizeof(*q->cells));
+	if (q->cells == NULL) {
+		free(q);
+		return NULL;
+	}
+	// Each cell is ready for the enqueue at its own index.
+	for (size_t i = 0; i < n; i++) {
+		atomic_init(&q->cells[i].seq, i);
+	}
+	q->mask = n - 1;
+	q->free_func = free_func;
+	atomic_init(&q->enqueue_pos, 0);
+	atomic_init(&q->dequeue_pos, 0);
+
+	atomic_init(&q->waiters, 0);
+	pthread_mutex_init(&q->lock, NULL);
+	// Wait with the monotonic clock, so that timeouts are not
+	// affected if the wall clock is changed.
+	pthread_condattr_t attr;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&q->nonempty, &attr);
+	pthread_condattr_destroy(&attr);
+
+	return q;
+}
+
+/**
+ * mpmc_queue_capacity() - Return the maximum number of values in a queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The number of values the queue can hold.
+ */
+size_t mpmc_queue_capacity(const mpmc_queue *q)
+{
+	return q->mask + 1;
+}
+
+/**
+ * mpmc_queue_memory_usage() - Return the memory used by a queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage mpmc_queue_memory_usage(const mpmc_queue *q)
+{
+	// Read dequeue_pos first, so that the difference is never
+	// negative. The result is a snapshot if the queue is in use.
+	size_t dequeue_pos =
+		atomic_load_explicit(&((mpmc_queue *)q)->dequeue_pos,
+				     memory_order_acquire);
+	size_t enqueue_pos =
+		atomic_load_explicit(&((mpmc_queue *)q)->enqueue_pos,
+				     memory_order_acquire);
+	size_t capacity = q->mask + 1;
+	size_t size = enqueue_pos - dequeue_pos;
+	if (size > capacity) {
+		size = capacity;
+	}
+	mem_usage m;
+	m.header = sizeof(*q);
+	m.elements = size * sizeof(struct cell);
+	m.slack = (capacity - size) * sizeof(struct cell);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
+
+/**
+ * mpmc_queue_try_enqueue() - Put a value at the end of the queue.
+ * @q: Queue to manipulate.
+ * @v: Value (pointer) to be put in the queue.
+ *
+ * Wakes up one consumer waiting in mpmc_queue_dequeue_timed(), if any.
+ *
+ * Returns: True if the value was put in the queue, false if the queue
+ * was full.
+ */
+bool mpmc_queue_try_enqueue(mpmc_queue *q, void *v)
+{
+	size_t pos = atomic_load_explicit(&q->enqueue_pos,
+					  memory_order_relaxed);
+	struct cell *c;
+
+	while (true) {
+		c = &q->cells[pos & q->mask];
+		size_t seq = atomic_load_explicit(&c->seq,
+						  memory_order_acquire);
+		intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+		if (dif == 0) {
+			// The cell is free. Try to claim the position.
+			if (atomic_compare_exchange_weak_explicit(
+				    &q->enqueue_pos, &pos, pos + 1,
+				    memory_order_relaxed,
+				    memory_order_relaxed)) {
+				break;
+			}
+			// Another producer got it. pos was updated by
+			// the failed compare-and-swap.
+		} else if (dif < 0) {
+			// The cell still holds the value from the
+			// previous lap. The queue is full.
+			return false;
+		} else {
+			// Another producer claimed pos. Start over.
+			pos = atomic_load_explicit(&q->enqueue_pos,
+						   memory_order_relaxed);
+		}
+	}
+	c->value = v;
+	// Publish the value to the consumers.
+	atomic_store_explicit(&c->seq, pos + 1, memory_order_release);
+
+	wake_waiter(q);
+	return true;
+}
+
+/**
+ * mpmc_queue_try_dequeue() - Remove the value at the front of the queue.
+ * @q: Queue to manipulate.
+ * @v: Pointer to where the removed value is stored.
+ *
+ * The free_func is not called for the removed value, it is handed
+ * over to the caller.
+ *
+ * Returns: True if a value was removed, false if the queue was empty.
+ */
+bool mpmc_queue_try_dequeue(mpmc_queue *q, void **v)
+{
+	size_t pos = atomic_load_explicit(&q->dequeue_pos,
+					  memory_order_relaxed);
+	struct cell *c;
+
+	while (true) {
+		c = &q->cells[pos & q->mask];
+		size_t seq = atomic_load_explicit(&c->seq,
+						  memory_order_acquire);
+		intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+		if (dif == 0) {
+			// The cell holds a value. Try to claim it.
+			if (atomic_compare_exchange_weak_explicit(
+				    &q->dequeue_pos, &pos, pos + 1,
+				    memory_order_relaxed,
+				    memory_order_relaxed)) {
+				break;
+			}
+		} else if (dif < 0) {
+			// The value at pos is not published yet. The
+			// queue is empty.
+			return false;
+		} else {
+			// Another consumer claimed pos. Start over.
+			pos = atomic_load_explicit(&q->dequeue_pos,
+						   memory_order_relaxed);
+		}
+	}
+	*v = c->value;
+	// Make the cell ready for the enqueue one lap later.
+	atomic_store_explicit(&c->seq, pos + q->mask + 1,
+			      memory_order_release);
+	return true;
+}
+
+/**
+ * mpmc_queue_dequeue_timed() - Remove a value, waiting if necessary.
+ * @q: Queue to manipulate.
+ * @v: Pointer to where the removed value is stored.
+ * @timeout_ms: Maximum number of milliseconds to wait for a value.
+ *		A negative value waits for ever.
+ *
+ * If the queue is empty, sleeps until a value is enqueued or the
+ * timeout expires.
+ *
+ * Returns: True if a value was removed, false on timeout.
+ */
+bool mpmc_queue_dequeue_timed(mpmc_queue *q, void **v, long timeout_ms)
+{
+	// Fast path. A value often arrives within a few tries.
+	for (int i = 0; i < SPIN_TRIES; i++) {
+		if (mpmc_queue_try_dequeue(q, v)) {
+			return true;
+		}
+	}
+	if (timeout_ms == 0) {
+		return false;
+	}
+
+	struct timespec until = deadline(timeout_ms);
+	bool found = false;
+
+	pthread_mutex_lock(&q->lock);
+	atomic_fetch_add_explicit(&q->waiters, 1, memory_order_relaxed);
+	// Order the registration before the retry below. Pairs with the
+	// fence in wake_waiter(). Either the producer sees the waiter,
+	// or the retry sees the value.
+	atomic_thread_fence(memory_order_seq_cst);
+	while (true) {
+		found = mpmc_queue_try_dequeue(q, v);
+		if (found) {
+			break;
+		}
+		// The mutex is held from the retry until the wait, so a
+		// signal from a producer cannot be lost in between.
+		int err;
+		if (timeout_ms < 0) {
+			err = pthread_cond_wait(&q->nonempty, &q->lock);
+		} else {
+			err = pthread_cond_timedwait(&q->nonempty, &q->lock,
+						     &until);
+		}
+		if (err != 0) {
+			// Timeout. Make one last try.
+			found = mpmc_queue_try_dequeue(q, v);
+			break;
+		}
+	}
+	atomic_fetch_sub_explicit(&q->waiters, 1, memory_order_relaxed);
+	pthread_mutex_unlock(&q->lock);
+
+	return found;
+}
+
+/**
+ * mpmc_queue_kill() - Destroy a given queue.
+ * @q: Queue to destroy.
+ *
+ * Return all dynamic memory used by the queue. If a free_func was
+ * registered at queue creation, also calls it for each value left in
+ * the queue.
+ *
+ * Returns: Nothing.
+ */
+void mpmc_queue_kill(mpmc_queue *q)
+{
+	if (q->free_func != NULL) {
+		size_t pos = atomic_load(&q->dequeue_pos);
+		size_t end = atomic_load(&q->enqueue_pos);
+		for (; pos != end; pos++) {
+			q->free_func(q->cells[pos & q->mask].value);
+		}
+	}
+	pthread_cond_destroy(&q->nonempty);
+	pthread_mutex_destroy(&q->lock);
+	free(q->cells);
+	free(q);
+}
@@ -0,0 +1,141 @@
+// Needed for clock_gettime() and sched_yield() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include <mpmc_queue.h>
+
+/*
+ * Scaling benchmark for mpmc_queue.c. For 1, 2, 4, ... up to N
+ * threads, each thread repeatedly enqueues a value and dequeues a
+ * value from one shared queue. The total number of operations per
+ * second is reported for each number of threads, together with the
+ * speedup relative to one thread.
+ *
+ * Usage: mpmc_queue_bench [max number of threads] [pairs per thread]
+ *
+ * The default number of threads is twice the number of online CPUs.
+ *
+ * Compile with -O2 -pthread.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-16"
+
+// Default number of enqueue/dequeue pairs per thread.
+#define DEFAULT_PAIRS 1000000
+
+// Capacity of the queue. Must be at least the number of threads.
+#define CAPACITY 1024
+
+// Parameters shared by all threads.
+struct bench {
+	mpmc_queue *q;
+	long pairs; // Number of enqueue/dequeue pairs per thread.
+};
+
+// Return the current time in seconds.
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Worker thread. Each thread has at most one value in the queue, so
+// the queue is never full and a dequeue only fails while another
+// thread is halfway through an enqueue.
+static void *worker(void *arg)
+{
+	struct bench *b = arg;
+	void *v;
+
+	for (long i = 0; i < b->pairs; i++) {
+		while (!mpmc_queue_try_enqueue(b->q, b)) {
+			sched_yield();
+		}
+		while (!mpmc_queue_try_dequeue(b->q, &v)) {
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+// Run the benchmark with a given number of threads. Returns the
+// number of operations per second.
+static double run(int threads, long pairs)
+{
+	struct bench b;
+	pthread_t *tid = calloc(threads, sizeof(*tid));
+
+	b.q = mpmc_queue_empty(CAPACITY, NULL);
+	b.pairs = pairs;
+
+	double start = now();
+	for (int i = 0; i < threads; i++) {
+		pthread_create(&tid[i], NULL, worker, &b);
+	}
+	for (int i = 0; i < threads; i++) {
+		pthread_join(tid[i], NULL);
+	}
+	double elapsed = now() - start;
+
+	mpmc_queue_kill(b.q);
+	free(tid);
+
+	// Each pair is two operations.
+	return 2.0 * pairs * threads / elapsed;
+}
+
+int main(int argc, char *argv[])
+{
+	printf("%s, %s %s: MPMC queue scaling.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	int max_threads = cpus > 0 ? 2 * cpus : 2;
+	long pairs = DEFAULT_PAIRS;
+	if (argc > 1) {
+		max_threads = atoi(argv[1]);
+	}
+	if (argc > 2) {
+		pairs = atol(argv[2]);
+	}
+	if (max_threads < 1 || max_threads > CAPACITY) {
+		fprintf(stderr, "Number of threads must be 1..%d.\n",
+			CAPACITY);
+		return EXIT_FAILURE;
+	}
+	printf("%ld online CPUs, %ld enqueue/dequeue pairs per thread.\n\n",
+	       cpus, pairs);
+	printf("%8s %16s %8s\n", "threads", "ops/s", "speedup");
+
+	// Double the number of threads for each run, and end with
+	// max_threads even if it is not a power of two.
+	double base = 0;
+	for (int threads = 1; ; threads *= 2) {
+		if (threads > max_threads) {
+			threads = max_threads;
+		}
+		double ops = run(threads, pairs);
+		if (threads == 1) {
+			base = ops;
+		}
+		printf("%8d %16.0f %8.2f\n", threads, ops, ops / base);
+		if (threads == max_threads) {
+			break;
+		}
+	}
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include <mpmc_queue.h>
+
+/*
+ * Minimum working example for mpmc_queue.c. The main thread puts the
+ * integers 1 to N into a work queue shared by a pool of worker
+ * threads. Each worker sums the squares of the integers it gets. The
+ * workers sleep in mpmc_queue_dequeue_timed() while the queue is
+ * empty. The value 0 tells a worker to stop.
+ *
+ * Compile with -pthread.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-16"
+
+// Number of integers to process.
+#define N 1000
+
+// Number of worker threads.
+#define WORKERS 3
+
+// Work queue shared by all threads.
+static mpmc_queue *q;
+
+// Worker thread. Returns the sum of squares in a heap-allocated long.
+static void *worker(void *arg)
+{
+	long *sum = calloc(1, sizeof(*sum));
+
+	while (true) {
+		void *v;
+		// Wait for at most one second for more work.
+		if (!mpmc_queue_dequeue_timed(q, &v, 1000)) {
+			continue;
+		}
+		intptr_t i = (intptr_t)v;
+		if (i == 0) {
+			// Stop value.
+			break;
+		}
+		*sum += i * i;
+	}
+	return sum;
+}
+
+int main(void)
+{
+	printf("%s, %s %s: Sum squares with a pool of %d workers.\n",
+	       __FILE__, VERSION, VERSION_DATE, WORKERS);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	// Create a queue for 64 values. The values are integers stored
+	// as pointers, so no free function is needed.
+	q = mpmc_queue_empty(64, NULL);
+
+	pthread_t threads[WORKERS];
+	for (int w = 0; w < WORKERS; w++) {
+		pthread_create(&threads[w], NULL, worker, NULL);
+	}
+
+	// Put the work in the queue, followed by one stop value per
+	// worker. Retry while the queue is full.
+	for (intptr_t i = 1; i <= N + WORKERS; i++) {
+		void *v = (void *)(i <= N ? i : 0);
+		while (!mpmc_queue_try_enqueue(q, v)) {
+			// Queue full. Try again.
+		}
+	}
+
+	// Collect the partial sums.
+	long total = 0;
+	for (int w = 0; w < WORKERS; w++) {
+		long *sum;
+		pthread_join(threads[w], (void **)&sum);
+		total += *sum;
+		free(sum);
+	}
+
+	printf("Sum of squares 1..%d: %ld (expected %ld).\n", N, total,
+	       (long)N * (N + 1) * (2 * N + 1) / 6);
+
+	mpmc_queue_kill(q);
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
@@ -0,0 +1,238 @@
+// Needed for clock_gettime() and sched_yield() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <mpmc_queue.h>
+
+/*
+ * Stress test for mpmc_queue.c. Several producer threads enqueue
+ * unique values into a small queue while several consumer threads
+ * dequeue them, some with mpmc_queue_try_dequeue() and some with
+ * mpmc_queue_dequeue_timed(). The test checks that every value is
+ * received exactly once, that the values from each producer arrive
+ * in order at each consumer, and that the timeouts work.
+ *
+ * Compile with -pthread. Preferably also run with -fsanitize=thread.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-16"
+
+// Number of producer and consumer threads.
+#define PRODUCERS 4
+#define CONSUMERS 4
+
+// Number of values per producer.
+#define ITEMS_PER_PRODUCER 200000
+
+// Total number of values.
+#define ITEMS (PRODUCERS * ITEMS_PER_PRODUCER)
+
+// Capacity of the queue. Small, to make the queue full often.
+#define CAPACITY 16
+
+// Shared test state.
+static mpmc_queue *q;
+// Number of times each value has been received.
+static atomic_int received[ITEMS];
+// Number of values received by all consumers.
+static atomic_long total_received;
+
+// Return the current time in milliseconds.
+static double now_ms(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1e3 + ts.tv_nsec * 1e-6;
+}
+
+// Print an error message and exit.
+static void fail(const char *msg)
+{
+	fprintf(stderr, "FAIL: %s\n", msg);
+	exit(EXIT_FAILURE);
+}
+
+// Producer thread. Value i of producer p is p * ITEMS_PER_PRODUCER + i,
+// stored as a pointer.
+static void *producer(void *arg)
+{
+	intptr_t p = (intptr_t)arg;
+
+	for (intptr_t i = 0; i < ITEMS_PER_PRODUCER; i++) {
+		void *v = (void *)(p * ITEMS_PER_PRODUCER + i);
+		while (!mpmc_queue_try_enqueue(q, v)) {
+			// Queue full. Let the consumers run.
+			sched_yield();
+		}
+	}
+	return NULL;
+}
+
+// Consumer thread. Even-numbered consumers use the timed dequeue.
+static void *consumer(void *arg)
+{
+	intptr_t c = (intptr_t)arg;
+	// Last value seen from each producer.
+	intptr_t last[PRODUCERS];
+
+	for (int p = 0; p < PRODUCERS; p++) {
+		last[p] = -1;
+	}
+	while (atomic_load(&total_received) < ITEMS) {
+		void *v;
+		bool found;
+		if (c % 2 == 0) {
+			found = mpmc_queue_dequeue_timed(q, &v, 10);
+		} else {
+			found = mpmc_queue_try_dequeue(q, &v);
+		}
+		if (!found) {
+			sched_yield();
+			continue;
+		}
+		intptr_t value = (intptr_t)v;
+		if (value < 0 || value >= ITEMS) {
+			fail("Received a value that was never enqueued.");
+		}
+		int p = value / ITEMS_PER_PRODUCER;
+		if (value <= last[p]) {
+			fail("Values from one producer arrived out of order.");
+		}
+		last[p] = value;
+		atomic_fetch_add(&received[value], 1);
+		atomic_fetch_add(&total_received, 1);
+	}
+	return NULL;
+}
+
+// Check that a timed dequeue on an empty queue times out.
+static void test_timeout(void)
+{
+	void *v;
+
+	printf("Starting test_timeout()...");
+	double start = now_ms();
+	if (mpmc_queue_dequeue_timed(q, &v, 50)) {
+		fail("Timed dequeue on an empty queue returned a value.");
+	}
+	double elapsed = now_ms() - start;
+	if (elapsed < 45) {
+		fail("Timed dequeue returned before the timeout.");
+	}
+	if (mpmc_queue_dequeue_timed(q, &v, 0)) {
+		fail("Dequeue with zero timeout returned a value.");
+	}
+	printf("done (waited %.1f ms).\n", elapsed);
+}
+
+// Check that a sleeping consumer is woken up by an enqueue.
+static void *delayed_producer(void *arg)
+{
+	struct timespec ts = { 0, 20000000 };
+	nanosleep(&ts, NULL);
+	mpmc_queue_try_enqueue(q, arg);
+	return NULL;
+}
+
+static void test_wakeup(void)
+{
+	pthread_t thread;
+	void *v;
+	int value = 17;
+
+	printf("Starting test_wakeup()...");
+	pthread_create(&thread, NULL, delayed_producer, &value);
+	if (!mpmc_queue_dequeue_timed(q, &v, -1) || v != &value) {
+		fail("Sleeping consumer did not get the value.");
+	}
+	pthread_join(thread, NULL);
+	printf("done.\n");
+}
+
+// Check that values are stored in FIFO order and that a full queue
+// rejects values.
+static void test_full(void)
+{
+	void *v;
+
+	printf("Starting test_full()...");
+	for (intptr_t i = 0; i < CAPACITY; i++) {
+		if (!mpmc_queue_try_enqueue(q, (void *)i)) {
+			fail("Enqueue failed before the queue was full.");
+		}
+	}
+	if (mpmc_queue_try_enqueue(q, NULL)) {
+		fail("Enqueue succeeded on a full queue.");
+	}
+	for (intptr_t i = 0; i < CAPACITY; i++) {
+		if (!mpmc_queue_try_dequeue(q, &v) || v != (void *)i) {
+			fail("Values were not dequeued in FIFO order.");
+		}
+	}
+	if (mpmc_queue_try_dequeue(q, &v)) {
+		fail("Dequeue succeeded on an empty queue.");
+	}
+	printf("done.\n");
+}
+
+// Run producers and consumers concurrently.
+static void test_stress(void)
+{
+	pthread_t producers[PRODUCERS];
+	pthread_t consumers[CONSUMERS];
+
+	printf("Starting test_stress() with %d producers, %d consumers, "
+	       "%d values...", PRODUCERS, CONSUMERS, ITEMS);
+	fflush(stdout);
+	for (intptr_t c = 0; c < CONSUMERS; c++) {
+		pthread_create(&consumers[c], NULL, consumer, (void *)c);
+	}
+	for (intptr_t p = 0; p < PRODUCERS; p++) {
+		pthread_create(&producers[p], NULL, producer, (void *)p);
+	}
+	for (int p = 0; p < PRODUCERS; p++) {
+		pthread_join(producers[p], NULL);
+	}
+	for (int c = 0; c < CONSUMERS; c++) {
+		pthread_join(consumers[c], NULL);
+	}
+	for (int i = 0; i < ITEMS; i++) {
+		if (atomic_load(&received[i]) != 1) {
+			fail("A value was not received exactly once.");
+		}
+	}
+	printf("done.\n");
+}
+
+int main(void)
+{
+	printf("%s, %s %s: Stress test of mpmc_queue.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	q = mpmc_queue_empty(CAPACITY, NULL);
+	if (mpmc_queue_capacity(q) != CAPACITY) {
+		fail("Wrong capacity.");
+	}
+
+	test_full();
+	test_timeout();
+	test_wakeup();
+	test_stress();
+
+	mpmc_queue_kill(q);
+
+	printf("\nSUCCESS: Implementation passed all tests. Normal exit.\n\n");
+	return 0;
+}
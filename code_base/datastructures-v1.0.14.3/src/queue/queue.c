@@ -17,6 +17,10 @@
  * Version information:
  *   v1.0  2018-01-28: First public version.
  *   v1.01 2024-01-16: Fix include to be with brackets, not citation marks.
+ *   v1.1  2026-10-16: Added queue_empty_with_allocator.
+ *   v1.2  2026-10-17: Added queue_stats and queue_stats_reset.
+ *   v1.3  2026-10-17: Added queue_memory_usage.
+ *   v1.4  2026-10-17: Use the allocator helpers in util.h.
  */
 
 // ===========INTERNAL DATA TYPES============
@@ -28,6 +32,10 @@
 
 struct queue {
 	list *elements;
+	allocator alloc;
+#ifdef DOA_STATS
+	op_stats stats;
+#endif
 };
 
 // ===========INTERNAL FUNCTION IMPLEMENTATIONS============
@@ -41,10 +49,29 @@ struct queue {
  */
 queue *queue_empty(free_function free_func)
 {
+	return queue_empty_with_allocator(free_func, NULL);
+}
+
+/**
+ * queue_empty_with_allocator() - Create an empty queue using an allocator.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the queue. NULL selects malloc()/free().
+ *
+ * Returns: A pointer to the new queue.
+ */
+queue *queue_empty_with_allocator(free_function free_func,
+				  const allocator *alloc)
+{
+	allocator a = use_allocator(alloc);
+
 	// Allocate the queue head.
-	queue *q=calloc(1, sizeof(*q));
-	// Create an empty list.
-	q->elements=list_empty(free_func);
+	queue *q=mem_alloc(&a, sizeof(*q));
+	STATS_COUNT(q, allocations, 1);
+	q->alloc=a;
+	// Create an empty list using the same allocator.
+	q->elements=list_empty_with_allocator(free_func, &q->alloc);
 
 	return q;
 }
@@ -70,6 +97,8 @@ bool queue_is_empty(const queue *q)
 queue *queue_enqueue(queue *q, void *v)
 {
 	list_insert(q->elements, v, list_end(q->elements));
+	STATS_COUNT(q, ops, 1);
+	STATS_ADD_SIZE(q, 1);
 	return q;
 }
 
@@ -84,6 +113,8 @@ queue *queue_enqueue(queue *q, void *v)
 queue *queue_dequeue(queue *q)
 {
 	list_remove(q->elements, list_first(q->elements));
+	STATS_COUNT(q, ops, 1);
+	STATS_SUB_SIZE(q, 1);
 	return q;
 }
 
@@ -96,6 +127,7 @@ queue *queue_dequeue(queue *q)
  */
 void *queue_front(const queue *q)
 {
+	STATS_COUNT(q, ops, 1);
 	return list_inspect(q->elements, list_first(q->elements));
 }
 
@@ -112,7 +144,7 @@ void *queue_front(const queue *q)
 void queue_kill(queue *q)
 {
 	list_kill(q->elements);
-	free(q);
+	mem_free(&q->alloc, q, sizeof(*q));
 }
 
 /**
@@ -138,3 +170,51 @@ void queue_print(const queue *q, inspect_callback print_func)
 	}
 	printf(" }\n");
 }
+
+/**
+ * queue_stats() - Return the operation statistics of a queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The statistics since the queue was created or last reset.
+ *	    All fields are 0 unless compiled with DOA_STATS defined.
+ */
+op_stats queue_stats(const queue *q)
+{
+	op_stats s = STATS_GET(q);
+#ifdef DOA_STATS
+	// Add the allocations and traversals made by the list.
+	op_stats ls = list_stats(q->elements);
+	s.traversals += ls.traversals;
+	s.allocations += ls.allocations;
+#endif
+	return s;
+}
+
+/**
+ * queue_stats_reset() - Reset the operation statistics of a queue.
+ * @q: Queue to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void queue_stats_reset(queue *q)
+{
+	STATS_RESET(q);
+	list_stats_reset(q->elements);
+}
+
+/**
+ * queue_memory_usage() - Return the memory used by a queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage queue_memory_usage(const queue *q)
+{
+	// The elements are stored in the list.
+	mem_usage m = list_memory_usage(q->elements);
+	m.header += sizeof(*q);
+	m.total += sizeof(*q);
+	return m;
+}
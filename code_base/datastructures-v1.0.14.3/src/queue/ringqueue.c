@@ -0,0 +1,280 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <queue.h>
+
+/*
+ * Implementation of a generic queue for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The queue is implemented as a circular array of void pointers whose
+ * size is a power of two. The array is doubled when it is full, so
+ * queue_enqueue() is amortized O(1). No memory is allocated per
+ * element, and consecutive elements are stored next to each other in
+ * memory.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-17: Added queue_stats and queue_stats_reset.
+ *   v1.2 2026-10-17: Added queue_memory_usage.
+ *   v1.3 2026-10-17: Use the util.h allocator helpers. Grow in place.
+ */
+
+// Number of elements in the array of a new queue. Must be a power of two.
+#define QUEUE_INITIAL_CAPACITY 16
+
+// ===========INTERNAL DATA TYPES============
+
+struct queue {
+	void **values; // Circular array of elements.
+	size_t capacity; // Number of array elements. Always a power of two.
+	size_t front; // Index of the element at the front of the queue.
+	size_t size; // Number of elements in the queue.
+	free_function free_func;
+	allocator alloc;
+#ifdef DOA_STATS
+	op_stats stats;
+#endif
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * value_at() - Return the array index of an element in the queue.
+ * @q: Queue to inspect.
+ * @i: Position of the element, counted from the front of the queue.
+ *
+ * Returns: The index in q->values of element i.
+ */
+static size_t value_at(const queue *q, size_t i)
+{
+	return (q->front + i) & (q->capacity - 1);
+}
+
+/**
+ * grow() - Double the size of the array of a queue.
+ * @q: Queue to manipulate.
+ *
+ * The array is resized in place if the allocator can, so the elements
+ * from the front to the end of the old array stay where they are. Any
+ * elements that had wrapped around to the start of the old array are
+ * moved to just after them, which always fits since the size doubles.
+ *
+ * Returns: Nothing.
+ */
+static void grow(queue *q)
+{
+	size_t old_capacity = q->capacity;
+	void **values = mem_realloc(&q->alloc, q->values,
+				    old_capacity * sizeof(void *),
+				    2 * old_capacity * sizeof(void *));
+	if (values == NULL) {
+		fprintf(stderr, "queue: Out of memory.\n");
+		exit(EXIT_FAILURE);
+	}
+	STATS_COUNT(q, allocations, 1);
+	q->values = values;
+	q->capacity = 2 * old_capacity;
+
+	if (q->front + q->size > old_capacity) {
+		size_t wrapped = q->front + q->size - old_capacity;
+		memcpy(values + old_capacity, values,
+		       wrapped * sizeof(void *));
+	}
+}
+
+/**
+ * queue_empty() - Create an empty queue.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ *
+ * Returns: A pointer to the new queue.
+ */
+queue *queue_empty(free_function free_func)
+{
+	return queue_empty_with_allocator(free_func, NULL);
+}
+
+/**
+ * queue_empty_with_allocator() - Create an empty queue using an allocator.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the queue. NULL selects malloc()/free().
+ *
+ * Returns: A pointer to the new queue.
+ */
+queue *queue_empty_with_allocator(free_function free_func,
+				  const allocator *alloc)
+{
+	allocator a = use_allocator(alloc);
+
+	// Allocate the queue head.
+	queue *q = mem_alloc(&a, sizeof(*q));
+	q->alloc = a;
+	// Allocate the initial array.
+	q->capacity = QUEUE_INITIAL_CAPACITY;
+	q->values = mem_alloc(&q->alloc, q->capacity * sizeof(void *));
+	// The queue head and the array.
+	STATS_COUNT(q, allocations, 2);
+	q->front = 0;
+	q->size = 0;
+	// Store the free function.
+	q->free_func = free_func;
+
+	return q;
+}
+
+/**
+ * queue_is_empty() - Check if a queue is empty.
+ * @q: Queue to check.
+ *
+ * Returns: True if queue is empty, otherwise false.
+ */
+bool queue_is_empty(const queue *q)
+{
+	return q->size == 0;
+}
+
+/**
+ * queue_enqueue() - Put a value at the end of the queue.
+ * @q: Queue to manipulate.
+ * @v: Value (pointer) to be put in the queue.
+ *
+ * Returns: The modified queue.
+ */
+queue *queue_enqueue(queue *q, void *v)
+{
+	if (q->size == q->capacity) {
+		grow(q);
+	}
+	q->values[value_at(q, q->size)] = v;
+	q->size++;
+	STATS_COUNT(q, ops, 1);
+	STATS_ADD_SIZE(q, 1);
+	return q;
+}
+
+/**
+ * queue_dequeue() - Remove the element at the front of a queue.
+ * @q: Queue to manipulate.
+ *
+ * NOTE: Undefined for an empty queue.
+ *
+ * Returns: The modified queue.
+ */
+queue *queue_dequeue(queue *q)
+{
+	// Call free_func if registered.
+	if (q->free_func != NULL) {
+		// Free any user-allocated memory for the value.
+		q->free_func(q->values[q->front]);
+	}
+	q->front = value_at(q, 1);
+	q->size--;
+	STATS_COUNT(q, ops, 1);
+	STATS_SUB_SIZE(q, 1);
+	return q;
+}
+
+/**
+ * queue_front() - Inspect the value at the front of the queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The value at the top of the queue.
+ *	    NOTE: The return value is undefined for an empty queue.
+ */
+void *queue_front(const queue *q)
+{
+	STATS_COUNT(q, ops, 1);
+	return q->values[q->front];
+}
+
+/**
+ * queue_kill() - Destroy a given queue.
+ * @q: Queue to destroy.
+ *
+ * Return all dynamic memory used by the queue and its elements. If a
+ * free_func was registered at queue creation, also calls it for each
+ * element to free any user-allocated memory occupied by the element values.
+ *
+ * Returns: Nothing.
+ */
+void queue_kill(queue *q)
+{
+	// Call free_func for each element if registered.
+	if (q->free_func != NULL) {
+		for (size_t i = 0; i < q->size; i++) {
+			q->free_func(q->values[value_at(q, i)]);
+		}
+	}
+	// Free the array...
+	mem_free(&q->alloc, q->values, q->capacity * sizeof(void *));
+	// ...and the queue head.
+	mem_free(&q->alloc, q, sizeof(*q));
+}
+
+/**
+ * queue_print() - Iterate over the queue elements and print their values.
+ * @q: Queue to inspect.
+ * @print_func: Function called for each element.
+ *
+ * Iterates over the queue and calls print_func with the value stored
+ * in each element.
+ *
+ * Returns: Nothing.
+ */
+void queue_print(const queue *q, inspect_callback print_func)
+{
+	printf("{ ");
+	for (size_t i = 0; i < q->size; i++) {
+		print_func(q->values[value_at(q, i)]);
+		if (i + 1 < q->size) {
+			printf(", ");
+		}
+	}
+	printf(" }\n");
+}
+
+/**
+ * queue_stats() - Return the operation statistics of a queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The statistics since the queue was created or last reset.
+ *	    All fields are 0 unless compiled with DOA_STATS defined.
+ */
+op_stats queue_stats(const queue *q)
+{
+	return STATS_GET(q);
+}
+
+/**
+ * queue_stats_reset() - Reset the operation statistics of a queue.
+ * @q: Queue to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void queue_stats_reset(queue *q)
+{
+	STATS_RESET(q);
+}
+
+/**
+ * queue_memory_usage() - Return the memory used by a queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage queue_memory_usage(const queue *q)
+{
+	mem_usage m;
+	m.header = sizeof(*q);
+	m.elements = q->size * sizeof(void *);
+	m.slack = (q->capacity - q->size) * sizeof(void *);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
@@ -0,0 +1,315 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include <spsc_queue.h>
+
+/*
+ * Implementation of a generic, bounded single-producer/single-consumer
+ * queue for the "Datastructures and algorithms" courses at the
+ * Department of Computing Science, Umea University.
+ *
+ * The values are stored in a circular array whose size is a power of
+ * two. The producer owns the tail index and the consumer owns the
+ * head index. Both indices count upwards without wrapping the array
+ * size, so the queue is full when tail - head equals the capacity.
+ * A release store of an index publishes the values written before it,
+ * and an acquire load by the other thread makes them visible there.
+ *
+ * Each thread also keeps a private copy of the index owned by the
+ * other thread and only re-reads the shared index when the copy says
+ * the queue is full (empty). The indices of the two threads are kept
+ * on separate cache lines so they do not invalidate each other.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-17: Added spsc_queue_memory_usage.
+ */
+
+// Size of a cache line in bytes.
+#define CACHE_LINE_SIZE 64
+
+// ===========INTERNAL DATA TYPES============
+
+struct spsc_queue {
+	// Read-only after creation.
+	void **values;
+	size_t mask; // Capacity - 1.
+	free_function free_func;
+	char pad0[CACHE_LINE_SIZE];
+
+	// Written by the consumer.
+	atomic_size_t head; // Index of the next value to dequeue.
+	size_t cached_tail; // Consumer's copy of tail.
+	char pad1[CACHE_LINE_SIZE];
+
+	// Written by the producer.
+	atomic_size_t tail; // Index of the next free slot.
+	size_t cached_head; // Producer's copy of head.
+	char pad2[CACHE_LINE_SIZE];
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * free_space() - Return the number of free slots seen by the producer.
+ * @q: Queue to inspect.
+ * @tail: Current tail index.
+ * @n: Number of slots wanted.
+ *
+ * Re-reads the head index only if the cached copy shows fewer than n
+ * free slots.
+ *
+ * Returns: The number of free slots.
+ */
+static size_t free_space(spsc_queue *q, size_t tail, size_t n)
+{
+	size_t capacity = q->mask + 1;
+	size_t space = capacity - (tail - q->cached_head);
+	if (space < n) {
+		q->cached_head = atomic_load_explicit(&q->head,
+						      memory_order_acquire);
+		space = capacity - (tail - q->cached_head);
+	}
+	return space;
+}
+
+/**
+ * used_space() - Return the number of values seen by the consumer.
+ * @q: Queue to inspect.
+ * @head: Current head index.
+ * @n: Number of values wanted.
+ *
+ * Re-reads the tail index only if the cached copy shows fewer than n
+ * values.
+ *
+ * Returns: The number of values in the queue.
+ */
+static size_t used_space(spsc_queue *q, size_t head, size_t n)
+{
+	size_t used = q->cached_tail - head;
+	if (used < n) {
+		q->cached_tail = atomic_load_explicit(&q->tail,
+						      memory_order_acquire);
+		used = q->cached_tail - head;
+	}
+	return used;
+}
+
+/**
+ * spsc_queue_empty() - Create an empty queue.
+ * @capacity: Minimum number of values the queue can hold. Rounded up
+ *	      to a power of two.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on kill.
+ *
+ * Returns: A pointer to the new queue, or NULL if not enough memory
+ * was available.
+ */
+spsc_queue *spsc_queue_empty(size_t capacity, free_function free_func)
+{
+	// Round the capacity up to a power of two.
+	size_t n = 1;
+	while (n < capacity) {
+		n *= 2;
+	}
+
+	spsc_queue *q = calloc(1, sizeof(*q));
+	if (q == NULL) {
+		return NULL;
+	}
+	q->values = calloc(n, sizeof(void *));
+	if (q->values == NULL) {
+		free(q);
+		return NULL;
+	}
+	q->mask = n - 1;
+	q->free_func = free_func;
+	atomic_init(&q->head, 0);
+	atomic_init(&q->tail, 0);
+	q->cached_head = 0;
+	q->cached_tail = 0;
+
+	return q;
+}
+
+/**
+ * spsc_queue_capacity() - Return the maximum number of values in a queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The number of values the queue can hold.
+ */
+size_t spsc_queue_capacity(const spsc_queue *q)
+{
+	return q->mask + 1;
+}
+
+/**
+ * spsc_queue_memory_usage() - Return the memory used by a queue.
+ * @q: Queue to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage spsc_queue_memory_usage(const spsc_queue *q)
+{
+	// Read head first, so that tail - head is never negative. The
+	// result is a snapshot if the queue is in use.
+	size_t head = atomic_load_explicit(&((spsc_queue *)q)->head,
+					   memory_order_acquire);
+	size_t tail = atomic_load_explicit(&((spsc_queue *)q)->tail,
+					   memory_order_acquire);
+	size_t capacity = q->mask + 1;
+	size_t size = tail - head;
+	if (size > capacity) {
+		size = capacity;
+	}
+	mem_usage m;
+	m.header = sizeof(*q);
+	m.elements = size * sizeof(void *);
+	m.slack = (capacity - size) * sizeof(void *);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
+
+/**
+ * spsc_queue_try_enqueue() - Put a value at the end of the queue.
+ * @q: Queue to manipulate.
+ * @v: Value (pointer) to be put in the queue.
+ *
+ * May only be called by the producer.
+ *
+ * Returns: True if the value was put in the queue, false if the queue
+ * was full.
+ */
+bool spsc_queue_try_enqueue(spsc_queue *q, void *v)
+{
+	// Only the producer writes tail, so a relaxed load is enough.
+	size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+
+	if (free_space(q, tail, 1) == 0) {
+		return false;
+	}
+	q->values[tail & q->mask] = v;
+	// Publish the value to the consumer.
+	atomic_store_explicit(&q->tail, tail + 1, memory_order_release);
+	return true;
+}
+
+/**
+ * spsc_queue_try_dequeue() - Remove the value at the front of the queue.
+ * @q: Queue to manipulate.
+ * @v: Pointer to where the removed value is stored.
+ *
+ * May only be called by the consumer. The free_func is not called for
+ * the removed value, it is handed over to the caller.
+ *
+ * Returns: True if a value was removed, false if the queue was empty.
+ */
+bool spsc_queue_try_dequeue(spsc_queue *q, void **v)
+{
+	// Only the consumer writes head, so a relaxed load is enough.
+	size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+
+	if (used_space(q, head, 1) == 0) {
+		return false;
+	}
+	*v = q->values[head & q->mask];
+	// Hand the slot back to the producer.
+	atomic_store_explicit(&q->head, head + 1, memory_order_release);
+	return true;
+}
+
+/**
+ * spsc_queue_try_enqueue_n() - Put several values at the end of the queue.
+ * @q: Queue to manipulate.
+ * @v: Array of values (pointers) to be put in the queue.
+ * @n: Number of values in v.
+ *
+ * Puts as many values from the start of v as there is room for in the
+ * queue. The values become visible to the consumer all at once. May
+ * only be called by the producer.
+ *
+ * Returns: The number of values put in the queue, 0 <= result <= n.
+ */
+size_t spsc_queue_try_enqueue_n(spsc_queue *q, void *const *v, size_t n)
+{
+	size_t tail = atomic_load_explicit(&q->tail, memory_order_relaxed);
+	size_t space = free_space(q, tail, n);
+
+	if (n > space) {
+		n = space;
+	}
+	if (n == 0) {
+		return 0;
+	}
+	// Copy up to the end of the array, then wrap around to its start.
+	size_t i = tail & q->mask;
+	size_t first = q->mask + 1 - i;
+	if (first > n) {
+		first = n;
+	}
+	memcpy(q->values + i, v, first * sizeof(void *));
+	memcpy(q->values, v + first, (n - first) * sizeof(void *));
+
+	atomic_store_explicit(&q->tail, tail + n, memory_order_release);
+	return n;
+}
+
+/**
+ * spsc_queue_try_dequeue_n() - Remove several values from the queue.
+ * @q: Queue to manipulate.
+ * @v: Array where the removed values are stored.
+ * @n: Maximum number of values to remove.
+ *
+ * Removes up to n values from the front of the queue and stores them
+ * in queue order at the start of v. May only be called by the consumer.
+ *
+ * Returns: The number of values removed, 0 <= result <= n.
+ */
+size_t spsc_queue_try_dequeue_n(spsc_queue *q, void **v, size_t n)
+{
+	size_t head = atomic_load_explicit(&q->head, memory_order_relaxed);
+	size_t used = used_space(q, head, n);
+
+	if (n > used) {
+		n = used;
+	}
+	if (n == 0) {
+		return 0;
+	}
+	// Copy up to the end of the array, then wrap around to its start.
+	size_t i = head & q->mask;
+	size_t first = q->mask + 1 - i;
+	if (first > n) {
+		first = n;
+	}
+	memcpy(v, q->values + i, first * sizeof(void *));
+	memcpy(v + first, q->values, (n - first) * sizeof(void *));
+
+	atomic_store_explicit(&q->head, head + n, memory_order_release);
+	return n;
+}
+
+/**
+ * spsc_queue_kill() - Destroy a given queue.
+ * @q: Queue to destroy.
+ *
+ * Return all dynamic memory used by the queue. If a free_func was
+ * registered at queue creation, also calls it for each value left in
+ * the queue.
+ *
+ * Returns: Nothing.
+ */
+void spsc_queue_kill(spsc_queue *q)
+{
+	if (q->free_func != NULL) {
+		size_t head = atomic_load(&q->head);
+		size_t tail = atomic_load(&q->tail);
+		for (size_t i = head; i != tail; i++) {
+			q->free_func(q->values[i & q->mask]);
+		}
+	}
+	free(q->values);
+	free(q);
+}
@@ -0,0 +1,207 @@
+// Needed for clock_gettime() and sched_yield() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <spsc_queue.h>
+#include <queue.h>
+
+/*
+ * Throughput benchmark for spsc_queue.c. One producer thread passes
+ * a number of values to one consumer thread, and the number of values
+ * per second is reported. The test is run for several batch sizes,
+ * i.e. number of values moved per call to spsc_queue_try_enqueue_n()
+ * and spsc_queue_try_dequeue_n(). For comparison, the same test is
+ * run with a queue.c queue protected by a mutex.
+ *
+ * Usage: spsc_queue_bench [number of values]
+ *
+ * Compile with -O2 -pthread.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-16"
+
+// Default number of values to pass between the threads.
+#define DEFAULT_ITEMS 10000000
+
+// Capacity of the queue.
+#define CAPACITY 1024
+
+// Largest batch size.
+#define MAX_BATCH 256
+
+// Parameters shared by the producer and consumer.
+struct bench {
+	spsc_queue *q;
+	size_t items; // Number of values to pass.
+	size_t batch; // Number of values per call.
+	// Used by the mutex test.
+	queue *mq;
+	pthread_mutex_t lock;
+};
+
+// Return the current time in seconds.
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Producer thread for the spsc_queue test. The values are the
+// numbers 1, 2, ... cast to pointers.
+static void *spsc_producer(void *arg)
+{
+	struct bench *b = arg;
+	void *batch[MAX_BATCH];
+	size_t next = 1;
+
+	while (next <= b->items) {
+		size_t n = 0;
+		while (n < b->batch && next + n <= b->items) {
+			batch[n] = (void *)(next + n);
+			n++;
+		}
+		size_t m;
+		if (n == 1) {
+			m = spsc_queue_try_enqueue(b->q, batch[0]) ? 1 : 0;
+		} else {
+			m = spsc_queue_try_enqueue_n(b->q, batch, n);
+		}
+		if (m == 0) {
+			sched_yield();
+		}
+		next += m;
+	}
+	return NULL;
+}
+
+// Consumer for the spsc_queue test. Returns the sum of the values.
+static size_t spsc_consumer(struct bench *b)
+{
+	void *batch[MAX_BATCH];
+	size_t received = 0;
+	size_t sum = 0;
+
+	while (received < b->items) {
+		size_t m;
+		if (b->batch == 1) {
+			m = spsc_queue_try_dequeue(b->q, batch) ? 1 : 0;
+		} else {
+			m = spsc_queue_try_dequeue_n(b->q, batch, b->batch);
+		}
+		if (m == 0) {
+			sched_yield();
+		}
+		for (size_t i = 0; i < m; i++) {
+			sum += (size_t)batch[i];
+		}
+		received += m;
+	}
+	return sum;
+}
+
+// Producer thread for the mutex test.
+static void *mutex_producer(void *arg)
+{
+	struct bench *b = arg;
+
+	for (size_t next = 1; next <= b->items; next++) {
+		pthread_mutex_lock(&b->lock);
+		queue_enqueue(b->mq, (void *)next);
+		pthread_mutex_unlock(&b->lock);
+	}
+	return NULL;
+}
+
+// Consumer for the mutex test. Returns the sum of the values.
+static size_t mutex_consumer(struct bench *b)
+{
+	size_t received = 0;
+	size_t sum = 0;
+
+	while (received < b->items) {
+		void *v = NULL;
+		pthread_mutex_lock(&b->lock);
+		if (!queue_is_empty(b->mq)) {
+			v = queue_front(b->mq);
+			queue_dequeue(b->mq);
+		}
+		pthread_mutex_unlock(&b->lock);
+		if (v == NULL) {
+			sched_yield();
+		} else {
+			sum += (size_t)v;
+			received++;
+		}
+	}
+	return sum;
+}
+
+// Run one test and print the result. If batch is 0, the mutex test
+// is run.
+static void run(size_t items, size_t batch)
+{
+	struct bench b;
+	pthread_t thread;
+	size_t sum;
+
+	b.items = items;
+	b.batch = batch;
+
+	double start = now();
+	if (batch == 0) {
+		b.mq = queue_empty(NULL);
+		pthread_mutex_init(&b.lock, NULL);
+		pthread_create(&thread, NULL, mutex_producer, &b);
+		sum = mutex_consumer(&b);
+	} else {
+		b.q = spsc_queue_empty(CAPACITY, NULL);
+		pthread_create(&thread, NULL, spsc_producer, &b);
+		sum = spsc_consumer(&b);
+	}
+	pthread_join(thread, NULL);
+	double elapsed = now() - start;
+
+	if (batch == 0) {
+		queue_kill(b.mq);
+		pthread_mutex_destroy(&b.lock);
+		printf("%-18s", "mutex + queue.c");
+	} else {
+		spsc_queue_kill(b.q);
+		printf("spsc, batch %-6zu", batch);
+	}
+	// The values 1..items should add up to items*(items+1)/2.
+	size_t expected = items * (items + 1) / 2;
+	printf(" %10.3f s %14.0f items/s%s\n", elapsed, items / elapsed,
+	       sum == expected ? "" : "  ERROR: wrong sum");
+}
+
+int main(int argc, char *argv[])
+{
+	printf("%s, %s %s: SPSC queue throughput, 1 producer/1 consumer.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	size_t items = DEFAULT_ITEMS;
+	if (argc > 1) {
+		items = strtoul(argv[1], NULL, 10);
+	}
+	printf("%zu items, queue capacity %d.\n\n", items, CAPACITY);
+
+	run(items, 0);
+	for (size_t batch = 1; batch <= MAX_BATCH; batch *= 4) {
+		run(items, batch);
+	}
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
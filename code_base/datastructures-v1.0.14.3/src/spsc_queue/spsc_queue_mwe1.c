@@ -0,0 +1,105 @@
+// Needed for sched_yield() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include <spsc_queue.h>
+
+/*
+ * Minimum working example for spsc_queue.c. A producer thread puts
+ * the integers 1 to N into a small queue, a few at a time. The main
+ * thread acts as consumer, removes the values one at a time and
+ * checks that they arrive in order.
+ *
+ * Compile with -pthread.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-16"
+
+// Number of values to pass between the threads.
+#define N 100000
+
+// Number of values the producer tries to enqueue per call.
+#define BATCH 8
+
+// Values to pass. Pointers into this array are stored in the queue.
+static int values[N];
+
+// Producer thread. Enqueues pointers to all values in order.
+static void *producer(void *arg)
+{
+	spsc_queue *q = arg;
+	void *batch[BATCH];
+	int next = 0;
+
+	while (next < N) {
+		// Fill a batch with the next values...
+		size_t n = 0;
+		while (n < BATCH && next + n < N) {
+			batch[n] = &values[next + n];
+			n++;
+		}
+		// ...and enqueue as many of them as there is room for.
+		size_t m = spsc_queue_try_enqueue_n(q, batch, n);
+		if (m == 0) {
+			// Queue full. Let the consumer run.
+			sched_yield();
+		}
+		next += m;
+	}
+	return NULL;
+}
+
+int main(void)
+{
+	printf("%s, %s %s: Pass integers between two threads.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	for (int i = 0; i < N; i++) {
+		values[i] = i + 1;
+	}
+
+	// Create a queue for 64 values. The values are not owned by
+	// the queue.
+	spsc_queue *q = spsc_queue_empty(64, NULL);
+	printf("Queue capacity: %zu\n", spsc_queue_capacity(q));
+
+	pthread_t thread;
+	pthread_create(&thread, NULL, producer, q);
+
+	// Consume the values in the main thread.
+	long sum = 0;
+	int expected = 1;
+	while (expected <= N) {
+		void *v;
+		if (spsc_queue_try_dequeue(q, &v)) {
+			int *p = v;
+			if (*p != expected) {
+				printf("Error: Got %d, expected %d.\n",
+				       *p, expected);
+				return EXIT_FAILURE;
+			}
+			sum += *p;
+			expected++;
+		} else {
+			// Queue empty. Let the producer run.
+			sched_yield();
+		}
+	}
+	pthread_join(thread, NULL);
+
+	printf("Received %d values in order, sum %ld.\n", N, sum);
+
+	spsc_queue_kill(q);
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
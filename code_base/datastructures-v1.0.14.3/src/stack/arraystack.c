@@ -0,0 +1,304 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <stack.h>
+
+/*
+ * Implementation of a generic stack for the "Datastructures and
+ * algorithms" courses at the Department of Computing Science, Umea
+ * University.
+ *
+ * The stack is implemented as a dynamic array of void pointers with
+ * the bottom of the stack at index 0. The array is doubled when it is
+ * full, so stack_push() is amortized O(1) and no memory is allocated
+ * per element. To give memory back after a large stack has been
+ * emptied, the array is halved when it becomes less than a quarter
+ * full. The gap between the two limits means that alternating pushes
+ * and pops at a limit never resize the array more than once. The array
+ * is never shrunk below its initial size or below a size given to
+ * stack_reserve().
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-17: Added stack_stats and stack_stats_reset.
+ *   v1.2 2026-10-17: Added stack_memory_usage.
+ *   v1.3 2026-10-17: Use the allocator helpers in util.h.
+ */
+
+// Number of elements in the array of a new stack.
+#define STACK_INITIAL_CAPACITY 16
+
+// ===========INTERNAL DATA TYPES============
+
+struct stack {
+	void **values; // Array of elements. The top is values[size - 1].
+	size_t size; // Number of elements in the stack.
+	size_t capacity; // Number of array elements.
+	size_t min_capacity; // The array is never shrunk below this.
+	free_function free_func;
+	allocator alloc;
+#ifdef DOA_STATS
+	op_stats stats;
+#endif
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * resize() - Change the size of the array of a stack.
+ * @s: Stack to manipulate.
+ * @capacity: New number of array elements. Must be at least s->size.
+ *
+ * Returns: Nothing.
+ */
+static void resize(stack *s, size_t capacity)
+{
+	void **values = mem_realloc(&s->alloc, s->values,
+				    s->capacity * sizeof(void *),
+				    capacity * sizeof(void *));
+	if (values == NULL) {
+		fprintf(stderr, "stack: Out of memory.\n");
+		exit(EXIT_FAILURE);
+	}
+	STATS_COUNT(s, allocations, 1);
+	s->values = values;
+	s->capacity = capacity;
+}
+
+/**
+ * stack_empty() - Create an empty stack.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ *
+ * Returns: A pointer to the new stack.
+ */
+stack *stack_empty(free_function free_func)
+{
+	return stack_empty_with_allocator(free_func, NULL);
+}
+
+/**
+ * stack_empty_with_allocator() - Create an empty stack using an allocator.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the stack. NULL selects malloc()/free().
+ *
+ * Returns: A pointer to the new stack.
+ */
+stack *stack_empty_with_allocator(free_function free_func,
+				  const allocator *alloc)
+{
+	allocator a = use_allocator(alloc);
+
+	// Allocate the stack head.
+	stack *s = mem_alloc(&a, sizeof(*s));
+	s->alloc = a;
+	// Allocate the initial array.
+	s->capacity = STACK_INITIAL_CAPACITY;
+	s->min_capacity = STACK_INITIAL_CAPACITY;
+	s->values = mem_alloc(&s->alloc, s->capacity * sizeof(void *));
+	// The stack head and the array.
+	STATS_COUNT(s, allocations, 2);
+	s->size = 0;
+	// Store the free function.
+	s->free_func = free_func;
+
+	return s;
+}
+
+/**
+ * stack_is_empty() - Check if a stack is empty.
+ * @s: Stack to check.
+ *
+ * Returns: True if stack is empty, otherwise false.
+ */
+bool stack_is_empty(const stack *s)
+{
+	return s->size == 0;
+}
+
+/**
+ * stack_size() - Return the number of elements in a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The number of elements in the stack.
+ */
+size_t stack_size(const stack *s)
+{
+	return s->size;
+}
+
+/**
+ * stack_reserve() - Prepare a stack for a number of elements.
+ * @s: Stack to manipulate.
+ * @n: Number of elements.
+ *
+ * Grows the array to hold at least n elements. The array will not be
+ * shrunk below n elements by later pops.
+ *
+ * Returns: Nothing.
+ */
+void stack_reserve(stack *s, size_t n)
+{
+	if (n > s->min_capacity) {
+		s->min_capacity = n;
+	}
+	if (n > s->capacity) {
+		resize(s, n);
+	}
+}
+
+/**
+ * stack_push() - Push a value on top of a stack.
+ * @s: Stack to manipulate.
+ * @v: Value (pointer) to be put on the stack.
+ *
+ * Returns: The modified stack.
+ *          NOTE: After the call, the input stack should be considered invalid.
+ */
+stack *stack_push(stack *s, void *v)
+{
+	if (s->size == s->capacity) {
+		resize(s, 2 * s->capacity);
+	}
+	// Store value at first free position.
+	s->values[s->size] = v;
+	s->size++;
+	STATS_COUNT(s, ops, 1);
+	STATS_ADD_SIZE(s, 1);
+	return s;
+}
+
+/**
+ * stack_pop() - Remove the element at the top of a stack.
+ * @s: Stack to manipulate.
+ *
+ * NOTE: Undefined for an empty stack.
+ *
+ * Returns: The modified stack.
+ *          NOTE: After the call, the input stack should be considered invalid.
+ */
+stack *stack_pop(stack *s)
+{
+	STATS_COUNT(s, ops, 1);
+	if (stack_is_empty(s)) {
+		fprintf(stderr, "stack_pop: Warning: pop on empty stack\n");
+		return s;
+	}
+	s->size--;
+	STATS_SUB_SIZE(s, 1);
+	// De-allocate user memory.
+	if (s->free_func != NULL) {
+		s->free_func(s->values[s->size]);
+	}
+	// Halve the array when it is less than a quarter full.
+	if (s->size < s->capacity / 4 && s->capacity / 2 >= s->min_capacity) {
+		resize(s, s->capacity / 2);
+	}
+	return s;
+}
+
+/**
+ * stack_top() - Inspect the value at the top of the stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The value at the top of the stack.
+ *	    NOTE: The return value is undefined for an empty stack.
+ */
+void *stack_top(const stack *s)
+{
+	STATS_COUNT(s, ops, 1);
+	if (stack_is_empty(s)) {
+		fprintf(stderr, "stack_top: Warning: top on empty stack\n");
+		return NULL;
+	}
+	return s->values[s->size - 1];
+}
+
+/**
+ * stack_kill() - Destroy a given stack.
+ * @s: Stack to destroy.
+ *
+ * Return all dynamic memory used by the stack and its elements. If a
+ * free_func was registered at stack creation, also calls it for each
+ * element to free any user-allocated memory occupied by the element values.
+ *
+ * Returns: Nothing.
+ */
+void stack_kill(stack *s)
+{
+	// Call free_func for each element if registered, top first.
+	if (s->free_func != NULL) {
+		for (size_t i = s->size; i > 0; i--) {
+			s->free_func(s->values[i - 1]);
+		}
+	}
+	// Free the array...
+	mem_free(&s->alloc, s->values, s->capacity * sizeof(void *));
+	// ...and the stack head.
+	mem_free(&s->alloc, s, sizeof(*s));
+}
+
+/**
+ * stack_print() - Iterate over the stack elements and print their values.
+ * @s: Stack to inspect.
+ * @print_func: Function called for each element.
+ *
+ * Iterates over the stack from the top down and calls print_func with
+ * the value stored in each element.
+ *
+ * Returns: Nothing.
+ */
+void stack_print(const stack *s, inspect_callback print_func)
+{
+	printf("{ ");
+	for (size_t i = s->size; i > 0; i--) {
+		print_func(s->values[i - 1]);
+		if (i > 1) {
+			printf(", ");
+		}
+	}
+	printf(" }\n");
+}
+
+/**
+ * stack_stats() - Return the operation statistics of a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The statistics since the stack was created or last reset.
+ *	    All fields are 0 unless compiled with DOA_STATS defined.
+ */
+op_stats stack_stats(const stack *s)
+{
+	return STATS_GET(s);
+}
+
+/**
+ * stack_stats_reset() - Reset the operation statistics of a stack.
+ * @s: Stack to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void stack_stats_reset(stack *s)
+{
+	STATS_RESET(s);
+}
+
+/**
+ * stack_memory_usage() - Return the memory used by a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage stack_memory_usage(const stack *s)
+{
+	mem_usage m;
+	m.header = sizeof(*s);
+	m.elements = s->size * sizeof(void *);
+	m.slack = (s->capacity - s->size) * sizeof(void *);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
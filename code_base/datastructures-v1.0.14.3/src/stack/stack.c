@@ -16,6 +16,11 @@
  * Version information:
  *   v1.0 2018-01-28: First public version.
  *   v1.1 2022-03-24: Minor update to always take care of returned pointer.
+ *   v1.2 2026-10-16: Added stack_empty_with_allocator.
+ *   v1.3 2026-10-16: Added stack_size and stack_reserve.
+ *   v1.4 2026-10-17: Added stack_stats and stack_stats_reset.
+ *   v1.5 2026-10-17: Added stack_memory_usage.
+ *   v1.6 2026-10-17: Use the allocator helpers in util.h.
  */
 
 // ===========INTERNAL DATA TYPES============
@@ -31,7 +36,12 @@ struct cell {
 
 struct stack {
 	struct cell *top;
+	size_t size; // Number of elements in the stack.
 	free_function free_func;
+	allocator alloc;
+#ifdef DOA_STATS
+	op_stats stats;
+#endif
 };
 
 /**
@@ -43,9 +53,29 @@ struct stack {
  */
 stack *stack_empty(free_function free_func)
 {
+	return stack_empty_with_allocator(free_func, NULL);
+}
+
+/**
+ * stack_empty_with_allocator() - Create an empty stack using an allocator.
+ * @free_func: A pointer to a function (or NULL) to be called to
+ *	       de-allocate memory on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the stack. NULL selects malloc()/free().
+ *
+ * Returns: A pointer to the new stack.
+ */
+stack *stack_empty_with_allocator(free_function free_func,
+				  const allocator *alloc)
+{
+	allocator a = use_allocator(alloc);
+
 	// Allocate memory for stack structure.
-	stack *s = calloc(1, sizeof(stack));
+	stack *s = mem_alloc(&a, sizeof(stack));
+	STATS_COUNT(s, allocations, 1);
+	s->alloc = a;
 	s->top = NULL;
+	s->size = 0;
 	s->free_func = free_func;
 
 	return s;
@@ -62,6 +92,34 @@ bool stack_is_empty(const stack *s)
 	return s->top == NULL;
 }
 
+/**
+ * stack_size() - Return the number of elements in a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The number of elements in the stack.
+ */
+size_t stack_size(const stack *s)
+{
+	return s->size;
+}
+
+/**
+ * stack_reserve() - Prepare a stack for a number of elements.
+ * @s: Stack to manipulate.
+ * @n: Number of elements.
+ *
+ * The linked stack allocates one cell per element, so there is
+ * nothing to prepare. See arraystack.c for an implementation that
+ * uses the call.
+ *
+ * Returns: Nothing.
+ */
+void stack_reserve(stack *s, size_t n)
+{
+	(void)s;
+	(void)n;
+}
+
 /**
  * stack_push() - Push a value on top of a stack.
  * @s: Stack to manipulate.
@@ -73,13 +131,17 @@ bool stack_is_empty(const stack *s)
 stack *stack_push(stack *s, void *v)
 {
 	// Allocate memory for element.
-	struct cell *e = calloc(1, sizeof(*e));
+	struct cell *e = mem_alloc(&s->alloc, sizeof(*e));
+	STATS_COUNT(s, allocations, 1);
 	// Set element value.
 	e->value = v;
 	// Link to current top.
 	e->next = s->top;
 	// Put element on top of stack.
 	s->top = e;
+	s->size++;
+	STATS_COUNT(s, ops, 1);
+	STATS_ADD_SIZE(s, 1);
 	// Return modified stack.
 	return s;
 }
@@ -95,6 +157,7 @@ stack *stack_push(stack *s, void *v)
  */
 stack *stack_pop(stack *s)
 {
+	STATS_COUNT(s, ops, 1);
 	if (stack_is_empty(s)) {
 		fprintf(stderr, "stack_pop: Warning: pop on empty stack\n");
 	} else {
@@ -102,12 +165,14 @@ stack *stack_pop(stack *s)
 		struct cell *e = s->top;
 		// Link past top element.
 		s->top = s->top->next;
+		s->size--;
+		STATS_SUB_SIZE(s, 1);
 		// De-allocate user memory.
 		if (s->free_func != NULL) {
 			s->free_func(e->value);
 		}
 		// De-allocate element memory.
-		free(e);
+		mem_free(&s->alloc, e, sizeof(*e));
 	}
 	return s;
 }
@@ -121,6 +186,7 @@ stack *stack_pop(stack *s)
  */
 void *stack_top(const stack *s)
 {
+	STATS_COUNT(s, ops, 1);
 	if (stack_is_empty(s)) {
 		fprintf(stderr, "stack_top: Warning: top on empty stack\n");
 	}
@@ -142,7 +208,7 @@ void stack_kill(stack *s)
 	while (!stack_is_empty(s)) {
 		s = stack_pop(s);
 	}
-	free(s);
+	mem_free(&s->alloc, s, sizeof(*s));
 }
 
 /**
@@ -168,3 +234,45 @@ void stack_print(const stack *s, inspect_callback print_func)
 	}
 	printf(" }\n");
 }
+
+/**
+ * stack_stats() - Return the operation statistics of a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The statistics since the stack was created or last reset.
+ *	    All fields are 0 unless compiled with DOA_STATS defined.
+ */
+op_stats stack_stats(const stack *s)
+{
+	return STATS_GET(s);
+}
+
+/**
+ * stack_stats_reset() - Reset the operation statistics of a stack.
+ * @s: Stack to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void stack_stats_reset(stack *s)
+{
+	STATS_RESET(s);
+}
+
+/**
+ * stack_memory_usage() - Return the memory used by a stack.
+ * @s: Stack to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage stack_memory_usage(const stack *s)
+{
+	mem_usage m;
+	m.header = sizeof(*s);
+	// One cell per element, no unused cells.
+	m.elements = s->size * sizeof(struct cell);
+	m.slack = 0;
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
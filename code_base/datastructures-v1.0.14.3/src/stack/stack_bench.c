@@ -0,0 +1,95 @@
+// Needed for clock_gettime() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+
+#include <stack.h>
+
+/*
+ * Benchmark for the stack.h implementations. The stack is filled to
+ * a given depth with push and then emptied with top/pop, like the
+ * stack of a depth-first search, repeated until a total number of
+ * operations is reached. The test is run once without and once with
+ * stack_reserve(). The same file is compiled against stack.c
+ * (stack_bench) and arraystack.c (arraystack_bench).
+ *
+ * Usage: stack_bench [number of operations]
+ *
+ * Compile with -O2.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-16"
+
+// Default number of operations (push or pop).
+#define DEFAULT_OPS 10000000
+
+// Return the current time in seconds.
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Run the test with a given depth. If reserve is true, call
+// stack_reserve() for the full depth first.
+static void bench(long depth, long ops, bool reserve)
+{
+	intptr_t sum = 0;
+	double start = now();
+	stack *s = stack_empty(NULL);
+	if (reserve) {
+		stack_reserve(s, depth);
+	}
+	for (long done = 0; done < ops; done += 2 * depth) {
+		for (intptr_t i = 0; i < depth; i++) {
+			s = stack_push(s, (void *)i);
+		}
+		if (stack_size(s) != (size_t)depth) {
+			fprintf(stderr, "Wrong stack size.\n");
+			exit(EXIT_FAILURE);
+		}
+		for (long i = 0; i < depth; i++) {
+			sum += (intptr_t)stack_top(s);
+			s = stack_pop(s);
+		}
+	}
+	stack_kill(s);
+	double elapsed = now() - start;
+	printf("%10ld %8s %10.3f ms %8.2f ns/op  (checksum %ld)\n", depth,
+	       reserve ? "yes" : "no", elapsed * 1e3, elapsed * 1e9 / ops,
+	       (long)sum);
+}
+
+int main(int argc, char *argv[])
+{
+	printf("%s, %s %s: Push/pop benchmark for stack.h.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	long ops = DEFAULT_OPS;
+	if (argc > 1) {
+		ops = atol(argv[1]);
+	}
+	if (ops < 2) {
+		fprintf(stderr, "Number of operations must be at least 2.\n");
+		return EXIT_FAILURE;
+	}
+	printf("%ld operations per test.\n\n", ops);
+	printf("%10s %8s %13s %14s\n", "depth", "reserve", "time", "per op");
+
+	for (long depth = 100; depth <= ops / 2; depth *= 100) {
+		bench(depth, ops, false);
+		bench(depth, ops, true);
+	}
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
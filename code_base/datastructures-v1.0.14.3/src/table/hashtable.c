@@ -0,0 +1,494 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+
+#include <table.h>
+
+/*
+ * Implementation of a generic, hashed table for the "Datastructures
+ * and algorithms" courses at the Department of Computing Science,
+ * Umea University.
+ *
+ * The table uses open addressing with linear probing. All entries
+ * are stored directly in a flat array of slots whose size is a power
+ * of two. The slot array is doubled when it becomes more than 3/4
+ * full. Removal uses backward shifting, so no tombstones are needed
+ * and lookups never get slower after many removals.
+ *
+ * Duplicates are handled by insert. Inserting a key that is already
+ * in the table replaces the stored key/value pair, so lookup returns
+ * the latest added value as documented in table.h. Any free functions
+ * are called on the replaced key and/or value.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-16: Added table_empty_with_allocator.
+ *   v1.2 2026-10-17: Added table_stats and table_stats_reset.
+ *   v1.3 2026-10-17: Added table_memory_usage.
+ *   v1.4 2026-10-17: Use the util.h allocator helpers. Resize unzeroed.
+ */
+
+// Number of slots in a new table. Must be a power of two.
+#define TABLE_INITIAL_CAPACITY 16
+
+// ===========INTERNAL DATA TYPES============
+
+struct table_slot {
+	void *key;
+	void *value;
+	size_t hash; // Mixed hash value of the key.
+	bool in_use;
+};
+
+struct table {
+	struct table_slot *slots;
+	size_t capacity; // Number of slots. Always a power of two.
+	size_t size; // Number of slots in use.
+	compare_function *key_cmp_func;
+	hash_function *key_hash_func;
+	free_function key_free_func;
+	free_function value_free_func;
+	allocator alloc;
+#ifdef DOA_STATS
+	op_stats stats;
+#endif
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * constant_hash() - Hash function used when none is given.
+ * @key: Key to hash.
+ *
+ * Returns: Zero for all keys.
+ */
+static size_t constant_hash(const void *key)
+{
+	return 0;
+}
+
+/**
+ * mix_hash() - Scramble the bits of a user-supplied hash value.
+ * @h: Hash value to scramble.
+ *
+ * Many user hash functions (e.g. the identity for integers) leave
+ * the low bits poorly distributed. The slot index is taken from the
+ * low bits, so spread the entropy of all bits over them.
+ *
+ * Returns: The scrambled hash value.
+ */
+static size_t mix_hash(size_t h)
+{
+	uint64_t x = h;
+
+	x ^= x >> 33;
+	x *= UINT64_C(0xff51afd7ed558ccd);
+	x ^= x >> 33;
+	x *= UINT64_C(0xc4ceb9fe1a85ec53);
+	x ^= x >> 33;
+
+	return (size_t)x;
+}
+
+/**
+ * find_slot() - Find the slot holding a given key.
+ * @t: Table to inspect.
+ * @key: Key to look up.
+ * @hash: Mixed hash value of key.
+ *
+ * Returns: The index of the slot holding key, or the index of the
+ * empty slot where the probe sequence ended if key is not found.
+ */
+static size_t find_slot(const table *t, const void *key, size_t hash)
+{
+	size_t mask = t->capacity - 1;
+	size_t i = hash & mask;
+
+	// The table is never full, so the probe will hit an empty slot.
+	while (t->slots[i].in_use) {
+		// Only call the compare function if the hashes agree.
+		if (t->slots[i].hash == hash) {
+			STATS_COUNT(t, comparisons, 1);
+			if (t->key_cmp_func(t->slots[i].key, key) == 0) {
+				return i;
+			}
+		}
+		i = (i + 1) & mask;
+		STATS_COUNT(t, traversals, 1);
+	}
+	return i;
+}
+
+/**
+ * resize() - Move all entries to a new slot array.
+ * @t: Table to manipulate.
+ * @capacity: New number of slots. Must be a power of two larger than
+ *	      the number of entries.
+ *
+ * Returns: Nothing.
+ */
+static void resize(table *t, size_t capacity)
+{
+	struct table_slot *old_slots = t->slots;
+	size_t old_capacity = t->capacity;
+
+	// Only in_use needs to be cleared, the rest of a slot is written
+	// when it is taken into use.
+	t->slots = mem_alloc_uninit(&t->alloc, capacity * sizeof(*t->slots));
+	STATS_COUNT(t, allocations, 1);
+	t->capacity = capacity;
+	for (size_t i = 0; i < capacity; i++) {
+		t->slots[i].in_use = false;
+	}
+
+	// Re-insert each entry using the stored hash value. All keys
+	// are known to be unique, so no compare calls are needed.
+	size_t mask = capacity - 1;
+	for (size_t i = 0; i < old_capacity; i++) {
+		if (old_slots[i].in_use) {
+			size_t j = old_slots[i].hash & mask;
+			while (t->slots[j].in_use) {
+				j = (j + 1) & mask;
+				STATS_COUNT(t, traversals, 1);
+			}
+			t->slots[j] = old_slots[i];
+		}
+	}
+	mem_free(&t->alloc, old_slots, old_capacity * sizeof(*old_slots));
+}
+
+/**
+ * table_empty_with_hash() - Create an empty table with a key hash function.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: A pointer to a function to be used to hash keys.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_with_hash(compare_function *key_cmp_func,
+			     hash_function *key_hash_func,
+			     free_function key_free_func,
+			     free_function value_free_func)
+{
+	return table_empty_with_allocator(key_cmp_func, key_hash_func,
+					  key_free_func, value_free_func, NULL);
+}
+
+/**
+ * table_empty_with_allocator() - Create an empty table using an allocator.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: A pointer to a function (or NULL) to be used to hash keys.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the table. NULL selects malloc()/free().
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_with_allocator(compare_function *key_cmp_func,
+				  hash_function *key_hash_func,
+				  free_function key_free_func,
+				  free_function value_free_func,
+				  const allocator *alloc)
+{
+	allocator a = use_allocator(alloc);
+
+	if (key_hash_func == NULL) {
+		key_hash_func = constant_hash;
+	}
+	// Allocate the table header.
+	table *t = mem_alloc(&a, sizeof(table));
+	t->alloc = a;
+	// Allocate the initial slot array. All slots are unused.
+	t->capacity = TABLE_INITIAL_CAPACITY;
+	t->slots = mem_alloc(&t->alloc, t->capacity * sizeof(*t->slots));
+	// The table header and the slot array.
+	STATS_COUNT(t, allocations, 2);
+	t->size = 0;
+	// Store the key compare/hash functions and key/value free functions.
+	t->key_cmp_func = key_cmp_func;
+	t->key_hash_func = key_hash_func;
+	t->key_free_func = key_free_func;
+	t->value_free_func = value_free_func;
+
+	return t;
+}
+
+/**
+ * table_empty() - Create an empty table.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ *
+ * Without a hash function all keys end up in the same probe
+ * sequence. The table still works, but every operation is O(n). Use
+ * table_empty_with_hash() to get O(1) operations.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty(compare_function *key_cmp_func,
+		   free_function key_free_func,
+		   free_function value_free_func)
+{
+	return table_empty_with_hash(key_cmp_func, constant_hash,
+				     key_free_func, value_free_func);
+}
+
+/**
+ * table_is_empty() - Check if a table is empty.
+ * @table: Table to check.
+ *
+ * Returns: True if table contains no key/value pairs, false otherwise.
+ */
+bool table_is_empty(const table *t)
+{
+	return t->size == 0;
+}
+
+/**
+ * table_insert() - Add a key/value pair to a table.
+ * @table: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ *
+ * Insert the key/value pair into the table. If the key is already
+ * in the table, the stored key/value pair is replaced and any free
+ * functions are called on the old key and/or value. This will cause
+ * table_lookup() to find the latest added value.
+ *
+ * Returns: Nothing.
+ */
+void table_insert(table *t, void *key, void *value)
+{
+	STATS_COUNT(t, ops, 1);
+	// Grow before the load factor exceeds 3/4.
+	if (4 * (t->size + 1) > 3 * t->capacity) {
+		resize(t, 2 * t->capacity);
+	}
+
+	size_t hash = mix_hash(t->key_hash_func(key));
+	size_t i = find_slot(t, key, hash);
+	struct table_slot *slot = &t->slots[i];
+
+	if (slot->in_use) {
+		// Duplicate key. Free the old key and/or value if given
+		// the responsibility, unless the same pointer is reused.
+		if (t->key_free_func != NULL && slot->key != key) {
+			t->key_free_func(slot->key);
+		}
+		if (t->value_free_func != NULL && slot->value != value) {
+			t->value_free_func(slot->value);
+		}
+	} else {
+		slot->in_use = true;
+		slot->hash = hash;
+		t->size++;
+		STATS_ADD_SIZE(t, 1);
+	}
+	slot->key = key;
+	slot->value = value;
+}
+
+/**
+ * table_lookup() - Look up a given key in a table.
+ * @table: Table to inspect.
+ * @key: Key to look up.
+ *
+ * Returns: The value corresponding to a given key, or NULL if the key
+ * is not found in the table. If the table contains duplicate keys,
+ * the value that was latest inserted will be returned.
+ */
+void *table_lookup(const table *t, const void *key)
+{
+	STATS_COUNT(t, ops, 1);
+	size_t hash = mix_hash(t->key_hash_func(key));
+	size_t i = find_slot(t, key, hash);
+
+	if (t->slots[i].in_use) {
+		return t->slots[i].value;
+	}
+	// No match found. Return NULL.
+	return NULL;
+}
+
+/**
+ * table_choose_key() - Return an arbitrary key.
+ * @t: Table to inspect.
+ *
+ * Return an arbitrary key stored in the table. Can be used together
+ * with table_remove() to deconstruct the table. Undefined for an
+ * empty table.
+ *
+ * Returns: An arbitrary key stored in the table.
+ */
+void *table_choose_key(const table *t)
+{
+	STATS_COUNT(t, ops, 1);
+	// Return the key of the first used slot.
+	for (size_t i = 0; i < t->capacity; i++) {
+		if (t->slots[i].in_use) {
+			return t->slots[i].key;
+		}
+		STATS_COUNT(t, traversals, 1);
+	}
+	return NULL;
+}
+
+/**
+ * table_remove() - Remove a key/value pair in the table.
+ * @table: Table to manipulate.
+ * @key: Key for which to remove pair.
+ *
+ * Will call any free functions set for keys/values. Does nothing if
+ * key is not found in the table.
+ *
+ * Returns: Nothing.
+ */
+void table_remove(table *t, const void *key)
+{
+	STATS_COUNT(t, ops, 1);
+	size_t hash = mix_hash(t->key_hash_func(key));
+	size_t i = find_slot(t, key, hash);
+
+	if (!t->slots[i].in_use) {
+		// Key not in table.
+		return;
+	}
+
+	// Remember the pair. The key parameter may point to the same
+	// memory as the stored key, so free it only when we are done.
+	void *old_key = t->slots[i].key;
+	void *old_value = t->slots[i].value;
+
+	// Shift later entries of the probe sequence back into the hole
+	// until we reach an empty slot or an entry already at its home.
+	size_t mask = t->capacity - 1;
+	size_t j = i;
+	while (true) {
+		j = (j + 1) & mask;
+		STATS_COUNT(t, traversals, 1);
+		if (!t->slots[j].in_use) {
+			break;
+		}
+		size_t home = t->slots[j].hash & mask;
+		// Move the entry unless its home lies cyclically in (i, j].
+		bool home_after_hole = (i <= j) ?
+			(i < home && home <= j) : (i < home || home <= j);
+		if (!home_after_hole) {
+			t->slots[i] = t->slots[j];
+			i = j;
+		}
+	}
+	t->slots[i].in_use = false;
+	t->slots[i].key = NULL;
+	t->slots[i].value = NULL;
+	t->size--;
+	STATS_SUB_SIZE(t, 1);
+
+	// Free key and/or value if given the authority to do so.
+	if (t->key_free_func != NULL) {
+		t->key_free_func(old_key);
+	}
+	if (t->value_free_func != NULL) {
+		t->value_free_func(old_value);
+	}
+}
+
+/*
+ * table_kill() - Destroy a table.
+ * @table: Table to destroy.
+ *
+ * Return all dynamic memory used by the table and its elements. If a
+ * free_func was registered for keys and/or values at table creation,
+ * it is called each element to free any user-allocated memory
+ * occupied by the element values.
+ *
+ * Returns: Nothing.
+ */
+void table_kill(table *t)
+{
+	// Iterate over the slots. Free key and/or value if given the
+	// authority to do so.
+	for (size_t i = 0; i < t->capacity; i++) {
+		if (t->slots[i].in_use) {
+			if (t->key_free_func != NULL) {
+				t->key_free_func(t->slots[i].key);
+			}
+			if (t->value_free_func != NULL) {
+				t->value_free_func(t->slots[i].value);
+			}
+		}
+	}
+
+	// Free the slot array...
+	mem_free(&t->alloc, t->slots, t->capacity * sizeof(*t->slots));
+	// ...and the table.
+	mem_free(&t->alloc, t, sizeof(*t));
+}
+
+/**
+ * table_print() - Print the given table.
+ * @t: Table to print.
+ * @print_func: Function called for each key/value pair in the table.
+ *
+ * Iterates over the key/value pairs in the table and prints them in
+ * slot order.
+ *
+ * Returns: Nothing.
+ */
+void table_print(const table *t, inspect_callback_pair print_func)
+{
+	for (size_t i = 0; i < t->capacity; i++) {
+		if (t->slots[i].in_use) {
+			print_func(t->slots[i].key, t->slots[i].value);
+		}
+	}
+}
+
+/**
+ * table_stats() - Return the operation statistics of a table.
+ * @t: Table to inspect.
+ *
+ * Returns: The statistics since the table was created or last reset.
+ *	    All fields are 0 unless compiled with DOA_STATS defined.
+ */
+op_stats table_stats(const table *t)
+{
+	return STATS_GET(t);
+}
+
+/**
+ * table_stats_reset() - Reset the operation statistics of a table.
+ * @t: Table to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void table_stats_reset(table *t)
+{
+	STATS_RESET(t);
+}
+
+/**
+ * table_memory_usage() - Return the memory used by a table.
+ * @t: Table to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage table_memory_usage(const table *t)
+{
+	mem_usage m;
+	m.header = sizeof(*t);
+	m.elements = t->size * sizeof(struct table_slot);
+	m.slack = (t->capacity - t->size) * sizeof(struct table_slot);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
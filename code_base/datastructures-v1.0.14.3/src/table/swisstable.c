@@ -0,0 +1,663 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include <table.h>
+
+/*
+ * Implementation of a generic, hashed table for the "Datastructures
+ * and algorithms" courses at the Department of Computing Science,
+ * Umea University.
+ *
+ * The table uses open addressing over groups of 16 slots. Next to the
+ * slot array, the table keeps one control byte per slot. A control
+ * byte is either EMPTY, DELETED, or holds 7 bits of the key hash (the
+ * tag) for a slot in use. A lookup compares the tag with all 16
+ * control bytes of a group at once (using SSE2 when available) and
+ * only calls key_cmp_func for slots with a matching tag. A lookup for
+ * a missing key thus almost never calls key_cmp_func, and stops at
+ * the first group that has an EMPTY slot.
+ *
+ * Groups are probed in triangular order, which visits every group
+ * once since the number of groups is a power of two. The table grows
+ * when it becomes more than 7/8 full, counting DELETED slots.
+ *
+ * Duplicates are handled by insert. Inserting a key that is already
+ * in the table replaces the stored key/value pair, so lookup returns
+ * the latest added value as documented in table.h. Any free functions
+ * are called on the replaced key and/or value.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-16: Added table_empty_with_allocator.
+ *   v1.2 2026-10-17: Added table_stats and table_stats_reset.
+ *   v1.3 2026-10-17: Added table_memory_usage.
+ *   v1.4 2026-10-17: Use the util.h allocator helpers. Rehash unzeroed.
+ */
+
+// Number of slots per group. One SSE2 register holds one group.
+#define GROUP_SIZE 16
+
+// Number of groups in a new table. Must be a power of two.
+#define TABLE_INITIAL_GROUPS 1
+
+// Control byte values. Slots in use hold a tag in [0, 127].
+#define CTRL_EMPTY ((signed char)-128)
+#define CTRL_DELETED ((signed char)-2)
+
+// ===========INTERNAL DATA TYPES============
+
+struct table_slot {
+	void *key;
+	void *value;
+};
+
+struct table {
+	signed char *ctrl; // One control byte per slot.
+	struct table_slot *slots;
+	size_t num_groups; // Always a power of two.
+	size_t size; // Number of slots in use.
+	size_t growth_left; // Number of EMPTY slots we may still fill.
+	compare_function *key_cmp_func;
+	hash_function *key_hash_func;
+	free_function key_free_func;
+	free_function value_free_func;
+	allocator alloc;
+#ifdef DOA_STATS
+	op_stats stats;
+#endif
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * constant_hash() - Hash function used when none is given.
+ * @key: Key to hash.
+ *
+ * Returns: Zero for all keys.
+ */
+static size_t constant_hash(const void *key)
+{
+	return 0;
+}
+
+/**
+ * mix_hash() - Scramble the bits of a user-supplied hash value.
+ * @h: Hash value to scramble.
+ *
+ * The tag and group index are taken from different parts of the hash
+ * value, so spread the entropy of all bits over all of them.
+ *
+ * Returns: The scrambled hash value.
+ */
+static size_t mix_hash(size_t h)
+{
+	uint64_t x = h;
+
+	x ^= x >> 33;
+	x *= UINT64_C(0xff51afd7ed558ccd);
+	x ^= x >> 33;
+	x *= UINT64_C(0xc4ceb9fe1a85ec53);
+	x ^= x >> 33;
+
+	return (size_t)x;
+}
+
+/**
+ * hash_tag() - Return the control byte tag of a mixed hash value.
+ * @hash: Mixed hash value.
+ *
+ * Returns: The lowest 7 bits of hash.
+ */
+static signed char hash_tag(size_t hash)
+{
+	return (signed char)(hash & 0x7f);
+}
+
+/**
+ * hash_group() - Return the first group to probe for a mixed hash value.
+ * @t: Table to inspect.
+ * @hash: Mixed hash value.
+ *
+ * Returns: The index of the first group in the probe sequence.
+ */
+static size_t hash_group(const table *t, size_t hash)
+{
+	return (hash >> 7) & (t->num_groups - 1);
+}
+
+/**
+ * capacity() - Return the number of slots in a table.
+ * @t: Table to inspect.
+ *
+ * Returns: The number of slots.
+ */
+static size_t capacity(const table *t)
+{
+	return t->num_groups * GROUP_SIZE;
+}
+
+/**
+ * max_load() - Return the number of non-EMPTY slots allowed.
+ * @num_groups: Number of groups.
+ *
+ * Returns: 7/8 of the number of slots.
+ */
+static size_t max_load(size_t num_groups)
+{
+	return num_groups * GROUP_SIZE / 8 * 7;
+}
+
+#ifdef __SSE2__
+
+/**
+ * group_match() - Find the slots in a group with a given control byte.
+ * @ctrl: First control byte of the group.
+ * @c: Control byte to look for.
+ *
+ * Returns: A bit mask with bit i set if slot i of the group matches.
+ */
+static unsigned group_match(const signed char *ctrl, signed char c)
+{
+	__m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+	__m128i match = _mm_cmpeq_epi8(group, _mm_set1_epi8(c));
+	return (unsigned)_mm_movemask_epi8(match);
+}
+
+/**
+ * group_match_free() - Find the EMPTY or DELETED slots in a group.
+ * @ctrl: First control byte of the group.
+ *
+ * Both EMPTY and DELETED have the sign bit set, tags do not.
+ *
+ * Returns: A bit mask with bit i set if slot i of the group is free.
+ */
+static unsigned group_match_free(const signed char *ctrl)
+{
+	__m128i group = _mm_loadu_si128((const __m128i *)ctrl);
+	return (unsigned)_mm_movemask_epi8(group);
+}
+
+#else
+
+// Portable versions of the group functions above.
+
+static unsigned group_match(const signed char *ctrl, signed char c)
+{
+	unsigned mask = 0;
+	for (int i = 0; i < GROUP_SIZE; i++) {
+		if (ctrl[i] == c) {
+			mask |= 1u << i;
+		}
+	}
+	return mask;
+}
+
+static unsigned group_match_free(const signed char *ctrl)
+{
+	unsigned mask = 0;
+	for (int i = 0; i < GROUP_SIZE; i++) {
+		if (ctrl[i] < 0) {
+			mask |= 1u << i;
+		}
+	}
+	return mask;
+}
+
+#endif
+
+/**
+ * find_slot() - Find the slot holding a given key.
+ * @t: Table to inspect.
+ * @key: Key to look up.
+ * @hash: Mixed hash value of key.
+ *
+ * Returns: The index of the slot holding key, or -1 if key is not
+ * in the table.
+ */
+static long find_slot(const table *t, const void *key, size_t hash)
+{
+	signed char tag = hash_tag(hash);
+	size_t mask = t->num_groups - 1;
+	size_t g = hash_group(t, hash);
+
+	for (size_t step = 1; step <= t->num_groups; step++) {
+		const signed char *ctrl = t->ctrl + g * GROUP_SIZE;
+		// Only call the compare function for matching tags.
+		unsigned match = group_match(ctrl, tag);
+		while (match != 0) {
+			size_t i = g * GROUP_SIZE + __builtin_ctz(match);
+			STATS_COUNT(t, comparisons, 1);
+			if (t->key_cmp_func(t->slots[i].key, key) == 0) {
+				return (long)i;
+			}
+			// Clear the lowest set bit.
+			match &= match - 1;
+		}
+		// An EMPTY slot ends every probe sequence through this group.
+		if (group_match(ctrl, CTRL_EMPTY) != 0) {
+			return -1;
+		}
+		g = (g + step) & mask;
+		STATS_COUNT(t, traversals, 1);
+	}
+	return -1;
+}
+
+/**
+ * find_free_slot() - Find the first free slot in a probe sequence.
+ * @t: Table to inspect.
+ * @hash: Mixed hash value of the key to insert.
+ *
+ * NOTE: The table must have at least one EMPTY slot.
+ *
+ * Returns: The index of the first EMPTY or DELETED slot.
+ */
+static size_t find_free_slot(const table *t, size_t hash)
+{
+	size_t mask = t->num_groups - 1;
+	size_t g = hash_group(t, hash);
+	size_t step = 1;
+	unsigned free_mask;
+
+	while ((free_mask = group_match_free(t->ctrl + g * GROUP_SIZE)) == 0) {
+		g = (g + step) & mask;
+		step++;
+		STATS_COUNT(t, traversals, 1);
+	}
+	return g * GROUP_SIZE + __builtin_ctz(free_mask);
+}
+
+/**
+ * allocate_groups() - Allocate empty control and slot arrays.
+ * @t: Table to manipulate.
+ * @num_groups: Number of groups. Must be a power of two.
+ *
+ * Returns: Nothing.
+ */
+static void allocate_groups(table *t, size_t num_groups)
+{
+	t->num_groups = num_groups;
+	t->ctrl = mem_alloc_uninit(&t->alloc, capacity(t) * sizeof(*t->ctrl));
+	memset(t->ctrl, CTRL_EMPTY, capacity(t) * sizeof(*t->ctrl));
+	// A slot is only read when its control byte says it is in use.
+	t->slots = mem_alloc_uninit(&t->alloc,
+				    capacity(t) * sizeof(*t->slots));
+	STATS_COUNT(t, allocations, 2);
+	t->growth_left = max_load(num_groups);
+}
+
+/**
+ * rehash() - Move all entries to new control and slot arrays.
+ * @t: Table to manipulate.
+ * @num_groups: New number of groups. Must be a power of two.
+ *
+ * Drops all DELETED markers. Calls key_hash_func once per entry.
+ *
+ * Returns: Nothing.
+ */
+static void rehash(table *t, size_t num_groups)
+{
+	signed char *old_ctrl = t->ctrl;
+	struct table_slot *old_slots = t->slots;
+	size_t old_capacity = capacity(t);
+
+	allocate_groups(t, num_groups);
+
+	// All keys are known to be unique, so no compare calls are needed.
+	for (size_t i = 0; i < old_capacity; i++) {
+		if (old_ctrl[i] >= 0) {
+			size_t hash = mix_hash(t->key_hash_func(old_slots[i].key));
+			size_t j = find_free_slot(t, hash);
+			t->ctrl[j] = hash_tag(hash);
+			t->slots[j] = old_slots[i];
+		}
+	}
+	t->growth_left -= t->size;
+
+	mem_free(&t->alloc, old_ctrl, old_capacity * sizeof(*old_ctrl));
+	mem_free(&t->alloc, old_slots, old_capacity * sizeof(*old_slots));
+}
+
+/**
+ * table_empty_with_hash() - Create an empty table with a key hash function.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: A pointer to a function to be used to hash keys.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_with_hash(compare_function *key_cmp_func,
+			     hash_function *key_hash_func,
+			     free_function key_free_func,
+			     free_function value_free_func)
+{
+	return table_empty_with_allocator(key_cmp_func, key_hash_func,
+					  key_free_func, value_free_func, NULL);
+}
+
+/**
+ * table_empty_with_allocator() - Create an empty table using an allocator.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: A pointer to a function (or NULL) to be used to hash keys.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the table. NULL selects malloc()/free().
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_with_allocator(compare_function *key_cmp_func,
+				  hash_function *key_hash_func,
+				  free_function key_free_func,
+				  free_function value_free_func,
+				  const allocator *alloc)
+{
+	allocator a = use_allocator(alloc);
+
+	if (key_hash_func == NULL) {
+		key_hash_func = constant_hash;
+	}
+	// Allocate the table header.
+	table *t = mem_alloc(&a, sizeof(table));
+	STATS_COUNT(t, allocations, 1);
+	t->alloc = a;
+	// Allocate the initial groups. All slots are EMPTY.
+	allocate_groups(t, TABLE_INITIAL_GROUPS);
+	t->size = 0;
+	// Store the key compare/hash functions and key/value free functions.
+	t->key_cmp_func = key_cmp_func;
+	t->key_hash_func = key_hash_func;
+	t->key_free_func = key_free_func;
+	t->value_free_func = value_free_func;
+
+	return t;
+}
+
+/**
+ * table_empty() - Create an empty table.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ *
+ * Without a hash function all keys get the same tag and probe
+ * sequence. The table still works, but every operation is O(n). Use
+ * table_empty_with_hash() to get O(1) operations.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty(compare_function *key_cmp_func,
+		   free_function key_free_func,
+		   free_function value_free_func)
+{
+	return table_empty_with_hash(key_cmp_func, constant_hash,
+				     key_free_func, value_free_func);
+}
+
+/**
+ * table_is_empty() - Check if a table is empty.
+ * @table: Table to check.
+ *
+ * Returns: True if table contains no key/value pairs, false otherwise.
+ */
+bool table_is_empty(const table *t)
+{
+	return t->size == 0;
+}
+
+/**
+ * table_insert() - Add a key/value pair to a table.
+ * @table: Table to manipulate.
+ * @key: A pointer to the key value.
+ * @value: A pointer to the value value.
+ *
+ * Insert the key/value pair into the table. If the key is already
+ * in the table, the stored key/value pair is replaced and any free
+ * functions are called on the old key and/or value. This will cause
+ * table_lookup() to find the latest added value.
+ *
+ * Returns: Nothing.
+ */
+void table_insert(table *t, void *key, void *value)
+{
+	STATS_COUNT(t, ops, 1);
+	size_t hash = mix_hash(t->key_hash_func(key));
+	long found = find_slot(t, key, hash);
+
+	if (found >= 0) {
+		// Duplicate key. Free the old key and/or value if given
+		// the responsibility, unless the same pointer is reused.
+		struct table_slot *slot = &t->slots[found];
+		if (t->key_free_func != NULL && slot->key != key) {
+			t->key_free_func(slot->key);
+		}
+		if (t->value_free_func != NULL && slot->value != value) {
+			t->value_free_func(slot->value);
+		}
+		slot->key = key;
+		slot->value = value;
+		return;
+	}
+
+	size_t i = find_free_slot(t, hash);
+	if (t->growth_left == 0 && t->ctrl[i] == CTRL_EMPTY) {
+		// Out of EMPTY slots. If at least half of the used slots
+		// are DELETED, cleaning them out is enough. Otherwise grow.
+		if (2 * t->size <= max_load(t->num_groups)) {
+			rehash(t, t->num_groups);
+		} else {
+			rehash(t, 2 * t->num_groups);
+		}
+		i = find_free_slot(t, hash);
+	}
+	if (t->ctrl[i] == CTRL_EMPTY) {
+		t->growth_left--;
+	}
+	t->ctrl[i] = hash_tag(hash);
+	t->slots[i].key = key;
+	t->slots[i].value = value;
+	t->size++;
+	STATS_ADD_SIZE(t, 1);
+}
+
+/**
+ * table_lookup() - Look up a given key in a table.
+ * @table: Table to inspect.
+ * @key: Key to look up.
+ *
+ * Returns: The value corresponding to a given key, or NULL if the key
+ * is not found in the table. If the table contains duplicate keys,
+ * the value that was latest inserted will be returned.
+ */
+void *table_lookup(const table *t, const void *key)
+{
+	STATS_COUNT(t, ops, 1);
+	size_t hash = mix_hash(t->key_hash_func(key));
+	long i = find_slot(t, key, hash);
+
+	if (i >= 0) {
+		return t->slots[i].value;
+	}
+	// No match found. Return NULL.
+	return NULL;
+}
+
+/**
+ * table_choose_key() - Return an arbitrary key.
+ * @t: Table to inspect.
+ *
+ * Return an arbitrary key stored in the table. Can be used together
+ * with table_remove() to deconstruct the table. Undefined for an
+ * empty table.
+ *
+ * Returns: An arbitrary key stored in the table.
+ */
+void *table_choose_key(const table *t)
+{
+	STATS_COUNT(t, ops, 1);
+	// Return the key of the first used slot.
+	for (size_t i = 0; i < capacity(t); i++) {
+		if (t->ctrl[i] >= 0) {
+			return t->slots[i].key;
+		}
+		STATS_COUNT(t, traversals, 1);
+	}
+	return NULL;
+}
+
+/**
+ * table_remove() - Remove a key/value pair in the table.
+ * @table: Table to manipulate.
+ * @key: Key for which to remove pair.
+ *
+ * Will call any free functions set for keys/values. Does nothing if
+ * key is not found in the table.
+ *
+ * Returns: Nothing.
+ */
+void table_remove(table *t, const void *key)
+{
+	STATS_COUNT(t, ops, 1);
+	size_t hash = mix_hash(t->key_hash_func(key));
+	long i = find_slot(t, key, hash);
+
+	if (i < 0) {
+		// Key not in table.
+		return;
+	}
+
+	// Remember the pair. The key parameter may point to the same
+	// memory as the stored key, so free it only when we are done.
+	void *old_key = t->slots[i].key;
+	void *old_value = t->slots[i].value;
+
+	// If the group still has an EMPTY slot, no probe sequence has
+	// passed this group and the slot can be made EMPTY again.
+	// Otherwise, leave a DELETED marker to keep probes going.
+	const signed char *group = t->ctrl + (i / GROUP_SIZE) * GROUP_SIZE;
+	if (group_match(group, CTRL_EMPTY) != 0) {
+		t->ctrl[i] = CTRL_EMPTY;
+		t->growth_left++;
+	} else {
+		t->ctrl[i] = CTRL_DELETED;
+	}
+	t->slots[i].key = NULL;
+	t->slots[i].value = NULL;
+	t->size--;
+	STATS_SUB_SIZE(t, 1);
+
+	// Free key and/or value if given the authority to do so.
+	if (t->key_free_func != NULL) {
+		t->key_free_func(old_key);
+	}
+	if (t->value_free_func != NULL) {
+		t->value_free_func(old_value);
+	}
+}
+
+/*
+ * table_kill() - Destroy a table.
+ * @table: Table to destroy.
+ *
+ * Return all dynamic memory used by the table and its elements. If a
+ * free_func was registered for keys and/or values at table creation,
+ * it is called each element to free any user-allocated memory
+ * occupied by the element values.
+ *
+ * Returns: Nothing.
+ */
+void table_kill(table *t)
+{
+	// Iterate over the slots. Free key and/or value if given the
+	// authority to do so.
+	for (size_t i = 0; i < capacity(t); i++) {
+		if (t->ctrl[i] >= 0) {
+			if (t->key_free_func != NULL) {
+				t->key_free_func(t->slots[i].key);
+			}
+			if (t->value_free_func != NULL) {
+				t->value_free_func(t->slots[i].value);
+			}
+		}
+	}
+
+	// Free the control and slot arrays...
+	mem_free(&t->alloc, t->ctrl, capacity(t) * sizeof(*t->ctrl));
+	mem_free(&t->alloc, t->slots, capacity(t) * sizeof(*t->slots));
+	// ...and the table.
+	mem_free(&t->alloc, t, sizeof(*t));
+}
+
+/**
+ * table_print() - Print the given table.
+ * @t: Table to print.
+ * @print_func: Function called for each key/value pair in the table.
+ *
+ * Iterates over the key/value pairs in the table and prints them in
+ * slot order.
+ *
+ * Returns: Nothing.
+ */
+void table_print(const table *t, inspect_callback_pair print_func)
+{
+	for (size_t i = 0; i < capacity(t); i++) {
+		if (t->ctrl[i] >= 0) {
+			print_func(t->slots[i].key, t->slots[i].value);
+		}
+	}
+}
+
+/**
+ * table_stats() - Return the operation statistics of a table.
+ * @t: Table to inspect.
+ *
+ * Returns: The statistics since the table was created or last reset.
+ *	    All fields are 0 unless compiled with DOA_STATS defined.
+ */
+op_stats table_stats(const table *t)
+{
+	return STATS_GET(t);
+}
+
+/**
+ * table_stats_reset() - Reset the operation statistics of a table.
+ * @t: Table to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void table_stats_reset(table *t)
+{
+	STATS_RESET(t);
+}
+
+/**
+ * table_memory_usage() - Return the memory used by a table.
+ * @t: Table to inspect.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage table_memory_usage(const table *t)
+{
+	// Each slot has a control byte.
+	size_t slot_size = sizeof(struct table_slot) + sizeof(*t->ctrl);
+	mem_usage m;
+	m.header = sizeof(*t);
+	m.elements = t->size * slot_size;
+	m.slack = (capacity(t) - t->size) * slot_size;
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
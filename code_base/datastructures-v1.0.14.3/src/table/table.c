@@ -2,7 +2,6 @@
 #include <stdio.h>
 
 #include <table.h>
-#include <dlist.h>
 
 /*
  * Implementation of a generic table for the "Datastructures and
@@ -11,6 +10,12 @@
  *
  * Duplicates are handled by inspect and remove.
  *
+ * The entries are kept in a singly linked list, newest first. Each
+ * entry is its own list cell. Entries are carved out of slabs owned
+ * by the table and recycled through a free list, so table_insert()
+ * only calls malloc when all slabs are full. table_kill() releases
+ * all entries by freeing the slabs.
+ *
  * Authors: Niclas Borlin (niclas@cs.umu.se)
  *	    Adam Dahlgren Lindstrom (dali@cs.umu.se)
  *
@@ -19,24 +24,111 @@
  * Version information:
  *   v1.0 2018-02-06: First public version.
  *   v1.1 2019-03-04: Bugfix in table_remove.
+ *   v1.2 2026-10-16: Added table_empty_with_hash.
+ *   v1.3 2026-10-16: Allocate entries from slabs instead of a dlist.
+ *   v1.4 2026-10-16: Added table_empty_with_allocator.
+ *   v1.5 2026-10-17: Added table_stats and table_stats_reset.
+ *   v1.6 2026-10-17: Added table_memory_usage.
+ *   v1.7 2026-10-17: Use the allocator helpers in util.h.
  */
 
 // ===========INTERNAL DATA TYPES============
 
-struct table {
-	dlist *entries;
-	compare_function *key_cmp_func;
-	free_function key_free_func;
-	free_function value_free_func;
-};
+// Number of entries in the first slab. Each new slab is twice as
+// large as the previous one, up to MAX_SLAB_ENTRIES.
+#define FIRST_SLAB_ENTRIES 16
+#define MAX_SLAB_ENTRIES 4096
 
+/*
+ * A table entry doubles as the list cell. The next pointer links
+ * either the list of entries in the table or the free list.
+ */
 struct table_entry {
+	struct table_entry *next;
 	void *key;
 	void *value;
 };
 
+struct entry_slab {
+	struct entry_slab *next;
+	size_t num_entries;
+	struct table_entry entries[];
+};
+
+struct table {
+	struct table_entry *entries; // First (newest) entry, or NULL.
+	struct table_entry *free_entries; // Recycled entries, or NULL.
+	struct entry_slab *slabs; // Last allocated slab, or NULL.
+	compare_function *key_cmp_func;
+	free_function key_free_func;
+	free_function value_free_func;
+	allocator alloc;
+#ifdef DOA_STATS
+	op_stats stats;
+#endif
+};
+
 // ===========INTERNAL FUNCTION IMPLEMENTATIONS============
 
+/**
+ * add_slab() - Allocate a new slab and put its entries on the free list.
+ * @t: Table to manipulate.
+ *
+ * Returns: Nothing.
+ */
+static void add_slab(table *t)
+{
+	// Double the slab size, up to a maximum.
+	size_t n = FIRST_SLAB_ENTRIES;
+	if (t->slabs != NULL) {
+		n = 2 * t->slabs->num_entries;
+		if (n > MAX_SLAB_ENTRIES) {
+			n = MAX_SLAB_ENTRIES;
+		}
+	}
+	struct entry_slab *slab = mem_alloc(&t->alloc, sizeof(*slab) +
+					    n * sizeof(struct table_entry));
+	STATS_COUNT(t, allocations, 1);
+	slab->num_entries = n;
+	slab->next = t->slabs;
+	t->slabs = slab;
+
+	// Link all new entries into the free list.
+	for (size_t i = 0; i < n; i++) {
+		slab->entries[i].next = t->free_entries;
+		t->free_entries = &slab->entries[i];
+	}
+}
+
+/**
+ * entry_alloc() - Get an unused entry from the arena.
+ * @t: Table to manipulate.
+ *
+ * Returns: Pointer to an unused entry.
+ */
+static struct table_entry *entry_alloc(table *t)
+{
+	if (t->free_entries == NULL) {
+		add_slab(t);
+	}
+	struct table_entry *entry = t->free_entries;
+	t->free_entries = entry->next;
+	return entry;
+}
+
+/**
+ * entry_release() - Return an entry to the arena.
+ * @t: Table to manipulate.
+ * @entry: Entry to release. Must not be linked into the table.
+ *
+ * Returns: Nothing.
+ */
+static void entry_release(table *t, struct table_entry *entry)
+{
+	entry->next = t->free_entries;
+	t->free_entries = entry;
+}
+
 /**
  * table_empty() - Create an empty table.
  * @key_cmp_func: A pointer to a function to be used to compare keys.
@@ -51,10 +143,56 @@ table *table_empty(compare_function *key_cmp_func,
 		   free_function key_free_func,
 		   free_function value_free_func)
 {
-	// Allocate the table header.
-	table *t = calloc(1, sizeof(table));
-	// Create the list to hold the table_entry-ies.
-	t->entries = dlist_empty(free);
+	return table_empty_with_allocator(key_cmp_func, NULL, key_free_func,
+					  value_free_func, NULL);
+}
+
+/**
+ * table_empty_with_hash() - Create an empty table with a key hash function.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: Ignored. This implementation does not hash keys.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_with_hash(compare_function *key_cmp_func,
+			     hash_function *key_hash_func,
+			     free_function key_free_func,
+			     free_function value_free_func)
+{
+	return table_empty_with_allocator(key_cmp_func, key_hash_func,
+					  key_free_func, value_free_func, NULL);
+}
+
+/**
+ * table_empty_with_allocator() - Create an empty table using an allocator.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: Ignored. This implementation does not hash keys.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the table. NULL selects malloc()/free().
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_with_allocator(compare_function *key_cmp_func,
+				  hash_function *key_hash_func,
+				  free_function key_free_func,
+				  free_function value_free_func,
+				  const allocator *alloc)
+{
+	allocator a = use_allocator(alloc);
+
+	// Allocate the table header. The list, free list and slab
+	// list are all empty. The first slab is allocated on insert.
+	table *t = mem_alloc(&a, sizeof(table));
+	STATS_COUNT(t, allocations, 1);
+	t->alloc = a;
 	// Store the key compare function and key/value free functions.
 	t->key_cmp_func = key_cmp_func;
 	t->key_free_func = key_free_func;
@@ -71,7 +209,7 @@ table *table_empty(compare_function *key_cmp_func,
  */
 bool table_is_empty(const table *t)
 {
-	return dlist_is_empty(t->entries);
+	return t->entries == NULL;
 }
 
 /**
@@ -89,14 +227,17 @@ bool table_is_empty(const table *t)
  */
 void table_insert(table *t, void *key, void *value)
 {
-	// Allocate the key/value structure.
-	struct table_entry *entry = malloc(sizeof(struct table_entry));
+	// Get a key/value structure from the arena.
+	struct table_entry *entry = entry_alloc(t);
 
 	// Set the pointers and insert first in the list. This will
 	// cause table_lookup() to find the latest added value.
 	entry->key = key;
 	entry->value = value;
-	dlist_insert(t->entries, entry, dlist_first(t->entries));
+	entry->next = t->entries;
+	t->entries = entry;
+	STATS_COUNT(t, ops, 1);
+	STATS_ADD_SIZE(t, 1);
 }
 
 /**
@@ -110,20 +251,17 @@ void table_insert(table *t, void *key, void *value)
  */
 void *table_lookup(const table *t, const void *key)
 {
+	STATS_COUNT(t, ops, 1);
 	// Iterate over the list. Return first match.
-
-	dlist_pos pos = dlist_first(t->entries);
-
-	while (!dlist_is_end(t->entries, pos)) {
-		// Inspect the table entry
-		struct table_entry *entry = dlist_inspect(t->entries, pos);
+	for (struct table_entry *entry = t->entries; entry != NULL;
+	     entry = entry->next) {
 		// Check if the entry key matches the search key.
+		STATS_COUNT(t, comparisons, 1);
 		if (t->key_cmp_func(entry->key, key) == 0) {
 			// If yes, return the corresponding value pointer.
 			return entry->value;
 		}
-		// Continue with the next position.
-		pos = dlist_next(t->entries, pos);
+		STATS_COUNT(t, traversals, 1);
 	}
 	// No match found. Return NULL.
 	return NULL;
@@ -141,11 +279,9 @@ void *table_lookup(const table *t, const void *key)
  */
 void *table_choose_key(const table *t)
 {
+	STATS_COUNT(t, ops, 1);
 	// Return first key value.
-	dlist_pos pos = dlist_first(t->entries);
-	struct table_entry *entry = dlist_inspect(t->entries, pos);
-
-	return entry->key;
+	return t->entries->key;
 }
 
 /**
@@ -164,15 +300,17 @@ void table_remove(table *t, const void *key)
 	// Will be set if we need to delay a free.
 	void *deferred_ptr = NULL;
 
-	// Start at beginning of the list.
-	dlist_pos pos = dlist_first(t->entries);
+	// Pointer to the link that points to the current entry.
+	struct table_entry **link = &t->entries;
+
+	STATS_COUNT(t, ops, 1);
 
 	// Iterate over the list. Remove any entries with matching keys.
-	while (!dlist_is_end(t->entries, pos)) {
-		// Inspect the table entry
-		struct table_entry *entry = dlist_inspect(t->entries, pos);
+	while (*link != NULL) {
+		struct table_entry *entry = *link;
 
 		// Compare the supplied key with the key of this entry.
+		STATS_COUNT(t, comparisons, 1);
 		if (t->key_cmp_func(entry->key, key) == 0) {
 			// If we have a match, call free on the key
 			// and/or value if given the responsiblity
@@ -191,11 +329,14 @@ void table_remove(table *t, const void *key)
 			if (t->value_free_func != NULL) {
 				t->value_free_func(entry->value);
 			}
-			// Remove the list element itself.
-			pos = dlist_remove(t->entries, pos);
+			// Unlink the entry and return it to the arena.
+			*link = entry->next;
+			entry_release(t, entry);
+			STATS_SUB_SIZE(t, 1);
 		} else {
 			// No match, move on to next element in the list.
-			pos = dlist_next(t->entries, pos);
+			link = &entry->next;
+			STATS_COUNT(t, traversals, 1);
 		}
 	}
 	if (deferred_ptr != NULL) {
@@ -217,27 +358,32 @@ void table_remove(table *t, const void *key)
  */
 void table_kill(table *t)
 {
-	// Iterate over the list. Destroy all elements.
-	dlist_pos pos = dlist_first(t->entries);
-
-	while (!dlist_is_end(t->entries, pos)) {
-		// Inspect the key/value pair.
-		struct table_entry *entry = dlist_inspect(t->entries, pos);
-		// Free key and/or value if given the authority to do so.
-		if (t->key_free_func != NULL) {
-			t->key_free_func(entry->key);
-		}
-		if (t->value_free_func != NULL) {
-			t->value_free_func(entry->value);
+	// The entries only need to be visited if keys and/or values
+	// are to be freed.
+	if (t->key_free_func != NULL || t->value_free_func != NULL) {
+		for (struct table_entry *entry = t->entries; entry != NULL;
+		     entry = entry->next) {
+			// Free key and/or value if given the authority to
+			// do so.
+			if (t->key_free_func != NULL) {
+				t->key_free_func(entry->key);
+			}
+			if (t->value_free_func != NULL) {
+				t->value_free_func(entry->value);
+			}
 		}
-		// Move on to next element.
-		pos = dlist_next(t->entries, pos);
 	}
 
-	// Kill what's left of the list...
-	dlist_kill(t->entries);
+	// Free all slabs. This releases every entry at once...
+	struct entry_slab *slab = t->slabs;
+	while (slab != NULL) {
+		struct entry_slab *next = slab->next;
+		mem_free(&t->alloc, slab, sizeof(*slab) +
+			 slab->num_entries * sizeof(struct table_entry));
+		slab = next;
+	}
 	// ...and the table.
-	free(t);
+	mem_free(&t->alloc, t, sizeof(*t));
 }
 
 /**
@@ -253,12 +399,63 @@ void table_kill(table *t)
 void table_print(const table *t, inspect_callback_pair print_func)
 {
 	// Iterate over all elements. Call print_func on keys/values.
-	dlist_pos pos = dlist_first(t->entries);
-
-	while (!dlist_is_end(t->entries, pos)) {
-		struct table_entry *e = dlist_inspect(t->entries, pos);
+	for (struct table_entry *e = t->entries; e != NULL; e = e->next) {
 		// Call print_func
 		print_func(e->key, e->value);
-		pos = dlist_next(t->entries, pos);
 	}
 }
+
+/**
+ * table_stats() - Return the operation statistics of a table.
+ * @t: Table to inspect.
+ *
+ * Returns: The statistics since the table was created or last reset.
+ *	    All fields are 0 unless compiled with DOA_STATS defined.
+ */
+op_stats table_stats(const table *t)
+{
+	return STATS_GET(t);
+}
+
+/**
+ * table_stats_reset() - Reset the operation statistics of a table.
+ * @t: Table to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void table_stats_reset(table *t)
+{
+	STATS_RESET(t);
+}
+
+/**
+ * table_memory_usage() - Return the memory used by a table.
+ * @t: Table to inspect.
+ *
+ * Takes time proportional to the number of entries.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage table_memory_usage(const table *t)
+{
+	mem_usage m;
+	size_t num_entries = 0;
+	size_t num_used = 0;
+
+	m.header = sizeof(*t);
+	for (struct entry_slab *slab = t->slabs; slab != NULL;
+	     slab = slab->next) {
+		m.header += sizeof(*slab);
+		num_entries += slab->num_entries;
+	}
+	for (struct table_entry *entry = t->entries; entry != NULL;
+	     entry = entry->next) {
+		num_used++;
+	}
+	m.elements = num_used * sizeof(struct table_entry);
+	m.slack = (num_entries - num_used) * sizeof(struct table_entry);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
@@ -20,6 +20,11 @@
  *   v1.0 2018-02-06: First public version.
  *   v1.1 2019-02-21: Second version without dlist/memfreehandler.
  *   v1.2 2019-03-04: Bugfix in table_remove.
+ *   v1.3 2026-10-16: Added table_empty_with_hash.
+ *   v1.4 2026-10-16: Added table_empty_with_allocator.
+ *   v1.5 2026-10-17: Added table_stats and table_stats_reset.
+ *   v1.6 2026-10-17: Added table_memory_usage.
+ *   v1.7 2026-10-17: Use the allocator helpers in util.h.
  */
 
 // ===========INTERNAL DATA TYPES============
@@ -29,6 +34,10 @@ struct table {
 	compare_function *key_cmp_func;
 	free_function key_free_func;
 	free_function value_free_func;
+	allocator alloc;
+#ifdef DOA_STATS
+	op_stats stats;
+#endif
 };
 
 struct table_entry {
@@ -52,10 +61,57 @@ table *table_empty(compare_function *key_cmp_func,
 		   free_function key_free_func,
 		   free_function value_free_func)
 {
+	return table_empty_with_allocator(key_cmp_func, NULL, key_free_func,
+					  value_free_func, NULL);
+}
+
+/**
+ * table_empty_with_hash() - Create an empty table with a key hash function.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: Ignored. This implementation does not hash keys.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_with_hash(compare_function *key_cmp_func,
+			     hash_function *key_hash_func,
+			     free_function key_free_func,
+			     free_function value_free_func)
+{
+	return table_empty_with_allocator(key_cmp_func, key_hash_func,
+					  key_free_func, value_free_func, NULL);
+}
+
+/**
+ * table_empty_with_allocator() - Create an empty table using an allocator.
+ * @key_cmp_func: A pointer to a function to be used to compare keys.
+ * @key_hash_func: Ignored. This implementation does not hash keys.
+ * @key_free_func: A pointer to a function (or NULL) to be called to
+ *		   de-allocate memory for keys on remove/kill.
+ * @value_free_func: A pointer to a function (or NULL) to be called to
+ *		     de-allocate memory for values on remove/kill.
+ * @alloc: Allocator (or NULL) used for all memory used internally by
+ *	   the table. NULL selects malloc()/free().
+ *
+ * Returns: Pointer to a new table.
+ */
+table *table_empty_with_allocator(compare_function *key_cmp_func,
+				  hash_function *key_hash_func,
+				  free_function key_free_func,
+				  free_function value_free_func,
+				  const allocator *alloc)
+{
+	allocator a = use_allocator(alloc);
+
 	// Allocate the table header.
-	table *t = calloc(1, sizeof(table));
+	table *t = mem_alloc(&a, sizeof(table));
+	STATS_COUNT(t, allocations, 1);
+	t->alloc = a;
 	// Create the list to hold the table_entry-ies.
-	t->entries = dlist_empty(NULL);
+	t->entries = dlist_empty_with_allocator(NULL, &t->alloc);
 	// Store the key compare function and key/value free functions.
 	t->key_cmp_func = key_cmp_func;
 	t->key_free_func = key_free_func;
@@ -91,13 +147,16 @@ bool table_is_empty(const table *t)
 void table_insert(table *t, void *key, void *value)
 {
 	// Allocate the key/value structure.
-	struct table_entry *entry = malloc(sizeof(struct table_entry));
+	struct table_entry *entry = mem_alloc(&t->alloc, sizeof(*entry));
+	STATS_COUNT(t, allocations, 1);
 
 	// Set the pointers and insert first in the list. This will
 	// cause table_lookup() to find the latest added value.
 	entry->key = key;
 	entry->value = value;
 	dlist_insert(t->entries, entry, dlist_first(t->entries));
+	STATS_COUNT(t, ops, 1);
+	STATS_ADD_SIZE(t, 1);
 }
 
 /**
@@ -111,6 +170,7 @@ void table_insert(table *t, void *key, void *value)
  */
 void *table_lookup(const table *t, const void *key)
 {
+	STATS_COUNT(t, ops, 1);
 	// Iterate over the list. Return first match.
 
 	dlist_pos pos = dlist_first(t->entries);
@@ -119,6 +179,7 @@ void *table_lookup(const table *t, const void *key)
 		// Inspect the table entry
 		struct table_entry *entry = dlist_inspect(t->entries, pos);
 		// Check if the entry key matches the search key.
+		STATS_COUNT(t, comparisons, 1);
 		if (t->key_cmp_func(entry->key, key) == 0) {
 			// If yes, return the corresponding value pointer.
 			return entry->value;
@@ -142,6 +203,7 @@ void *table_lookup(const table *t, const void *key)
  */
 void *table_choose_key(const table *t)
 {
+	STATS_COUNT(t, ops, 1);
 	// Return first key value.
 	dlist_pos pos = dlist_first(t->entries);
 	struct table_entry *entry = dlist_inspect(t->entries, pos);
@@ -165,6 +227,7 @@ void table_remove(table *t, const void *key)
 	// Will be set if we need to delay a free.
 	void *deferred_ptr = NULL;
 
+	STATS_COUNT(t, ops, 1);
 	// Start at beginning of the list.
 	dlist_pos pos = dlist_first(t->entries);
 
@@ -174,6 +237,7 @@ void table_remove(table *t, const void *key)
 		struct table_entry *entry = dlist_inspect(t->entries, pos);
 
 		// Compare the supplied key with the key of this entry.
+		STATS_COUNT(t, comparisons, 1);
 		if (t->key_cmp_func(entry->key, key) == 0) {
 			// If we have a match, call free on the key
 			// and/or value if given the responsiblity
@@ -195,7 +259,8 @@ void table_remove(table *t, const void *key)
 			// Remove the list element itself.
 			pos = dlist_remove(t->entries, pos);
 			// Deallocate the table entry structure.
-			free(entry);
+			mem_free(&t->alloc, entry, sizeof(*entry));
+			STATS_SUB_SIZE(t, 1);
 		} else {
 			// No match, move on to next element in the list.
 			pos = dlist_next(t->entries, pos);
@@ -236,13 +301,13 @@ void table_kill(table *t)
 		// Move on to next element.
 		pos = dlist_next(t->entries, pos);
 		// Deallocate the table entry structure.
-		free(entry);
+		mem_free(&t->alloc, entry, sizeof(*entry));
 	}
 
 	// Kill what's left of the list...
 	dlist_kill(t->entries);
 	// ...and the table.
-	free(t);
+	mem_free(&t->alloc, t, sizeof(*t));
 }
 
 /**
@@ -267,3 +332,63 @@ void table_print(const table *t, inspect_callback_pair print_func)
 		pos = dlist_next(t->entries, pos);
 	}
 }
+
+/**
+ * table_stats() - Return the operation statistics of a table.
+ * @t: Table to inspect.
+ *
+ * Returns: The statistics since the table was created or last reset.
+ *	    All fields are 0 unless compiled with DOA_STATS defined.
+ */
+op_stats table_stats(const table *t)
+{
+	op_stats s = STATS_GET(t);
+#ifdef DOA_STATS
+	// The entries are passed with dlist_next(), so the traversals
+	// are counted by the list, as are the allocations of its cells.
+	op_stats ls = dlist_stats(t->entries);
+	s.traversals += ls.traversals;
+	s.allocations += ls.allocations;
+#endif
+	return s;
+}
+
+/**
+ * table_stats_reset() - Reset the operation statistics of a table.
+ * @t: Table to manipulate.
+ *
+ * Sets all counters to 0 and the peak size to the current size.
+ *
+ * Returns: Nothing.
+ */
+void table_stats_reset(table *t)
+{
+	STATS_RESET(t);
+	dlist_stats_reset(t->entries);
+}
+
+/**
+ * table_memory_usage() - Return the memory used by a table.
+ * @t: Table to inspect.
+ *
+ * Takes time proportional to the number of entries.
+ *
+ * Returns: The memory usage in bytes, see mem_usage in util.h.
+ */
+mem_usage table_memory_usage(const table *t)
+{
+	// Each element is a table entry and the list cell that points
+	// to it.
+	mem_usage m = dlist_memory_usage(t->entries);
+	size_t num_entries = 0;
+
+	dlist_pos pos = dlist_first(t->entries);
+	while (!dlist_is_end(t->entries, pos)) {
+		num_entries++;
+		pos = dlist_next(t->entries, pos);
+	}
+	m.header += sizeof(*t);
+	m.elements += num_entries * sizeof(struct table_entry);
+	m.total = m.header + m.elements + m.slack;
+	return m;
+}
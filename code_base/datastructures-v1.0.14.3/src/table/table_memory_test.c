@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <table.h>
+
+/*
+ * Test program for table_memory_usage(). The table is created with an
+ * allocator that keeps track of the number of bytes allocated but not
+ * yet freed. After each round of inserts and removes, the total from
+ * table_memory_usage() must equal that number, and the header, element
+ * and slack sizes must add up to the total.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-17"
+
+// Number of different keys.
+#define KEYS 5000
+
+// Number of bytes allocated and not freed.
+static size_t live_bytes = 0;
+
+// Print an error message and exit.
+static void fail(const char *msg)
+{
+	fprintf(stderr, "FAIL: %s\n", msg);
+	exit(EXIT_FAILURE);
+}
+
+// Allocate zeroed memory and count it.
+static void *count_alloc(void *context, size_t size)
+{
+	live_bytes += size;
+	return calloc(1, size);
+}
+
+// Resize memory and count the difference.
+static void *count_realloc(void *context, void *ptr, size_t old_size,
+			   size_t new_size)
+{
+	live_bytes += new_size - old_size;
+	return realloc(ptr, new_size);
+}
+
+// Free memory and count it.
+static void count_free(void *context, void *ptr, size_t size)
+{
+	live_bytes -= size;
+	free(ptr);
+}
+
+// Compare two keys (int *).
+static int compare_ints(const void *k1, const void *k2)
+{
+	int key1 = *(const int *)k1;
+	int key2 = *(const int *)k2;
+
+	return (key1 > key2) - (key1 < key2);
+}
+
+// Hash a key (int *).
+static size_t hash_int(const void *k)
+{
+	return (size_t)*(const int *)k * 2654435761u;
+}
+
+// Check the memory usage of t against the allocated bytes.
+static void check(const table *t, int n)
+{
+	mem_usage m = table_memory_usage(t);
+	if (m.total != live_bytes) {
+		fprintf(stderr, "n=%d: total %zu, allocated %zu.\n", n,
+			m.total, live_bytes);
+		fail("Total differs from the allocated bytes.");
+	}
+	if (m.header + m.elements + m.slack != m.total) {
+		fail("Header, elements and slack do not add up to total.");
+	}
+	if ((n == 0) != (m.elements == 0)) {
+		fail("Elements is 0 for a non-empty table or vice versa.");
+	}
+}
+
+int main(void)
+{
+	printf("%s, %s %s: Test of table memory usage.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	allocator alloc = { count_alloc, count_realloc, count_free, NULL };
+	int keys[KEYS];
+	for (int i = 0; i < KEYS; i++) {
+		keys[i] = i;
+	}
+
+	table *t = table_empty_with_allocator(compare_ints, hash_int, NULL,
+					      NULL, &alloc);
+	check(t, 0);
+
+	// Grow the table in steps, then remove every other key and
+	// finally the rest.
+	int n = 0;
+	for (int step = 1; n < KEYS; step *= 2) {
+		for (int i = 0; i < step && n < KEYS; i++) {
+			table_insert(t, &keys[n], &keys[n]);
+			n++;
+		}
+		check(t, n);
+	}
+	for (int i = 0; i < KEYS; i += 2) {
+		table_remove(t, &keys[i]);
+		n--;
+	}
+	check(t, n);
+	for (int i = 1; i < KEYS; i += 2) {
+		table_remove(t, &keys[i]);
+		n--;
+	}
+	check(t, n);
+
+	table_kill(t);
+	if (live_bytes != 0) {
+		fail("Memory left after table_kill().");
+	}
+
+	printf("SUCCESS: Implementation passed all tests. Normal exit.\n\n");
+	return 0;
+}
@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <table.h>
+
+/*
+ * Minimum working example for table.c. Creates a (string, integer)
+ * table with a key hash function, inserts 4 key-value pairs into it,
+ * including one duplicate, and makes two lookups. The responsibility
+ * to deallocate the key-value pairs is handed over to the table.
+ *
+ * The hash function is only used by hashed table implementations,
+ * e.g. hashtable.c. Other implementations ignore it.
+ *
+ * Version information:
+ *   v1.0  2026-10-16: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-16"
+
+// Create a dynamic copy of the string str.
+static char* make_string_copy(const char *str)
+{
+	char *copy = calloc(strlen(str) + 1, sizeof(char));
+	strcpy(copy, str);
+	return copy;
+}
+
+// Create a dynamic copy of the integer i.
+static int* make_int_copy(int i)
+{
+	int *copy = malloc(sizeof(int));
+	*copy = i;
+	return copy;
+}
+
+// Interpret the supplied key and value pointers and print their content.
+static void print_string_int_pair(const void *key, const void *value)
+{
+	const char *s=key;
+	const int *v=value;
+	printf("[%s, %d]\n", s, *v);
+}
+
+// Compare two keys (char *).
+static int compare_strings(const void *k1, const void *k2)
+{
+	return strcmp(k1, k2);
+}
+
+// Hash a key (char *) using the djb2 string hash.
+static size_t hash_string(const void *k)
+{
+	const unsigned char *s = k;
+	size_t h = 5381;
+
+	while (*s != '\0') {
+		h = h * 33 + *s;
+		s++;
+	}
+	return h;
+}
+
+int main(void)
+{
+	printf("%s, %s %s: Create (string, integer) table with a hash function.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+
+	// Delegate the deallocation responsibility to the table.
+	table *t = table_empty_with_hash(compare_strings, hash_string,
+					 free, free);
+
+	table_insert(t, make_string_copy("Umea"), make_int_copy(90187));
+	table_insert(t, make_string_copy("Kiruna"), make_int_copy(98185));
+	table_insert(t, make_string_copy("Lulea"), make_int_copy(97187));
+
+	printf("Table after inserting 3 pairs:\n");
+	table_print(t, print_string_int_pair);
+
+	const int *v=table_lookup(t, "Umea");
+	printf("Lookup of postal code for %s: %d.\n", "Umea", *v);
+
+	table_insert(t, make_string_copy("Umea"), make_int_copy(90184));
+
+	printf("Table after adding a duplicate:\n");
+	table_print(t, print_string_int_pair);
+
+	v=table_lookup(t, "Umea");
+	printf("Lookup of postal code for %s: %d.\n", "Umea", *v);
+
+	// Kill what is left of the table.
+	table_kill(t);
+
+	printf("\nNormal exit.\n\n");
+	return 0;
+}
@@ -0,0 +1,162 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <table.h>
+
+/*
+ * Test program for table_stats() and table_stats_reset(). Random
+ * sequences of insert, lookup and remove are run on a table with int
+ * keys. The test counts the calls of the key compare function itself
+ * and checks them against the comparisons reported by the table, and
+ * checks the operations, the size and the peak size the same way.
+ *
+ * Compiled with DOA_STATS defined, see the Makefile. Without it, the
+ * test checks that all statistics are 0.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ */
+
+#define VERSION "v1.0"
+#define VERSION_DATE "2026-10-17"
+
+// Number of different keys.
+#define KEYS 200
+
+// Number of random operations.
+#define OPERATIONS 20000
+
+// Number of calls of compare_ints().
+static unsigned long compare_calls = 0;
+
+// Print an error message and exit.
+static void fail(const char *msg)
+{
+	fprintf(stderr, "FAIL: %s\n", msg);
+	exit(EXIT_FAILURE);
+}
+
+// Compare two keys (int *) and count the call.
+static int compare_ints(const void *k1, const void *k2)
+{
+	int key1 = *(const int *)k1;
+	int key2 = *(const int *)k2;
+
+	compare_calls++;
+	return (key1 > key2) - (key1 < key2);
+}
+
+// Hash a key (int *).
+static size_t hash_int(const void *k)
+{
+	return (size_t)*(const int *)k * 2654435761u;
+}
+
+// Check the statistics of t against the expected values.
+static void check(const table *t, unsigned long ops, size_t size,
+		  size_t peak_size)
+{
+	op_stats s = table_stats(t);
+#ifdef DOA_STATS
+	if (s.ops != ops) {
+		fail("Wrong number of operations.");
+	}
+	if (s.comparisons != compare_calls) {
+		fail("Comparisons differ from calls of the compare function.");
+	}
+	if (s.size != size) {
+		fail("Wrong size.");
+	}
+	if (s.peak_size != peak_size) {
+		fail("Wrong peak size.");
+	}
+#else
+	(void)ops;
+	(void)size;
+	(void)peak_size;
+	if (s.ops != 0 || s.comparisons != 0 || s.traversals != 0 ||
+	    s.allocations != 0 || s.size != 0 || s.peak_size != 0) {
+		fail("Statistics are not 0 without DOA_STATS.");
+	}
+#endif
+}
+
+int main(void)
+{
+	printf("%s, %s %s: Test of table statistics.\n",
+	       __FILE__, VERSION, VERSION_DATE);
+	printf("Code base version %s.\n\n", CODE_BASE_VERSION);
+#ifdef DOA_STATS
+	printf("Compiled with DOA_STATS.\n");
+#else
+	printf("Compiled without DOA_STATS.\n");
+#endif
+
+	int keys[KEYS];
+	int in[KEYS] = { 0 };
+	for (int i = 0; i < KEYS; i++) {
+		keys[i] = i;
+	}
+
+	table *t = table_empty_with_hash(compare_ints, hash_int, NULL, NULL);
+	unsigned long ops = 0;
+	size_t size = 0;
+	size_t peak_size = 0;
+	check(t, ops, size, peak_size);
+#ifdef DOA_STATS
+	if (table_stats(t).allocations == 0) {
+		fail("No allocations counted for a new table.");
+	}
+#endif
+
+	srand(17);
+	for (int n = 0; n < OPERATIONS; n++) {
+		int i = rand() % KEYS;
+		switch (rand() % 3) {
+		case 0:
+			// Only insert new keys, since the list based tables
+			// store duplicates.
+			if (!in[i]) {
+				table_insert(t, &keys[i], &keys[i]);
+				in[i] = 1;
+				size++;
+			} else if (table_lookup(t, &keys[i]) == NULL) {
+				fail("Inserted key not found.");
+			}
+			break;
+		case 1:
+			if ((table_lookup(t, &keys[i]) != NULL) != in[i]) {
+				fail("Wrong lookup result.");
+			}
+			break;
+		default:
+			table_remove(t, &keys[i]);
+			if (in[i]) {
+				in[i] = 0;
+				size--;
+			}
+			break;
+		}
+		ops++;
+		if (size > peak_size) {
+			peak_size = size;
+		}
+		check(t, ops, size, peak_size);
+	}
+
+	// After a reset, only the size is kept.
+	table_stats_reset(t);
+	compare_calls = 0;
+	check(t, 0, size, size);
+#ifdef DOA_STATS
+	op_stats s = table_stats(t);
+	if (s.traversals != 0 || s.allocations != 0) {
+		fail("Counters are not 0 after reset.");
+	}
+#endif
+
+	table_kill(t);
+
+	printf("\nSUCCESS: Implementation passed all tests. Normal exit.\n\n");
+	return 0;
+}
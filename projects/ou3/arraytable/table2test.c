@@ -29,10 +29,17 @@
  *                 Bugfix in get_skewed_lookup_speed.
  * 2019-02-12 v1.8 Reverted back to single-parameter version v1.6.
  * 2019-04-17 v1.9 Added -m for machine-readable results.
+ * 2026-10-17 v1.10 Timing now uses bench.h of the code base: the time
+ *                 of each operation is measured in ns, and the tables
+ *                 show percentiles and operations per second. The
+ *                 setup of each phase is no longer timed. Added -w and
+ *                 -r for the number of warm-up and measured repetitions.
+ * 2026-10-17 v1.11 Added -p to also count cycles, instructions, cache,
+ *                 branch and TLB misses per operation of each phase.
 */
 
-#define VERSION "v1.9"
-#define VERSION_DATE "2019-04-17"
+#define VERSION "v1.11"
+#define VERSION_DATE "2026-10-17"
 
 /*
  * Correctness testing algorithm:
@@ -63,12 +70,17 @@
  *    table is empty.
  *
  * There is also a module measuring time for insertions, lookups etc.
+ * The time of each operation is measured with the bench harness, and
+ * the median, 99th and 99.9th percentile times are reported. With -p,
+ * the hardware counters of the processor are also reported per
+ * operation, e.g. to see whether a phase is faster because of fewer
+ * instructions or fewer cache misses.
  * */
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <sys/time.h>
+#include <bench.h>
 #include "table.h"
 
 // Maximum size of the table to generate
@@ -122,18 +134,6 @@ int *int_ptr_from_int(int i)
         return ip;
 }
 
-/**
- * get_milliseconds() - Return the current time-of-day in milliseconds.
- *
- * Returns: The current time-of-day in milliseconds.
- */
-unsigned long get_milliseconds()
-{
-        struct timeval tv;
-        gettimeofday(&tv, 0);
-        return (unsigned long)(tv.tv_sec*1000 + tv.tv_usec/1000);
-}
-
 /**
  * int_compare() - Compare to integers via pointers.
  * @ip1, @ip2: Pointers to integers to be compared.
@@ -211,150 +211,150 @@ void insert_values(table *t, int *keys, int *values, int n)
 }
 
 
-/* Measures time taken to fill a table with values
- *    table - the table to fill
- *    keys - a list of keys to use
- *    values - a list of values to use
- *    n - the number of items to insert
- *    machine_table - true if we should output a machine-readable table
+/* Data shared by the functions of the timed phases.
+ *    t - the table being measured
+ *    keys - 2n unique keys, the first n are inserted into the table
+ *    values - the values to insert with the first n keys
+ *    order - the index in keys of the key used by the i:th operation
+ *    n - the number of items in the table
+ */
+struct phase_data {
+        table *t;
+        int *keys;
+        int *values;
+        int *order;
+        int n;
+};
+
+/* Setup for the insert phase: create an empty table.
  */
-void get_insert_speed(table *t, int *keys, int *values, int n,
-		bool machine_table)
+void setup_empty(void *arg)
 {
-        unsigned long start;
-        unsigned long end;
-
-        // Insert all items
-        start = get_milliseconds();
-        insert_values(t,keys,values,n);
-        end =  get_milliseconds();
-	if (machine_table) {
-		printf("%d, %d, %lu\n",1,n,end-start);
-	} else {
-		printf("Insert %5d items                   : ", n);
-		printf("%lu ms.\n",end-start);
-	}
+        struct phase_data *d = arg;
+        d->t = table_empty(int_compare, free, free);
 }
 
-/* Measures time taken to do n lookups of existing keys in a table
- *    t - the table to fill
- *    keys - a list of keys to use
- *    values - a list of values to use
- *    n - the number of lookups to perform
- *    machine_table - true if we should output a machine-readable table
+/* Setup for the remove phase: fill a table and remove all keys, not in
+ * the same order as they were inserted.
  */
-void get_random_existing_lookup_speed(table *t, int *keys, int n,
-				bool machine_table)
+void setup_remove(void *arg)
 {
-        unsigned long start;
-        unsigned long end;
+        struct phase_data *d = arg;
+        d->t = table_empty(int_compare, free, free);
+        insert_values(d->t, d->keys, d->values, d->n);
+        create_random_sample(d->order, d->n);
+}
 
-        start = get_milliseconds();
-        for(int i=0;i<n;i++) {
-                // The existing keys in the table are stored in index
-                // [0, TABLESIZE-1] in the key-array
-                int pos = rand()%n;
-                table_lookup(t,&keys[pos]);
+/* Setup for lookups of non-existing keys. We know the existing keys
+ * have indexes in [0, n-1], so if we look up keys in the area [n, 2n-1]
+ * they will not exist.
+ */
+void setup_non_existing(void *arg)
+{
+        struct phase_data *d = arg;
+        d->t = table_empty(int_compare, free, free);
+        insert_values(d->t, d->keys, d->values, d->n);
+        for(int i=0;i<d->n;i++) {
+                d->order[i] = d->n + i;
         }
-        end = get_milliseconds();
-	if (machine_table) {
-		printf("%d, %d, %lu\n",4,n,end-start);
-	} else {
-		printf("%5d random lookups                 : ",n );
-		printf("%lu ms.\n", end-start);
-	}
 }
 
-/* Measures time taken to do n lookups of non-existing keys in a table
- *    t - the table to fill
- *    keys - a list of keys to use
- *    values - a list of values to use
- *    n - the number of lookups to perform
- *    machine_table - true if we should output a machine-readable table
+/* Setup for random lookups of existing keys.
  */
-void get_random_non_existing_lookup_speed(table *t, int *keys, int n,
-				bool machine_table)
+void setup_random(void *arg)
 {
-        unsigned long start;
-        unsigned long end;
-
-        // We know the exisiting keys have indexes in [0, TABLESIZE-1]
-        // so if we try to lookup keys in the area [TABLESIZE,
-        // 2*TABLESIZE-1] they will not exist
-        start =  get_milliseconds();
-        int startindex = n;
-        for(int i=0;i<n;i++){
-                table_lookup(t,&keys[startindex + (i%n)]);
+        struct phase_data *d = arg;
+        d->t = table_empty(int_compare, free, free);
+        insert_values(d->t, d->keys, d->values, d->n);
+        for(int i=0;i<d->n;i++) {
+                d->order[i] = rand()%d->n;
         }
-        end = get_milliseconds();
-	if (machine_table) {
-		printf("%d, %d, %lu\n",3,n,end-start);
-	} else {
-		printf("%5d lookups with non-existent keys : ", n);
-		printf("%lu ms.\n" ,end-start);
-	}
 }
 
-/* Measures time taken to do n lookups of existing keys in a table when the
- * keys chosen are from only a part of all available keys
- *    t - the table to fill
- *    keys - a list of keys to use
- *    values - a list of values to use
- *    n - the number of lookups to perform
- *    machine_table - true if we should output a machine-readable table
+/* Setup for lookups skewed to a certain range (in this case the middle
+ * third of the keys used).
  */
-void get_skewed_lookup_speed(table *t, int *keys, int n, bool machine_table)
+void setup_skewed(void *arg)
 {
-        unsigned long start;
-        unsigned long end;
-
-        // Lookup skewed to a certain range (in this case the middle third
-        // of the keys used)
-        int startindex = n/3;
-        int stopindex = n*2/3;
+        struct phase_data *d = arg;
+        int startindex = d->n/3;
+        int stopindex = d->n*2/3;
         int partition = stopindex - startindex + 1;
 
-        start =  get_milliseconds();
-        for(int i=0;i<n;i++) {
-                int pos = rand()%partition + startindex;
-                table_lookup(t,&keys[pos]);
+        d->t = table_empty(int_compare, free, free);
+        insert_values(d->t, d->keys, d->values, d->n);
+        for(int i=0;i<d->n;i++) {
+                d->order[i] = rand()%partition + startindex;
         }
-        end = get_milliseconds();
-	if (machine_table) {
-		printf("%d, %d, %lu\n",5,n,end-start);
-	} else {
-		printf("%5d skewed lookups                 : " ,n);
-		printf("%lu ms.\n" ,end-start);
-	}
 }
 
-/* Measures time taken remove all keys from a table
- *    t - the table to fill
- *    keys - a list of keys to use
- *    values - a list of values to use
- *    n - number of items in the table
- *    machine_table - true if we should output a machine-readable table
+/* Teardown for all phases: kill the table.
  */
-void get_remove_speed(table *t, int *keys, int n, bool machine_table)
+void teardown_table(void *arg)
 {
-        unsigned long start;
-        unsigned long end;
+        struct phase_data *d = arg;
+        table_kill(d->t);
+}
 
-        // Remove all items, not in the same order as they were inserted
-        start = get_milliseconds();
-        random_shuffle(keys, n);  // to get a new order of the keys
-        for(int i=0;i<n;i++) {
-                table_remove(t,&keys[i]);
-        }
-        end = get_milliseconds();
-	if (machine_table) {
-		printf("%d, %d, %lu\n",2,n,end-start);
-	} else {
-		printf("Remove all items                     : ");
-		printf("%lu ms.\n" ,end-start);
-	}
+/* Timed operation: insert the i:th key and value.
+ */
+void op_insert(void *arg, int i)
+{
+        struct phase_data *d = arg;
+        table_insert(d->t, int_ptr_from_int(d->keys[i]),
+                     int_ptr_from_int(d->values[i]));
+}
+
+/* Timed operation: remove the i:th key in order.
+ */
+void op_remove(void *arg, int i)
+{
+        struct phase_data *d = arg;
+        table_remove(d->t, &d->keys[d->order[i]]);
 }
 
+/* Timed operation: look up the i:th key in order.
+ */
+void op_lookup(void *arg, int i)
+{
+        struct phase_data *d = arg;
+        table_lookup(d->t, &d->keys[d->order[i]]);
+}
+
+/* Measures the time taken by the operations of a phase and prints it.
+ *    id - the number of the phase in the machine-readable table
+ *    label - the name of the phase
+ *    p - the phase
+ *    opt - the number of warm-up and measured repetitions
+ *    d - the data of the phase
+ *    machine_table - true if we should output a machine-readable table
+ *
+ * The machine-readable table has the phase number, the number of items,
+ * the time in ms per repetition, the p50, p99 and p99.9 time per
+ * operation in ns and the number of operations per second. With -p, it
+ * also has the cycles, instructions, L1d, LLC, branch and dTLB misses
+ * per operation, nan for counters that could not be read.
+ */
+void measure_phase(int id, const char *label, const bench_phase *p,
+                   const bench_options *opt, struct phase_data *d,
+                   bool machine_table)
+{
+        bench_result r = bench_run(p, opt, d);
+        if (machine_table) {
+                printf("%d, %d, %.3f, %.1f, %.1f, %.1f, %.0f", id, d->n,
+                       r.total/opt->repetitions/1e6, r.p50, r.p99, r.p999,
+                       r.ops_per_sec);
+                if (opt->counters != 0) {
+                        for (int c = 0; c < BENCH_COUNTERS; c++) {
+                                printf(", %.2f", r.counters[c]);
+                        }
+                }
+                printf("\n");
+        } else {
+                bench_print(stdout, label, &r);
+                bench_print_counters(stdout, &r);
+        }
+}
 /* Tests if isempty returns true directly after a table is created.
  */
 void test_isempty(){
@@ -698,45 +698,54 @@ void correctness_test()
 }
 
 /* Tests the speed of a table using random numbers. First a number of
- * elements are inserted. Second a random lookup among the elements are
- * done followed by a skewed lookup (where a subset of the keys are
- * looked up more frequently). Finally all elements are removed.
+ * elements are inserted. Second all elements are removed. Then lookups
+ * of non-existing keys are done, followed by a random lookup among the
+ * elements and a skewed lookup (where a subset of the keys are looked
+ * up more frequently). Each phase starts from a newly built table and
+ * is repeated as given by opt.
  */
-void speed_test(int n,bool machine_table)
+void speed_test(int n, const bench_options *opt, bool machine_table)
 {
         int randomsize = 2*n; // To make it easier testing
                               // non-existing keys later
-        int *keys = malloc(randomsize*sizeof(int));
-        int *values = malloc(randomsize*sizeof(int));
-        create_random_sample(keys, randomsize);
-        create_random_sample(values, n);
+        struct phase_data d;
+        d.keys = malloc(randomsize*sizeof(int));
+        d.values = malloc(randomsize*sizeof(int));
+        d.order = malloc(n*sizeof(int));
+        d.n = n;
+        create_random_sample(d.keys, randomsize);
+        create_random_sample(d.values, n);
+
+        bench_phase insert_phase = { "insert", n, setup_empty, op_insert,
+                                     teardown_table };
+        bench_phase remove_phase = { "remove", n, setup_remove, op_remove,
+                                     teardown_table };
+        bench_phase non_existing_phase = { "non-existing", n,
+                                           setup_non_existing, op_lookup,
+                                           teardown_table };
+        bench_phase random_phase = { "random", n, setup_random, op_lookup,
+                                     teardown_table };
+        bench_phase skewed_phase = { "skewed", n, setup_skewed, op_lookup,
+                                     teardown_table };
+        char label[64];
 
-        table *t = table_empty(int_compare, free, free);
-        get_insert_speed(t, keys, values, n, machine_table);
-        table_kill(t);
-
-        t = table_empty(int_compare, free, free);
-        insert_values(t,keys,values,n);
-        get_remove_speed(t, keys, n, machine_table);
-        table_kill(t);
-
-        t = table_empty(int_compare, free, free);
-        insert_values(t,keys,values,n);
-        get_random_non_existing_lookup_speed(t, keys, n, machine_table);
-        table_kill(t);
-
-        t = table_empty(int_compare, free, free);
-        insert_values(t,keys,values,n);
-        get_random_existing_lookup_speed(t, keys, n, machine_table);
-        table_kill(t);
-
-        t = table_empty(int_compare, free, free);
-        insert_values(t,keys,values,n);
-        get_skewed_lookup_speed(t, keys, n, machine_table);
-        table_kill(t);
-
-        free(keys);
-        free(values);
+        if (!machine_table) {
+                bench_print_header(stdout);
+        }
+        sprintf(label, "Insert %5d items", n);
+        measure_phase(1, label, &insert_phase, opt, &d, machine_table);
+        measure_phase(2, "Remove all items", &remove_phase, opt, &d,
+                      machine_table);
+        sprintf(label, "%5d lookups with non-existent keys", n);
+        measure_phase(3, label, &non_existing_phase, opt, &d, machine_table);
+        sprintf(label, "%5d random lookups", n);
+        measure_phase(4, label, &random_phase, opt, &d, machine_table);
+        sprintf(label, "%5d skewed lookups", n);
+        measure_phase(5, label, &skewed_phase, opt, &d, machine_table);
+
+        free(d.keys);
+        free(d.values);
+        free(d.order);
 }
 
 #define NAME "tabletest"
@@ -745,6 +754,7 @@ int main(int argc,char **argv)
 {
 	bool do_test=true; // Should we run the testing code?
 	bool machine_table=false; // Should we output a machine-readable table?
+	bench_options opt=bench_default_options(); // Repetitions per phase.
         int n=-1;
 
         fprintf(stderr,NAME " " VERSION " (" VERSION_DATE ")\n");
@@ -760,6 +770,23 @@ int main(int argc,char **argv)
 			case 't':
 				machine_table=true;
 				break;
+			case 'p':
+				opt.counters=BENCH_ALL_COUNTERS;
+				break;
+			case 'w':
+			case 'r':
+				// Followed by a count.
+				if (i+1>=argc || atoi(argv[i+1])<(s[1]=='r')) {
+					fprintf(stderr,"%s: Bad count for %s.\n",
+						argv[0],s);
+					exit(EXIT_FAILURE);
+				}
+				if (s[1]=='w') {
+					opt.warmup=atoi(argv[++i]);
+				} else {
+					opt.repetitions=atoi(argv[++i]);
+				}
+				break;
 			default:
 				fprintf(stderr,"%s: Bad switch: %s.\n",
 					argv[0],s);
@@ -773,11 +800,15 @@ int main(int argc,char **argv)
 	}
 
         if (n<0) {
-                fprintf(stderr,"Usage:\n\t%s [-n] [-t] n\n"
+                fprintf(stderr,"Usage:\n\t%s [-n] [-t] [-p] [-w w] [-r r] n\n"
 			"\twhere n is an integer from 1 to %d.\n\n"
 			"\tUse -n (no-test) to skip the testing.\n"
-			"\tUse -t (table) to output a machine-readable table with the timings.\n",
-			argv[0],TABLESIZE);
+			"\tUse -t (table) to output a machine-readable table with the timings.\n"
+			"\tUse -p (perf) to also count cycles, instructions, cache, branch and\n"
+			"\t    TLB misses per operation (Linux only).\n"
+			"\tUse -w to run each timed phase w times before measuring (default %d).\n"
+			"\tUse -r to measure each timed phase r times (default %d).\n",
+			argv[0],TABLESIZE,opt.warmup,opt.repetitions);
 		exit(EXIT_FAILURE);
 	}
 	if (n<1 || n>TABLESIZE) {
@@ -785,13 +816,17 @@ int main(int argc,char **argv)
                         "allowed range 1-%d.\n",n,TABLESIZE);
                 exit(EXIT_FAILURE);
         }
+	if (opt.counters!=0 && bench_counters_available(opt.counters)==0) {
+		fprintf(stderr,"Warning: Hardware counters are not available, "
+			"only the time is measured.\n");
+	}
 	if (do_test) {
 		printf("Testing...\n");
 		correctness_test();		
 		printf("All correctness tests succeeded!\n\n");
 	}
         /*getchar();*/
-        speed_test(n,machine_table);
+        speed_test(n,&opt,machine_table);
         if (!machine_table) {
 		printf("Test completed.\n");
 	}
@@ -10,6 +10,12 @@
  *
  * Version information:
  *	v1.0 2024-04-24 first public version
+ *	v1.1 2026-10-16 added hashed label index
+ *	v1.2 2026-10-16 added neighbour iteration
+ *	v1.3 2026-10-16 added node index functions
+ *	v1.4 2026-10-17 added component index
+ *	v1.5 2026-10-17 added edge weights
+ *	v1.6 2026-10-17 the label index is shared, see label_index.h
  */
 
 #include <stdio.h>
@@ -20,6 +26,11 @@
 #include <array_1d.h>
 #include <dlist.h>
 #include "graph.h"
+#include "union_find.h"
+#include "label_index.h"
+
+// Node at index i of the node array of graph g.
+#define NODE_AT(g, i) ((node *)array_1d_inspect_value((g)->nodes, (i)))
 
 // ===========INTERNAL DATA TYPES============
 
@@ -33,22 +44,41 @@
  *
  * Nodes are positioned at the same index in both the array and matrix in
  * order to keep track of them when inserting edges
+ *
+ * "index" is a hash table from node label to node index, see
+ * label_index.h, so that nodes are found without comparing labels
+ * with all nodes.
+ *
+ * "components" holds the weakly connected components of the graph by
+ * node index. It is updated by graph_insert_node() and
+ * graph_insert_edge().
+ *
+ * "weights" holds the weight of the edge from node i to node j at
+ * weights[i * size + j], where "size" is the size of each dimension of
+ * the matrix. It is NULL until an edge with a weight other than 1 is
+ * inserted, see graph_insert_weighted_edge().
  */
 struct graph
 {
 	array_2d *matrix;
 	array_1d *nodes;
 	int num_nodes;
+	label_index index;
+	union_find *components;
+	double *weights;
+	int size;
 };
 
 /*
  * Node representation containing a label and a boolean flag indicating whether
- * the node has been visited or not during graph traversal.
+ * the node has been visited or not during graph traversal, as well as the
+ * position of the node in the array and matrix.
  */
 struct node
 {
 	char *label;
 	bool seen;
+	int index;
 };
 
 // ===========INTERNAL HELP FUNCTIONS============
@@ -68,6 +98,32 @@ static char *copy_string(const char *str)
 	return copy;
 }
 
+/**
+ * @brief - Return the label of the node with a given index.
+ *
+ * @param context - Graph to inspect
+ * @param i - index of the node
+ * @return const char* - label of the node
+ */
+static const char *node_label(const void *context, int i)
+{
+	const graph *g = context;
+	return NODE_AT(g, i)->label;
+}
+
+/**
+ * @brief - Find the slot in the label index for a given label.
+ *
+ * @param g - Graph to inspect
+ * @param s - label to look for
+ * @return int - the slot holding the node with label "s", or the empty
+ * slot where such a node should be put
+ */
+static int index_slot(const graph *g, const char *s)
+{
+	return label_index_slot(&g->index, s, node_label, g);
+}
+
 /**
  * @brief - Checks whether two nodes have equal labels.
  *
@@ -98,6 +154,10 @@ graph *graph_empty(int max_nodes)
 	g->num_nodes = 0;
 	g->nodes = array_1d_create(0, max_nodes, NULL);
 	g->matrix = array_2d_create(0, max_nodes, 0, max_nodes, NULL);
+	g->size = max_nodes + 1;
+	g->weights = NULL;
+	label_index_create(&g->index, max_nodes);
+	g->components = uf_create(max_nodes);
 
 	// Return pointer to the created graph
 	return g;
@@ -113,7 +173,8 @@ graph *graph_empty(int max_nodes)
 graph *graph_insert_node(graph *g, const char *s)
 {
 	// If the node already exists in the graph, return.
-	if (graph_find_node(g, s) != NULL)
+	int slot = index_slot(g, s);
+	if (g->index.slots[slot] != 0)
 	{
 		return g;
 	}
@@ -123,11 +184,18 @@ graph *graph_insert_node(graph *g, const char *s)
 	node *n = malloc(sizeof(node));
 	n->label = copy_string(s);
 	n->seen = false;
+	n->index = g->num_nodes;
 
 	// Insert the node into the array at its first free index,
 	// increase the graphs number of nodes, and return the modified graph
 	array_1d_set_value(g->nodes, n, g->num_nodes);
 	g->num_nodes++;
+
+	// Enter the node into the label index.
+	g->index.slots[slot] = g->num_nodes;
+
+	// The node starts in a component of its own.
+	uf_make_set(g->components);
 	return g;
 }
 
@@ -141,38 +209,46 @@ graph *graph_insert_node(graph *g, const char *s)
  */
 graph *graph_insert_edge(graph *g, node *n1, node *n2)
 {
-	// Variables used as indexes in the adjacency matrix
-	int node_source_index = -1;
-	int node_destination_index = -1;
+	return graph_insert_weighted_edge(g, n1, n2, 1.0);
+}
 
-	// Find the index for the souce node
-	for (int i = 0; i < g->num_nodes; i++)
-	{
-		node *inspection_source_node = array_1d_inspect_value(g->nodes, i);
-		if (nodes_are_equal(inspection_source_node, n1))
-		{
-			node_source_index = i;
-			break;
-		}
-	}
+/**
+ * @brief - Inserts an edge with a weight between two given nodes
+ *
+ * The weight matrix is allocated when the first edge with a weight
+ * other than 1 is inserted. An edge that is already in the graph gets
+ * the new weight.
+ *
+ * @param g - Graph to insert edge into
+ * @param n1 - source-node
+ * @param n2 - destination-node
+ * @param weight - weight of the edge
+ * @return graph* - pointer to the new, modified graph
+ */
+graph *graph_insert_weighted_edge(graph *g, node *n1, node *n2,
+				  double weight)
+{
+	// The nodes know their indexes in the adjacency matrix
+	array_2d_set_value(g->matrix, (int *)1, n1->index, n2->index);
 
-	// Find the index for the destination node
-	for (int i = 0; i < g->num_nodes; i++)
+	// Until now, all edges have had weight 1.
+	if (g->weights == NULL && weight != 1.0)
 	{
-		node *inspection_destination_node = array_1d_inspect_value(g->nodes, i);
-		if (strcmp(inspection_destination_node->label, n2->label) == 0)
+		size_t cells = (size_t)g->size * g->size;
+		g->weights = malloc(cells * sizeof(double));
+		for (size_t k = 0; k < cells; k++)
 		{
-			node_destination_index = i;
-			break;
+			g->weights[k] = 1.0;
 		}
 	}
-
-	// If both indexes where found, insert an edge between them at the right indexes
-	if (node_source_index != -1 && node_destination_index != -1)
+	if (g->weights != NULL)
 	{
-		array_2d_set_value(g->matrix, (int *)1, node_source_index, node_destination_index);
+		g->weights[(size_t)n1->index * g->size + n2->index] = weight;
 	}
 
+	// Merge the components of the nodes.
+	uf_union(g->components, n1->index, n2->index);
+
 	// Return pointer to the modified graph
 	return g;
 }
@@ -192,22 +268,8 @@ dlist *graph_neighbours(const graph *g, const node *n)
 	// Create an empty list to fill with neighbours
 	dlist *neighbours = dlist_empty(NULL);
 
-	// Find the index of the node in the array and matrix
-	int node_index = -1;
-	for (int i = 0; i < g->num_nodes; i++)
-	{
-		if (nodes_are_equal(n, array_1d_inspect_value(g->nodes, i)))
-		{
-			node_index = i;
-			break;
-		}
-	}
-
-	// If the node wasn't found in the array, return NULL
-	if (node_index == -1)
-	{
-		return NULL;
-	}
+	// The index of the node in the array and matrix
+	int node_index = n->index;
 
 	// Traverse the adjacency matrix and look for edges
 	// to the given node (represented as a column in the matrix).
@@ -218,7 +280,7 @@ dlist *graph_neighbours(const graph *g, const node *n)
 		if (array_2d_has_value(g->matrix, node_index, i))
 		{
 			node *inspection_node = array_1d_inspect_value(g->nodes, i);
-			if (strcmp(inspection_node->label, n->label) != 0)
+			if (i != node_index)
 			{
 				dlist_insert(neighbours, inspection_node, dlist_first(neighbours));
 			}
@@ -229,6 +291,65 @@ dlist *graph_neighbours(const graph *g, const node *n)
 	return neighbours;
 }
 
+/**
+ * @brief - Start iterating over the neighbours of a node.
+ *
+ * it->end holds the row of the node in the matrix and it->i the next
+ * column to inspect.
+ *
+ * @param g - Graph to inspect
+ * @param n - node to inspect
+ * @param it - iterator to initialize
+ * @return node* - first neighbour, or NULL if there are none
+ */
+node *graph_neighbour_begin(const graph *g, const node *n,
+			    graph_neighbour_iter *it)
+{
+	it->end = n->index;
+	it->i = 0;
+	return graph_neighbour_next(g, it);
+}
+
+/**
+ * @brief - Return the next neighbour of an iteration.
+ *
+ * @param g - Graph to inspect
+ * @param it - iterator
+ * @return node* - next neighbour, or NULL if there are no more
+ */
+node *graph_neighbour_next(const graph *g, graph_neighbour_iter *it)
+{
+	// Continue the scan of the matrix row, skipping the node itself
+	// like graph_neighbours() does.
+	while (it->i < g->num_nodes)
+	{
+		int i = it->i++;
+		if (i != it->end && array_2d_has_value(g->matrix, it->end, i))
+		{
+			return NODE_AT(g, i);
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief - Return the weight of the edge to the neighbour returned last.
+ *
+ * The neighbour is in column it->i - 1 of row it->end.
+ *
+ * @param g - Graph to inspect
+ * @param it - iterator
+ * @return double - weight of the edge
+ */
+double graph_neighbour_weight(const graph *g, const graph_neighbour_iter *it)
+{
+	if (g->weights == NULL)
+	{
+		return 1.0;
+	}
+	return g->weights[(size_t)it->end * g->size + it->i - 1];
+}
+
 /**
  * @brief - Checks if a graph is empty
  *
@@ -251,21 +372,83 @@ bool graph_is_empty(const graph *g)
  */
 node *graph_find_node(const graph *g, const char *s)
 {
-	// Traverse g->nodes and look for node with corresponding label
-	node *inspection_node;
-	for (int i = 0; array_1d_has_value(g->nodes, i); i++)
-	{
-		inspection_node = array_1d_inspect_value(g->nodes, i);
+	// Look the label up in the index
+	int slot = index_slot(g, s);
 
-		// If the label of the inspected node matches, return a pointer to it
-		if (strcmp(inspection_node->label, s) == 0)
-		{
-			return inspection_node;
-		}
+	// If no match was found, return NULL
+	if (g->index.slots[slot] == 0)
+	{
+		return NULL;
 	}
+	return NODE_AT(g, g->index.slots[slot] - 1);
+}
 
-	// If no match was found, return NULL
-	return NULL;
+/**
+ * @brief - Return the number of nodes in a graph
+ *
+ * @param g - Graph to inspect
+ * @return int - number of nodes
+ */
+int graph_num_nodes(const graph *g)
+{
+	return g->num_nodes;
+}
+
+/**
+ * @brief - Check if two nodes are in the same component of a graph
+ *
+ * The direction of the edges is ignored.
+ *
+ * @param g - Graph storing the nodes
+ * @param n1 - first node
+ * @param n2 - second node
+ * @return true - if there is an undirected path between the nodes
+ * @return false - otherwise
+ */
+bool graph_nodes_are_connected(const graph *g, const node *n1,
+			       const node *n2)
+{
+	return uf_same_set(g->components, graph_node_index(g, n1),
+			   graph_node_index(g, n2));
+}
+
+/**
+ * @brief - Return the number of components of a graph
+ *
+ * @param g - Graph to inspect
+ * @return int - number of weakly connected components
+ */
+int graph_num_components(const graph *g)
+{
+	return uf_num_sets(g->components);
+}
+
+/**
+ * @brief - Return the index of a node
+ *
+ * @param g - Graph storing the node
+ * @param n - Node to find index for
+ * @return int - index of the node
+ */
+int graph_node_index(const graph *g, const node *n)
+{
+	return n->index;
+}
+
+/**
+ * @brief - Return the node with a given index
+ *
+ * @param g - Graph to inspect
+ * @param i - index of the node
+ * @return node* - the node, or NULL if there is no node with index i
+ */
+node *graph_node_at(const graph *g, int i)
+{
+	if (i < 0 || i >= g->num_nodes)
+	{
+		return NULL;
+	}
+	return NODE_AT(g, i);
 }
 
 /**
@@ -336,6 +519,13 @@ void graph_kill(graph *g)
 	// Kill whats left of the array
 	array_1d_kill(g->nodes);
 
+	// Free the label index
+	label_index_kill(&g->index);
+
+	// Free the component index and the weights
+	uf_kill(g->components);
+	free(g->weights);
+
 	// And free the graph-struct
 	free(g);
 }
\ No newline at end of file
@@ -28,6 +28,14 @@
  *   v1.1  2019-03-06: Changed several const node * to node *.
  *                     Fixed doc bug to state that any dynamic memory allocated
  *                     to the node NAMES is the resposibility of the user.
+ *   v1.2  2026-10-16: Added graph_neighbour_begin() and
+ *                     graph_neighbour_next().
+ *   v1.3  2026-10-16: Added graph_num_nodes(), graph_node_index() and
+ *                     graph_node_at().
+ *   v1.4  2026-10-17: Added graph_nodes_are_connected() and
+ *                     graph_num_components().
+ *   v1.5  2026-10-17: Added graph_insert_weighted_edge() and
+ *                     graph_neighbour_weight().
  */
 
 // ====================== PUBLIC DATA TYPES ==========================
@@ -36,6 +44,18 @@
 typedef struct node node;
 typedef struct graph graph;
 
+// Iterator over the neighbours of a node, see graph_neighbour_begin().
+// The type is declared here so that iterators can be put on the stack.
+// The fields are used differently by each graph implementation and
+// should not be accessed by the user.
+typedef struct graph_neighbour_iter {
+	const void *list;
+	void *pos;
+	long i;
+	long end;
+	unsigned long long bits;
+} graph_neighbour_iter;
+
 // =================== NODE COMPARISON FUNCTION ======================
 
 /**
@@ -95,6 +115,35 @@ graph *graph_insert_node(graph *g, const char *s);
  */
 node *graph_find_node(const graph *g, const char *s);
 
+/**
+ * graph_num_nodes() - Return the number of nodes in the graph.
+ * @g: Graph to inspect.
+ *
+ * Returns: The number of nodes in the graph.
+ */
+int graph_num_nodes(const graph *g);
+
+/**
+ * graph_node_index() - Return the index of a node.
+ * @g: Graph storing the node.
+ * @n: Node in the graph.
+ *
+ * The nodes are numbered 0 to graph_num_nodes() - 1, so the index can
+ * be used to store information about the nodes in arrays.
+ *
+ * Returns: The index of n.
+ */
+int graph_node_index(const graph *g, const node *n);
+
+/**
+ * graph_node_at() - Return the node with a given index.
+ * @g: Graph to inspect.
+ * @i: Node index.
+ *
+ * Returns: The node with index i, or NULL if there is no such node.
+ */
+node *graph_node_at(const graph *g, int i);
+
 /**
  * graph_node_is_seen() - Return the seen status for a node.
  * @g: Graph storing the node.
@@ -134,6 +183,50 @@ graph *graph_reset_seen(graph *g);
  */
 graph *graph_insert_edge(graph *g, node *n1, node *n2);
 
+/**
+ * graph_insert_weighted_edge() - Insert an edge with a weight into the graph.
+ * @g: Graph to manipulate.
+ * @n1: Source node (pointer) for the edge.
+ * @n2: Destination node (pointer) for the edge.
+ * @weight: Weight of the edge, e.g. a distance or a travel time.
+ *
+ * Edges inserted with graph_insert_edge() have weight 1. If the edge is
+ * already in the graph, the graph either gives it the new weight or
+ * keeps both edges, depending on the implementation.
+ *
+ * NOTE: Undefined unless both nodes are already in the graph.
+ *
+ * Returns: The modified graph.
+ */
+graph *graph_insert_weighted_edge(graph *g, node *n1, node *n2,
+				  double weight);
+
+/**
+ * graph_nodes_are_connected() - Check if two nodes are in the same component.
+ * @g: Graph storing the nodes.
+ * @n1: First node.
+ * @n2: Second node.
+ *
+ * The components are the weakly connected components of the graph, i.e.
+ * the direction of the edges is ignored. The components are kept up to
+ * date by graph_insert_edge(), so the check does not search the graph.
+ * Nodes in different components have no path between them; for nodes
+ * in the same component of a directed graph, a search is still needed.
+ *
+ * Returns: True if there is an undirected path between n1 and n2.
+ */
+bool graph_nodes_are_connected(const graph *g, const node *n1,
+			       const node *n2);
+
+/**
+ * graph_num_components() - Return the number of components of the graph.
+ * @g: Graph to inspect.
+ *
+ * Returns: The number of weakly connected components, counting each
+ *	    node without edges as a component of its own.
+ */
+int graph_num_components(const graph *g);
+
 /**
  * graph_delete_node() - Remove a node from the graph.
  * @g: Graph to manipulate.
@@ -177,6 +270,50 @@ node *graph_choose_node(const graph *g);
  */
 dlist *graph_neighbours(const graph *g,const node *n);
 
+/**
+ * graph_neighbour_begin() - Start iterating over the neighbours of a node.
+ * @g: Graph to inspect.
+ * @n: Node to get neighbours for.
+ * @it: Iterator to initialize.
+ *
+ * Unlike graph_neighbours(), the iteration reads the neighbours from
+ * the graph in place and does not allocate any memory. Use as
+ *
+ *	graph_neighbour_iter it;
+ *	for (node *m = graph_neighbour_begin(g, n, &it); m != NULL;
+ *	     m = graph_neighbour_next(g, &it)) {
+ *		...
+ *	}
+ *
+ * The order of the neighbours is unspecified. The graph must not be
+ * modified during the iteration.
+ *
+ * Returns: The first neighbour of n, or NULL if n has no neighbours.
+ */
+node *graph_neighbour_begin(const graph *g, const node *n,
+			    graph_neighbour_iter *it);
+
+/**
+ * graph_neighbour_next() - Continue iterating over the neighbours of a node.
+ * @g: Graph to inspect.
+ * @it: Iterator initialized by graph_neighbour_begin().
+ *
+ * Returns: The next neighbour, or NULL if there are no more neighbours.
+ */
+node *graph_neighbour_next(const graph *g, graph_neighbour_iter *it);
+
+/**
+ * graph_neighbour_weight() - Return the weight of the edge to a neighbour.
+ * @g: Graph to inspect.
+ * @it: Iterator that has just returned a neighbour.
+ *
+ * NOTE: Undefined unless the last call to graph_neighbour_begin() or
+ * graph_neighbour_next() with it returned a node.
+ *
+ * Returns: The weight of the edge to the neighbour returned last.
+ */
+double graph_neighbour_weight(const graph *g, const graph_neighbour_iter *it);
+
 /**
  * graph_kill() - Destroy a given graph.
  * @g: Graph to destroy.
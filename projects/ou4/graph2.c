@@ -10,6 +10,12 @@
  *
  * Version information:
  *	v1.0 2024-04-24 first public version
+ *	v1.1 2026-10-16 added hashed label index
+ *	v1.2 2026-10-16 added neighbour iteration
+ *	v1.3 2026-10-16 added node index functions
+ *	v1.4 2026-10-17 added component index
+ *	v1.5 2026-10-17 added edge weights
+ *	v1.6 2026-10-17 the label index is shared, see label_index.h
  */
 
 #include <stdio.h>
@@ -20,6 +26,11 @@
 #include <array_1d.h>
 #include <dlist.h>
 #include "graph.h"
+#include "union_find.h"
+#include "label_index.h"
+
+// Node at index i of the node array of graph g.
+#define NODE_AT(g, i) ((node *)array_1d_inspect_value((g)->nodes, (i)))
 
 // ===========INTERNAL DATA TYPES============
 
@@ -29,23 +40,43 @@
  * "num_nodes" tracks the total number of nodes in the graph
  * (used as an index when inserting new nodes, and in graph_is_empty).
  *
+ * "index" is a hash table from node label to node index, see
+ * label_index.h, so that nodes are found without comparing labels
+ * with all nodes.
+ *
+ * "components" holds the weakly connected components of the graph by
+ * node index. It is updated by graph_insert_node() and
+ * graph_insert_edge().
  */
 struct graph
 {
 	array_1d *nodes;
 	int num_nodes;
+	label_index index;
+	union_find *components;
 };
 
 /*
  * Node representation containing a label and a boolean flag indicating whether
  * the node has been visited or not during graph traversal, 
- * as well as a list of its neighbours
+ * as well as a list of its neighbours and its position in the array.
+ * The list holds a struct edge for each neighbour.
  */
 struct node
 {
 	dlist *neighbours;
 	char *label;
 	bool seen;
+	int index;
+};
+
+/*
+ * An edge in the list of neighbours of its source node.
+ */
+struct edge
+{
+	node *dest;
+	double weight;
 };
 
 // ===========INTERNAL HELP FUNCTIONS============
@@ -65,6 +96,32 @@ static char *copy_string(const char *str)
 	return copy;
 }
 
+/**
+ * @brief - Return the label of the node with a given index.
+ *
+ * @param context - Graph to inspect
+ * @param i - index of the node
+ * @return const char* - label of the node
+ */
+static const char *node_label(const void *context, int i)
+{
+	const graph *g = context;
+	return NODE_AT(g, i)->label;
+}
+
+/**
+ * @brief - Find the slot in the label index for a given label.
+ *
+ * @param g - Graph to inspect
+ * @param s - label to look for
+ * @return int - the slot holding the node with label "s", or the empty
+ * slot where such a node should be put
+ */
+static int index_slot(const graph *g, const char *s)
+{
+	return label_index_slot(&g->index, s, node_label, g);
+}
+
 /**
  * @brief - Checks whether two nodes have equal labels.
  *
@@ -95,6 +152,8 @@ graph *graph_empty(int max_nodes)
 	graph *g = calloc(1, sizeof(*g));
 	g->nodes = array_1d_create(0, max_nodes, NULL);
 	g->num_nodes = 0;
+	label_index_create(&g->index, max_nodes);
+	g->components = uf_create(max_nodes);
 
 	// Return pointer to the created graph
 	return g;
@@ -110,7 +169,8 @@ graph *graph_empty(int max_nodes)
 graph *graph_insert_node(graph *g, const char *s)
 {
 	// If the node already exists in the graph, return.
-	if (graph_find_node(g, s) != NULL)
+	int slot = index_slot(g, s);
+	if (g->index.slots[slot] != 0)
 	{
 		return g;
 	}
@@ -120,14 +180,22 @@ graph *graph_insert_node(graph *g, const char *s)
 	node *n = malloc(sizeof(*n));
 	n->label = copy_string(s);
 	n->seen = false;
+	n->index = g->num_nodes;
 
-	// Create a list for storing the nieghbours of the created node
-	n->neighbours = dlist_empty(NULL);
+	// Create a list for storing the nieghbours of the created node.
+	// The list owns the edges.
+	n->neighbours = dlist_empty(free);
 
 	// Insert the node into the array at its first free index,
 	// increase the graphs number of nodes, and return the modified graph
 	array_1d_set_value(g->nodes, n, g->num_nodes);
 	g->num_nodes++;
+
+	// Enter the node into the label index.
+	g->index.slots[slot] = g->num_nodes;
+
+	// The node starts in a component of its own.
+	uf_make_set(g->components);
 	return g;
 }
 
@@ -141,9 +209,33 @@ graph *graph_insert_node(graph *g, const char *s)
  */
 graph *graph_insert_edge(graph *g, node *n1, node *n2)
 {
-	//Insert n2 into the list of neighbours of n1
-	dlist_insert(n1->neighbours, n2, dlist_first(n1->neighbours));
+	return graph_insert_weighted_edge(g, n1, n2, 1.0);
+}
+
+/**
+ * @brief - Inserts an edge with a weight between two given nodes
+ *
+ * Like for graph_insert_edge(), an edge that is already in the graph
+ * is inserted once more, with its own weight.
+ *
+ * @param g - Graph to insert edge into
+ * @param n1 - source-node
+ * @param n2 - destination-node
+ * @param weight - weight of the edge
+ * @return graph* - pointer to the new, modified graph
+ */
+graph *graph_insert_weighted_edge(graph *g, node *n1, node *n2,
+				  double weight)
+{
+	//Insert the edge to n2 into the list of neighbours of n1
+	struct edge *e = malloc(sizeof(*e));
+	e->dest = n2;
+	e->weight = weight;
+	dlist_insert(n1->neighbours, e, dlist_first(n1->neighbours));
 	
+	// Merge the components of the nodes.
+	uf_union(g->components, n1->index, n2->index);
+
 	//Return pointer to the modified graph
 	return g;
 }
@@ -168,8 +260,8 @@ dlist *graph_neighbours(const graph *g, const node *n)
 	dlist_pos pos = dlist_first(n->neighbours);
 	while (!dlist_is_end(n->neighbours, pos))
 	{
-		node *inspection_node = dlist_inspect(n->neighbours, pos);
-		dlist_insert(neighbours, inspection_node, dlist_first(neighbours));
+		struct edge *e = dlist_inspect(n->neighbours, pos);
+		dlist_insert(neighbours, e->dest, dlist_first(neighbours));
 		pos = dlist_next(n->neighbours, pos);
 	}
 
@@ -177,6 +269,60 @@ dlist *graph_neighbours(const graph *g, const node *n)
 	return neighbours;
 }
 
+/**
+ * @brief - Start iterating over the neighbours of a node.
+ *
+ * The iterator walks the neighbour list of the node directly, with
+ * it->list pointing to the list and it->pos to the current position.
+ *
+ * @param g - Graph to inspect
+ * @param n - node to inspect
+ * @param it - iterator to initialize
+ * @return node* - first neighbour, or NULL if there are none
+ */
+node *graph_neighbour_begin(const graph *g, const node *n,
+			    graph_neighbour_iter *it)
+{
+	it->list = n->neighbours;
+	it->pos = dlist_first(n->neighbours);
+	if (dlist_is_end(n->neighbours, it->pos))
+	{
+		return NULL;
+	}
+	return ((struct edge *)dlist_inspect(n->neighbours, it->pos))->dest;
+}
+
+/**
+ * @brief - Return the next neighbour of an iteration.
+ *
+ * @param g - Graph to inspect
+ * @param it - iterator
+ * @return node* - next neighbour, or NULL if there are no more
+ */
+node *graph_neighbour_next(const graph *g, graph_neighbour_iter *it)
+{
+	const dlist *l = it->list;
+	it->pos = dlist_next(l, it->pos);
+	if (dlist_is_end(l, it->pos))
+	{
+		return NULL;
+	}
+	return ((struct edge *)dlist_inspect(l, it->pos))->dest;
+}
+
+/**
+ * @brief - Return the weight of the edge to the neighbour returned last.
+ *
+ * @param g - Graph to inspect
+ * @param it - iterator
+ * @return double - weight of the edge
+ */
+double graph_neighbour_weight(const graph *g, const graph_neighbour_iter *it)
+{
+	const struct edge *e = dlist_inspect(it->list, it->pos);
+	return e->weight;
+}
+
 /**
  * @brief - Checks if a graph is empty
  *
@@ -200,21 +346,83 @@ bool graph_is_empty(const graph *g)
  */
 node *graph_find_node(const graph *g, const char *s)
 {
-	// Traverse g->nodes and look for node with corresponding label
-	node *inspection_node;
-	for (int i = 0; array_1d_has_value(g->nodes, i); i++)
+	// Look the label up in the index
+	int slot = index_slot(g, s);
+
+	// If no match was found, return NULL
+	if (g->index.slots[slot] == 0)
 	{
-		inspection_node = array_1d_inspect_value(g->nodes, i);
-		
-		// If the label of the inspected node matches, return a pointer to it
-		if (strcmp(inspection_node->label, s) == 0)
-		{
-			return inspection_node;
-		}
+		return NULL;
 	}
-	
-	// If no match was found, return NULL
-	return NULL;
+	return NODE_AT(g, g->index.slots[slot] - 1);
+}
+
+/**
+ * @brief - Return the number of nodes in a graph
+ *
+ * @param g - Graph to inspect
+ * @return int - number of nodes
+ */
+int graph_num_nodes(const graph *g)
+{
+	return g->num_nodes;
+}
+
+/**
+ * @brief - Check if two nodes are in the same component of a graph
+ *
+ * The direction of the edges is ignored.
+ *
+ * @param g - Graph storing the nodes
+ * @param n1 - first node
+ * @param n2 - second node
+ * @return true - if there is an undirected path between the nodes
+ * @return false - otherwise
+ */
+bool graph_nodes_are_connected(const graph *g, const node *n1,
+			       const node *n2)
+{
+	return uf_same_set(g->components, graph_node_index(g, n1),
+			   graph_node_index(g, n2));
+}
+
+/**
+ * @brief - Return the number of components of a graph
+ *
+ * @param g - Graph to inspect
+ * @return int - number of weakly connected components
+ */
+int graph_num_components(const graph *g)
+{
+	return uf_num_sets(g->components);
+}
+
+/**
+ * @brief - Return the index of a node
+ *
+ * @param g - Graph storing the node
+ * @param n - Node to find index for
+ * @return int - index of the node
+ */
+int graph_node_index(const graph *g, const node *n)
+{
+	return n->index;
+}
+
+/**
+ * @brief - Return the node with a given index
+ *
+ * @param g - Graph to inspect
+ * @param i - index of the node
+ * @return node* - the node, or NULL if there is no node with index i
+ */
+node *graph_node_at(const graph *g, int i)
+{
+	if (i < 0 || i >= g->num_nodes)
+	{
+		return NULL;
+	}
+	return NODE_AT(g, i);
 }
 
 /**
@@ -284,6 +492,12 @@ void graph_kill(graph *g)
 	// Kill whats left of the array
 	array_1d_kill(g->nodes);
 
+	// Free the label index
+	label_index_kill(&g->index);
+
+	// Free the component index
+	uf_kill(g->components);
+
 	// And free the graph struct
 	free(g);
 }
\ No newline at end of file
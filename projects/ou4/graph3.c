@@ -0,0 +1,1250 @@
+// Needed for mmap() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+/*
+ * CSR-based graph implementation tailored for use
+ * by "is_connected.c" in the "Data Structures and Algorithms" course
+ * at the Department of Computing Science, Umeå University.
+ *
+ * The edges are stored in compressed sparse row (CSR) form: the
+ * neighbours of all nodes are packed after each other in one array of
+ * node indices, and an offsets array gives the start of the
+ * neighbours of each node. The memory use is O(N + E) instead of the
+ * O(N^2) of the matrix in graph.c, and graph_neighbours() reads the
+ * O(degree) neighbours of a node from consecutive memory.
+ *
+ * The CSR arrays cannot be updated cheaply one edge at a time, so
+ * graph_insert_edge() only appends the edge to a list of pending
+ * edges. The CSR arrays are rebuilt from the old arrays and the
+ * pending edges the next time the neighbours of a node are asked for,
+ * i.e. normally once, after the graph has been loaded.
+ *
+ * The functions in graph3.h give direct access to the CSR arrays, and
+ * to the arrays of the reverse graph, for algorithms that need them.
+ *
+ * The graph holds no pointers of its own: the nodes refer to their
+ * labels by offset into one label arena. A graph can therefore be saved
+ * as a snapshot file with graph_save_snapshot(), see graph3.h, and
+ * reloaded by mapping the file into memory and using the arrays in it
+ * where they are, without parsing or copying anything.
+ *
+ * Version information:
+ *	v1.0 2026-10-16 first public version
+ *	v1.1 2026-10-16 added hashed label index
+ *	v1.2 2026-10-16 added neighbour iteration
+ *	v1.3 2026-10-16 added node index functions
+ *	v1.4 2026-10-17 added graph_csr and graph_csr_reverse
+ *	v1.5 2026-10-17 added component index
+ *	v1.6 2026-10-17 added snapshots, labels kept in an arena
+ *	v1.7 2026-10-17 added edge weights
+ *	v1.8 2026-10-17 the label index is shared, see label_index.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <dlist.h>
+#include "graph.h"
+#include "union_find.h"
+#include "label_index.h"
+#include "graph3.h"
+
+// Node at index i of the node array of graph g.
+#define NODE_AT(g, i) (&(g)->nodes[(i)])
+
+// Label of node n of graph g.
+#define LABEL(g, n) ((g)->labels + (n)->label)
+
+// Number of pending edges that room is made for in a new graph.
+#define INITIAL_PENDING_EDGES 64
+
+// Number of label bytes that room is made for in a new graph.
+#define INITIAL_LABEL_BYTES 1024
+
+// Snapshot file identification, see graph_save_snapshot(). The version
+// must be increased whenever the layout of the file or of struct node
+// changes.
+#define SNAPSHOT_MAGIC "OU4GRAPH"
+#define SNAPSHOT_VERSION 2
+#define SNAPSHOT_BYTE_ORDER 0x01020304u
+
+// Alignment of the arrays in a snapshot file.
+#define SNAPSHOT_ALIGN 64
+
+// ===========INTERNAL DATA TYPES============
+
+/*
+ * Node representation containing a label and a boolean flag indicating whether
+ * the node has been visited or not during graph traversal. "label" is the
+ * offset of the label in the label arena of the graph.
+ */
+struct node
+{
+	uint32_t label;
+	bool seen;
+};
+
+/*
+ * An edge that has been inserted but is not yet part of the CSR arrays.
+ */
+struct edge
+{
+	int src;
+	int dest;
+};
+
+/*
+ * Graph representation consisting of an array of nodes and the edges in
+ * CSR form.
+ *
+ * The nodes are stored by value in "nodes", so the index of a node is
+ * found from its pointer by pointer subtraction. "max_nodes" is the size
+ * of the array and "num_nodes" the number of nodes in use.
+ *
+ * "labels" holds the labels of the nodes, each followed by '\0', in
+ * "label_bytes" of "label_capacity" bytes.
+ *
+ * The neighbours of node i are targets[offsets[i]] ..
+ * targets[offsets[i + 1] - 1]. The arrays cover the first "csr_nodes"
+ * nodes; nodes inserted after the last rebuild have no edges in them.
+ *
+ * Edges inserted since the last rebuild are stored in "pending".
+ *
+ * "weights" and "pending_weights" hold the weights of the edges in
+ * "targets" and "pending". Both are NULL as long as all edges have
+ * weight 1, so that unweighted graphs use no memory for weights, see
+ * make_weighted().
+ *
+ * "rev_offsets" and "rev_sources" hold the edges of the reverse graph in
+ * the same form, i.e. the nodes with edges to node i. They are built by
+ * graph_csr_reverse() and are NULL until then, or after a rebuild.
+ *
+ * "index" is a hash table from node label to node index, see
+ * label_index.h, so that nodes are found without comparing labels
+ * with all nodes.
+ *
+ * "components" holds the weakly connected components of the graph by
+ * node index. It is updated by graph_insert_node() and
+ * graph_insert_edge(). It is NULL in a graph loaded from a snapshot
+ * until it is first needed, see components().
+ *
+ * "map" is the mapping of the snapshot file the graph was loaded from,
+ * of "map_size" bytes, or NULL. Arrays inside the mapping must not be
+ * freed, see release().
+ */
+struct graph
+{
+	struct node *nodes;
+	int max_nodes;
+	int num_nodes;
+	char *labels;
+	size_t label_bytes;
+	size_t label_capacity;
+	label_index index;
+	union_find *components;
+
+	int *offsets;
+	int *targets;
+	double *weights;
+	int csr_nodes;
+	int *rev_offsets;
+	int *rev_sources;
+
+	struct edge *pending;
+	double *pending_weights;
+	size_t num_pending;
+	size_t max_pending;
+
+	void *map;
+	size_t map_size;
+};
+
+// Sections of a snapshot file, see struct snapshot_header.
+enum snapshot_section
+{
+	SECTION_NODES,
+	SECTION_LABELS,
+	SECTION_INDEX,
+	SECTION_OFFSETS,
+	SECTION_TARGETS,
+	SECTION_WEIGHTS,
+	NUM_SECTIONS
+};
+
+/*
+ * Header of a snapshot file. It is followed by the node array, the
+ * label arena, the label index, the CSR offsets and targets arrays and,
+ * if "weighted" is non-zero, the weights array, each starting at the
+ * file offset given in "section" and aligned to SNAPSHOT_ALIGN bytes.
+ * "node_size" is sizeof(struct node) and "byte_order" is
+ * SNAPSHOT_BYTE_ORDER as written by the saving machine, so that files
+ * from machines with another layout are rejected.
+ */
+struct snapshot_header
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t byte_order;
+	uint32_t node_size;
+	int32_t num_nodes;
+	int32_t index_size;
+	int32_t num_edges;
+	int32_t weighted;
+	uint64_t label_bytes;
+	uint64_t section[NUM_SECTIONS];
+};
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - Copy a label into the label arena of a graph.
+ *
+ * @param g - Graph to modify
+ * @param str - label to copy
+ * @return uint32_t - offset of the copy in the arena
+ */
+static uint32_t add_label(graph *g, const char *str)
+{
+	size_t len = strlen(str) + 1;
+	if (g->label_bytes + len > g->label_capacity)
+	{
+		while (g->label_bytes + len > g->label_capacity)
+		{
+			g->label_capacity *= 2;
+		}
+		g->labels = realloc(g->labels, g->label_capacity);
+	}
+	memcpy(g->labels + g->label_bytes, str, len);
+	g->label_bytes += len;
+	return g->label_bytes - len;
+}
+
+/**
+ * @brief - Free an array of a graph, unless it is part of a snapshot.
+ *
+ * @param g - Graph owning the array
+ * @param p - array to free, or NULL
+ */
+static void release(const graph *g, void *p)
+{
+	// An empty array of a snapshot may start at the end of the file.
+	const char *c = p;
+	if (g->map == NULL || c < (const char *)g->map ||
+	    c > (const char *)g->map + g->map_size)
+	{
+		free(p);
+	}
+}
+
+/**
+ * @brief - Return the number of edges stored in the CSR arrays.
+ *
+ * @param g - Graph to inspect
+ * @return int - number of edges
+ */
+static int csr_edges(const graph *g)
+{
+	return g->offsets[g->csr_nodes];
+}
+
+/**
+ * @brief - Start keeping the weights of the edges of a graph.
+ *
+ * Called when the first edge with a weight other than 1 is inserted.
+ * All edges so far get weight 1.
+ *
+ * @param g - Graph to modify
+ */
+static void make_weighted(graph *g)
+{
+	int m = csr_edges(g);
+	g->weights = malloc((m > 0 ? m : 1) * sizeof(double));
+	for (int k = 0; k < m; k++)
+	{
+		g->weights[k] = 1.0;
+	}
+	g->pending_weights = malloc(g->max_pending * sizeof(double));
+	for (size_t e = 0; e < g->num_pending; e++)
+	{
+		g->pending_weights[e] = 1.0;
+	}
+}
+
+/**
+ * @brief - Rebuild the CSR arrays from the old arrays and the pending
+ * edges.
+ *
+ * The edges are placed with a counting sort on the source node, so the
+ * rebuild is O(N + E). Duplicate edges are removed, so that each
+ * neighbour is reported once like in the matrix-based graph.c. As in
+ * graph.c, the weight of the edge inserted last is kept.
+ *
+ * @param g - Graph to modify
+ */
+static void build_csr(graph *g)
+{
+	int n = g->num_nodes;
+	size_t max_edges = csr_edges(g) + g->num_pending;
+	int *offsets = calloc(n + 1, sizeof(int));
+	int *targets = malloc((max_edges > 0 ? max_edges : 1) * sizeof(int));
+	double *weights = NULL;
+	if (g->pending_weights != NULL)
+	{
+		weights = malloc((max_edges > 0 ? max_edges : 1) * sizeof(double));
+	}
+
+	// Count the out-degree of each node in offsets[i + 1]...
+	for (int i = 0; i < g->csr_nodes; i++)
+	{
+		offsets[i + 1] = g->offsets[i + 1] - g->offsets[i];
+	}
+	for (size_t e = 0; e < g->num_pending; e++)
+	{
+		offsets[g->pending[e].src + 1]++;
+	}
+
+	// ...and turn the counts into start positions.
+	for (int i = 0; i < n; i++)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+
+	// Put each edge at the next free position of its source node.
+	// "fill" keeps track of the next free position of each node. The
+	// edges of each node stay in insertion order.
+	int *fill = malloc((n > 0 ? n : 1) * sizeof(int));
+	memcpy(fill, offsets, n * sizeof(int));
+	for (int i = 0; i < g->csr_nodes; i++)
+	{
+		for (int k = g->offsets[i]; k < g->offsets[i + 1]; k++)
+		{
+			if (weights != NULL)
+			{
+				weights[fill[i]] = g->weights[k];
+			}
+			targets[fill[i]++] = g->targets[k];
+		}
+	}
+	for (size_t e = 0; e < g->num_pending; e++)
+	{
+		int i = g->pending[e].src;
+		if (weights != NULL)
+		{
+			weights[fill[i]] = g->pending_weights[e];
+		}
+		targets[fill[i]++] = g->pending[e].dest;
+	}
+
+	// Remove duplicates within each row and pack the rows. "fill" is
+	// reused to remember the packed position of each node in the rows
+	// packed so far. Positions before the start of the current row are
+	// from earlier rows.
+	for (int i = 0; i < n; i++)
+	{
+		fill[i] = -1;
+	}
+	int packed = 0;
+	for (int i = 0; i < n; i++)
+	{
+		int start = offsets[i];
+		int end = offsets[i + 1];
+		offsets[i] = packed;
+		for (int k = start; k < end; k++)
+		{
+			int t = targets[k];
+			if (fill[t] < offsets[i])
+			{
+				fill[t] = packed;
+				targets[packed] = t;
+				if (weights != NULL)
+				{
+					weights[packed] = weights[k];
+				}
+				packed++;
+			}
+			else if (weights != NULL)
+			{
+				// A later copy of the edge replaces the weight.
+				weights[fill[t]] = weights[k];
+			}
+		}
+	}
+	offsets[n] = packed;
+	free(fill);
+
+	// Replace the old arrays and forget the pending edges. The reverse
+	// arrays are out of date.
+	release(g, g->offsets);
+	release(g, g->targets);
+	release(g, g->weights);
+	free(g->rev_offsets);
+	free(g->rev_sources);
+	g->rev_offsets = NULL;
+	g->rev_sources = NULL;
+	g->offsets = offsets;
+	g->targets = targets;
+	g->weights = weights;
+	g->csr_nodes = n;
+	g->num_pending = 0;
+}
+
+/**
+ * @brief - Rebuild the CSR arrays if edges or nodes have been inserted.
+ *
+ * The graph is not const in the callers, only in the interface, and the
+ * rebuild does not change the edges of the graph.
+ *
+ * @param g - Graph to update
+ */
+static void update_csr(const graph *g)
+{
+	if (g->num_pending > 0 || g->csr_nodes < g->num_nodes)
+	{
+		build_csr((graph *)g);
+	}
+}
+
+/**
+ * @brief - Build the CSR arrays of the reverse graph.
+ *
+ * Uses a counting sort on the destination node, like build_csr(). The
+ * sources of each node end up in increasing order.
+ *
+ * @param g - Graph to modify. The CSR arrays must be up to date.
+ */
+static void build_reverse(graph *g)
+{
+	int n = g->csr_nodes;
+	int m = csr_edges(g);
+	int *offsets = calloc(n + 1, sizeof(int));
+	int *sources = malloc((m > 0 ? m : 1) * sizeof(int));
+
+	// Count the in-degree of each node and turn the counts into start
+	// positions.
+	for (int k = 0; k < m; k++)
+	{
+		offsets[g->targets[k] + 1]++;
+	}
+	for (int i = 0; i < n; i++)
+	{
+		offsets[i + 1] += offsets[i];
+	}
+
+	// Put each edge at the next free position of its destination node.
+	int *fill = malloc((n > 0 ? n : 1) * sizeof(int));
+	memcpy(fill, offsets, n * sizeof(int));
+	for (int i = 0; i < n; i++)
+	{
+		for (int k = g->offsets[i]; k < g->offsets[i + 1]; k++)
+		{
+			sources[fill[g->targets[k]]++] = i;
+		}
+	}
+	free(fill);
+
+	g->rev_offsets = offsets;
+	g->rev_sources = sources;
+}
+
+/**
+ * @brief - Return the component index of a graph, building it if needed.
+ *
+ * A graph loaded from a snapshot has no component index, since building
+ * it takes time proportional to the number of edges. It is built from
+ * all edges the first time it is needed. The graph is only const in the
+ * interface, like in update_csr().
+ *
+ * @param g - Graph to inspect
+ * @return union_find* - the component index
+ */
+static union_find *components(const graph *g)
+{
+	if (g->components == NULL)
+	{
+		union_find *uf = uf_create(g->max_nodes);
+		for (int i = 0; i < g->num_nodes; i++)
+		{
+			uf_make_set(uf);
+		}
+		for (int i = 0; i < g->csr_nodes; i++)
+		{
+			for (int k = g->offsets[i]; k < g->offsets[i + 1]; k++)
+			{
+				uf_union(uf, i, g->targets[k]);
+			}
+		}
+		for (size_t e = 0; e < g->num_pending; e++)
+		{
+			uf_union(uf, g->pending[e].src, g->pending[e].dest);
+		}
+		((graph *)g)->components = uf;
+	}
+	return g->components;
+}
+
+/**
+ * @brief - Return the label of the node with a given index.
+ *
+ * @param context - Graph to inspect
+ * @param i - index of the node
+ * @return const char* - label of the node
+ */
+static const char *node_label(const void *context, int i)
+{
+	const graph *g = context;
+	return LABEL(g, NODE_AT(g, i));
+}
+
+/**
+ * @brief - Find the slot in the label index for a given label.
+ *
+ * @param g - Graph to inspect
+ * @param s - label to look for
+ * @return int - the slot holding the node with label "s", or the empty
+ * slot where such a node should be put
+ */
+static int index_slot(const graph *g, const char *s)
+{
+	return label_index_slot(&g->index, s, node_label, g);
+}
+
+/**
+ * @brief - Checks whether two nodes are the same node.
+ *
+ * The labels are not reachable from the nodes alone. The labels in a
+ * graph are unique, so two nodes of a graph have equal labels exactly
+ * when they are the same node.
+ *
+ * @param n1 - node to compare with
+ * @param n2 - node to compare with
+ * @return true - if the nodes are the same
+ * @return false - otherwise
+ */
+bool nodes_are_equal(const node *n1, const node *n2)
+{
+	return n1 == n2;
+}
+
+/**
+ * @brief - Pad a snapshot file to the next SNAPSHOT_ALIGN boundary.
+ *
+ * @param fp - file to write to
+ * @return uint64_t - the new position in the file
+ */
+static uint64_t align_file(FILE *fp)
+{
+	static const char zeros[SNAPSHOT_ALIGN];
+	long pos = ftell(fp);
+	long pad = (SNAPSHOT_ALIGN - pos % SNAPSHOT_ALIGN) % SNAPSHOT_ALIGN;
+	fwrite(zeros, 1, pad, fp);
+	return pos + pad;
+}
+
+/**
+ * @brief - Write the node array of a graph to a snapshot file.
+ *
+ * The nodes are written through a buffer, since their seen status is
+ * saved as false.
+ *
+ * @param g - Graph to save
+ * @param fp - file to write to
+ */
+static void write_nodes(const graph *g, FILE *fp)
+{
+	struct node buf[1024];
+	for (int i = 0; i < g->num_nodes; i += 1024)
+	{
+		int n = g->num_nodes - i < 1024 ? g->num_nodes - i : 1024;
+		memcpy(buf, g->nodes + i, n * sizeof(struct node));
+		for (int k = 0; k < n; k++)
+		{
+			buf[k].seen = false;
+		}
+		fwrite(buf, sizeof(struct node), n, fp);
+	}
+}
+
+/**
+ * @brief - Check that a section of a snapshot lies within the file.
+ *
+ * @param h - header of the snapshot
+ * @param size - size of the file
+ * @param section - the section to check
+ * @param bytes - expected size of the section
+ * @return bool - true if the section is aligned and fits in the file
+ */
+static bool section_fits(const struct snapshot_header *h, size_t size,
+			 enum snapshot_section section, uint64_t bytes)
+{
+	uint64_t start = h->section[section];
+	return start % SNAPSHOT_ALIGN == 0 && start <= size &&
+	       bytes <= size - start;
+}
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * @brief - Create a new empty graph
+ *
+ * @param max_nodes - max number of nodes allowed
+ * @return graph* - pointer to the created graph
+ */
+graph *graph_empty(int max_nodes)
+{
+	// Allocate the graph, its node array and an empty CSR structure
+	// with no nodes.
+	graph *g = calloc(1, sizeof(*g));
+	g->max_nodes = max_nodes;
+	g->num_nodes = 0;
+	g->nodes = calloc(max_nodes > 0 ? max_nodes : 1, sizeof(struct node));
+	g->label_capacity = INITIAL_LABEL_BYTES;
+	g->labels = malloc(g->label_capacity);
+	g->label_bytes = 0;
+	g->offsets = calloc(1, sizeof(int));
+	g->targets = NULL;
+	g->weights = NULL;
+	g->csr_nodes = 0;
+	g->rev_offsets = NULL;
+	g->rev_sources = NULL;
+	g->max_pending = INITIAL_PENDING_EDGES;
+	g->pending = malloc(g->max_pending * sizeof(struct edge));
+	g->pending_weights = NULL;
+	g->num_pending = 0;
+	label_index_create(&g->index, max_nodes);
+	g->components = uf_create(max_nodes);
+	g->map = NULL;
+	g->map_size = 0;
+
+	// Return pointer to the created graph
+	return g;
+}
+
+/**
+ * @brief - Insert a node with the given label "s" into the graph "g"
+ *
+ * @param g - Graph to insert into
+ * @param s - label of node to insert
+ * @return graph* - pointer to the new, modified graph
+ */
+graph *graph_insert_node(graph *g, const char *s)
+{
+	// If the node already exists in the graph, return.
+	int slot = index_slot(g, s);
+	if (g->index.slots[slot] != 0)
+	{
+		return g;
+	}
+
+	// The nodes are handed out as pointers into the array, so it
+	// cannot be reallocated.
+	if (g->num_nodes == g->max_nodes)
+	{
+		fprintf(stderr, "graph_insert_node: Graph is full (%d nodes).\n",
+			g->max_nodes);
+		return g;
+	}
+
+	// Build the component index before the node is added, if needed.
+	union_find *uf = components(g);
+
+	// Put the node at the first free index.
+	node *n = &g->nodes[g->num_nodes];
+	n->label = add_label(g, s);
+	n->seen = false;
+	g->num_nodes++;
+
+	// Enter the node into the label index.
+	g->index.slots[slot] = g->num_nodes;
+
+	// The node starts in a component of its own.
+	uf_make_set(uf);
+	return g;
+}
+
+/**
+ * @brief - Inserts an edge between two given nodes in the graph "g"
+ *
+ * The edge is not visible in the CSR arrays until they are rebuilt by
+ * the next call to graph_neighbours().
+ *
+ * @param g - Graph to insert edge into
+ * @param n1 - source-node
+ * @param n2 - destination-node
+ * @return graph* - pointer to the new, modified graph
+ */
+graph *graph_insert_edge(graph *g, node *n1, node *n2)
+{
+	return graph_insert_weighted_edge(g, n1, n2, 1.0);
+}
+
+/**
+ * @brief - Inserts an edge with a weight between two given nodes
+ *
+ * The graph keeps no weights until the first edge with a weight other
+ * than 1 is inserted. An edge that is already in the graph gets the new
+ * weight when the CSR arrays are rebuilt.
+ *
+ * @param g - Graph to insert edge into
+ * @param n1 - source-node
+ * @param n2 - destination-node
+ * @param weight - weight of the edge
+ * @return graph* - pointer to the new, modified graph
+ */
+graph *graph_insert_weighted_edge(graph *g, node *n1, node *n2,
+				  double weight)
+{
+	// Make room for one more pending edge.
+	if (g->num_pending == g->max_pending)
+	{
+		g->max_pending *= 2;
+		g->pending = realloc(g->pending,
+				     g->max_pending * sizeof(struct edge));
+		if (g->pending_weights != NULL)
+		{
+			g->pending_weights = realloc(g->pending_weights,
+						     g->max_pending *
+						     sizeof(double));
+		}
+	}
+	if (g->pending_weights == NULL && weight != 1.0)
+	{
+		make_weighted(g);
+	}
+
+	// Store the edge as a pair of node indices.
+	g->pending[g->num_pending].src = graph_node_index(g, n1);
+	g->pending[g->num_pending].dest = graph_node_index(g, n2);
+	if (g->pending_weights != NULL)
+	{
+		g->pending_weights[g->num_pending] = weight;
+	}
+	g->num_pending++;
+
+	// Merge the components of the nodes.
+	uf_union(components(g), graph_node_index(g, n1), graph_node_index(g, n2));
+
+	// Return pointer to the modified graph
+	return g;
+}
+
+/**
+ * @brief - Checks if a graph has any edges
+ *
+ * @param g - Graph to inspect
+ * @return true - If the graph has at least one edge
+ * @return false - otherwise
+ */
+bool graph_has_edges(const graph *g)
+{
+	return g->num_pending > 0 || csr_edges(g) > 0;
+}
+
+/**
+ * @brief - Returns a list of neighbours to a given node.
+ *
+ * The list has to be dlist_kill:ed after use. If edges have been
+ * inserted since the last call, the CSR arrays are rebuilt first.
+ *
+ * @param g - Graph to inspect
+ * @param n - node to inspect
+ * @return dlist* - Directed list with all neighbours to "n"
+ */
+dlist *graph_neighbours(const graph *g, const node *n)
+{
+	update_csr(g);
+
+	// Create an empty list to fill with neighbours
+	dlist *neighbours = dlist_empty(NULL);
+
+	// Copy the neighbours from the row of the node.
+	int i = graph_node_index(g, n);
+	for (int k = g->offsets[i]; k < g->offsets[i + 1]; k++)
+	{
+		node *neighbour = &g->nodes[g->targets[k]];
+		dlist_insert(neighbours, neighbour, dlist_first(neighbours));
+	}
+
+	// Return the list of neighbours
+	return neighbours;
+}
+
+/**
+ * @brief - Start iterating over the neighbours of a node.
+ *
+ * it->i and it->end are the current and end positions in the CSR row
+ * of the node. As for graph_neighbours(), the CSR arrays are rebuilt
+ * first if needed.
+ *
+ * @param g - Graph to inspect
+ * @param n - node to inspect
+ * @param it - iterator to initialize
+ * @return node* - first neighbour, or NULL if there are none
+ */
+node *graph_neighbour_begin(const graph *g, const node *n,
+			    graph_neighbour_iter *it)
+{
+	update_csr(g);
+	int i = graph_node_index(g, n);
+	it->i = g->offsets[i];
+	it->end = g->offsets[i + 1];
+	return graph_neighbour_next(g, it);
+}
+
+/**
+ * @brief - Return the next neighbour of an iteration.
+ *
+ * @param g - Graph to inspect
+ * @param it - iterator
+ * @return node* - next neighbour, or NULL if there are no more
+ */
+node *graph_neighbour_next(const graph *g, graph_neighbour_iter *it)
+{
+	if (it->i == it->end)
+	{
+		return NULL;
+	}
+	return &g->nodes[g->targets[it->i++]];
+}
+
+/**
+ * @brief - Return the weight of the edge to the neighbour returned last.
+ *
+ * The neighbour is at position it->i - 1 of the CSR arrays.
+ *
+ * @param g - Graph to inspect
+ * @param it - iterator
+ * @return double - weight of the edge
+ */
+double graph_neighbour_weight(const graph *g, const graph_neighbour_iter *it)
+{
+	if (g->weights == NULL)
+	{
+		return 1.0;
+	}
+	return g->weights[it->i - 1];
+}
+
+/**
+ * @brief - Checks if a graph is empty
+ *
+ * @param g - Graph to inspect
+ * @return true - If the graph is empty
+ * @return false - If the graph isn't empty
+ */
+bool graph_is_empty(const graph *g)
+{
+	return g->num_nodes == 0;
+}
+
+/**
+ * @brief - Takes a string and returns a pointer to a node
+ * 			with a label equal to the given string
+ *
+ * @param g - Graph to inspect
+ * @param s - String to find corresponding node to
+ * @return node* - node with label equal to given string
+ */
+node *graph_find_node(const graph *g, const char *s)
+{
+	// Look the label up in the index
+	int slot = index_slot(g, s);
+
+	// If no match was found, return NULL
+	if (g->index.slots[slot] == 0)
+	{
+		return NULL;
+	}
+	return NODE_AT(g, g->index.slots[slot] - 1);
+}
+
+/**
+ * @brief - Return the number of nodes in a graph
+ *
+ * @param g - Graph to inspect
+ * @return int - number of nodes
+ */
+int graph_num_nodes(const graph *g)
+{
+	return g->num_nodes;
+}
+
+/**
+ * @brief - Check if two nodes are in the same component of a graph
+ *
+ * The direction of the edges is ignored.
+ *
+ * @param g - Graph storing the nodes
+ * @param n1 - first node
+ * @param n2 - second node
+ * @return true - if there is an undirected path between the nodes
+ * @return false - otherwise
+ */
+bool graph_nodes_are_connected(const graph *g, const node *n1,
+			       const node *n2)
+{
+	return uf_same_set(components(g), graph_node_index(g, n1),
+			   graph_node_index(g, n2));
+}
+
+/**
+ * @brief - Return the number of components of a graph
+ *
+ * @param g - Graph to inspect
+ * @return int - number of weakly connected components
+ */
+int graph_num_components(const graph *g)
+{
+	return uf_num_sets(components(g));
+}
+
+/**
+ * @brief - Return the index of a node
+ *
+ * @param g - Graph storing the node
+ * @param n - Node to find index for
+ * @return int - index of the node
+ */
+int graph_node_index(const graph *g, const node *n)
+{
+	return n - g->nodes;
+}
+
+/**
+ * @brief - Return the node with a given index
+ *
+ * @param g - Graph to inspect
+ * @param i - index of the node
+ * @return node* - the node, or NULL if there is no node with index i
+ */
+node *graph_node_at(const graph *g, int i)
+{
+	if (i < 0 || i >= g->num_nodes)
+	{
+		return NULL;
+	}
+	return NODE_AT(g, i);
+}
+
+/**
+ * @brief - Check the seen-status of given node in graph "g"
+ *
+ * @param g - Graph to inspect
+ * @param n - Node to inspect
+ * @return true - if the node is seen
+ * @return false - if the node is not seen
+ */
+bool graph_node_is_seen(const graph *g, const node *n)
+{
+	return n->seen;
+}
+
+/**
+ * @brief - Set the seen status of given node in graph "g"
+ *
+ * @param g - Graph to modify
+ * @param n - node to modify
+ * @param seen - status to set node
+ * @return graph* - the modified graph
+ */
+graph *graph_node_set_seen(graph *g, node *n, bool seen)
+{
+	n->seen = seen;
+	return g;
+}
+
+/**
+ * @brief - Reset the seen status of all nodes a in given graph
+ *
+ * @param g - Graph to modify
+ * @return graph* - the modified graph
+ */
+graph *graph_reset_seen(graph *g)
+{
+	// Iterate over all nodes and set its seen-status to false
+	for (int i = 0; i < g->num_nodes; i++)
+	{
+		g->nodes[i].seen = false;
+	}
+
+	// Return the modified graph
+	return g;
+}
+
+/**
+ * @brief - Destroy a given graph
+ *
+ * @param g - Graph to destroy
+ */
+void graph_kill(graph *g)
+{
+	// Free the node array and the labels
+	release(g, g->nodes);
+	release(g, g->labels);
+
+	// Free the edges
+	release(g, g->offsets);
+	release(g, g->targets);
+	release(g, g->weights);
+	free(g->rev_offsets);
+	free(g->rev_sources);
+	free(g->pending);
+	free(g->pending_weights);
+
+	// Free the label index
+	release(g, g->index.slots);
+
+	// Free the component index, if it has been built
+	if (g->components != NULL)
+	{
+		uf_kill(g->components);
+	}
+
+	// Unmap the snapshot the graph was loaded from
+	if (g->map != NULL)
+	{
+		munmap(g->map, g->map_size);
+	}
+
+	// And free the graph struct
+	free(g);
+}
+
+// ===========CSR EXTENSIONS, SEE graph3.h============
+
+/**
+ * @brief - Return the CSR arrays of the graph
+ *
+ * @param g - Graph to inspect
+ * @param offsets - output, the offsets array with one element per node
+ * plus one
+ * @param targets - output, the neighbour array
+ */
+void graph_csr(const graph *g, const int **offsets, const int **targets)
+{
+	update_csr(g);
+	*offsets = g->offsets;
+	*targets = g->targets;
+}
+
+/**
+ * @brief - Return the CSR arrays of the reverse graph
+ *
+ * The arrays are built by the first call and kept until the next
+ * rebuild of the CSR arrays.
+ *
+ * @param g - Graph to inspect
+ * @param offsets - output, the offsets array with one element per node
+ * plus one
+ * @param sources - output, the array of nodes with edges to each node
+ */
+void graph_csr_reverse(const graph *g, const int **offsets,
+		       const int **sources)
+{
+	update_csr(g);
+	if (g->rev_offsets == NULL)
+	{
+		build_reverse((graph *)g);
+	}
+	*offsets = g->rev_offsets;
+	*sources = g->rev_sources;
+}
+
+/**
+ * @brief - Return the weights of the edges in the CSR arrays
+ *
+ * @param g - Graph to inspect
+ * @return const double* - the weights, in the order of the targets
+ * array, or NULL if all edges have weight 1
+ */
+const double *graph_csr_weights(const graph *g)
+{
+	update_csr(g);
+	return g->weights;
+}
+
+// ===========SNAPSHOTS, SEE graph3.h============
+
+/**
+ * @brief - Save a graph to a snapshot file
+ *
+ * @param g - Graph to save
+ * @param filename - name of the file to write
+ * @return true - if the snapshot was written
+ * @return false - otherwise
+ */
+bool graph_save_snapshot(const graph *g, const char *filename)
+{
+	// Put the pending edges into the CSR arrays first.
+	update_csr(g);
+
+	FILE *fp = fopen(filename, "wb");
+	if (fp == NULL)
+	{
+		fprintf(stderr, "ERROR: could not create %s.\n", filename);
+		return false;
+	}
+
+	struct snapshot_header h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, SNAPSHOT_MAGIC, sizeof(h.magic));
+	h.version = SNAPSHOT_VERSION;
+	h.byte_order = SNAPSHOT_BYTE_ORDER;
+	h.node_size = sizeof(struct node);
+	h.num_nodes = g->num_nodes;
+	h.index_size = g->index.size;
+	h.num_edges = csr_edges(g);
+	h.weighted = g->weights != NULL;
+	h.label_bytes = g->label_bytes;
+
+	// Write the sections after room for the header, then go back and
+	// write the header with their positions.
+	fwrite(&h, sizeof(h), 1, fp);
+	h.section[SECTION_NODES] = align_file(fp);
+	write_nodes(g, fp);
+	h.section[SECTION_LABELS] = align_file(fp);
+	fwrite(g->labels, 1, g->label_bytes, fp);
+	h.section[SECTION_INDEX] = align_file(fp);
+	fwrite(g->index.slots, sizeof(int), g->index.size, fp);
+	h.section[SECTION_OFFSETS] = align_file(fp);
+	fwrite(g->offsets, sizeof(int), g->num_nodes + 1, fp);
+	h.section[SECTION_TARGETS] = align_file(fp);
+	if (h.num_edges > 0)
+	{
+		fwrite(g->targets, sizeof(int), h.num_edges, fp);
+	}
+	h.section[SECTION_WEIGHTS] = align_file(fp);
+	if (h.weighted && h.num_edges > 0)
+	{
+		fwrite(g->weights, sizeof(double), h.num_edges, fp);
+	}
+	rewind(fp);
+	fwrite(&h, sizeof(h), 1, fp);
+
+	bool ok = !ferror(fp);
+	if (fclose(fp) != 0 || !ok)
+	{
+		fprintf(stderr, "ERROR: could not write %s.\n", filename);
+		return false;
+	}
+	return true;
+}
+
+/**
+ * @brief - Create a graph from a snapshot file
+ *
+ * The file is mapped privately and writably, so that the seen status
+ * of the nodes can be changed in the mapped node array. Changed pages
+ * are copied by the operating system and never written to the file.
+ *
+ * @param filename - name of the file to read
+ * @return graph* - the created graph, or NULL on failure
+ */
+graph *graph_load_snapshot(const char *filename)
+{
+	int fd = open(filename, O_RDONLY);
+	if (fd == -1)
+	{
+		fprintf(stderr, "ERROR: could not open %s.\n", filename);
+		return NULL;
+	}
+	struct stat st;
+	if (fstat(fd, &st) == -1 ||
+	    (size_t)st.st_size < sizeof(struct snapshot_header))
+	{
+		fprintf(stderr, "ERROR: %s is not a graph snapshot.\n", filename);
+		close(fd);
+		return NULL;
+	}
+	size_t size = st.st_size;
+	void *map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+	{
+		fprintf(stderr, "ERROR: could not map %s.\n", filename);
+		return NULL;
+	}
+
+	// Check the header and that the arrays lie within the file. The
+	// contents of the arrays are trusted, since checking them would
+	// take time proportional to the size of the graph.
+	const struct snapshot_header *h = map;
+	char *base = map;
+	if (memcmp(h->magic, SNAPSHOT_MAGIC, sizeof(h->magic)) != 0 ||
+	    h->version != SNAPSHOT_VERSION ||
+	    h->byte_order != SNAPSHOT_BYTE_ORDER ||
+	    h->node_size != sizeof(struct node))
+	{
+		fprintf(stderr, "ERROR: %s is not a graph snapshot of version "
+			"%d for this machine.\n", filename, SNAPSHOT_VERSION);
+		munmap(map, size);
+		return NULL;
+	}
+	if (h->num_nodes < 0 || h->num_edges < 0 ||
+	    h->index_size <= h->num_nodes ||
+	    (h->index_size & (h->index_size - 1)) != 0 ||
+	    !section_fits(h, size, SECTION_NODES,
+			  (uint64_t)h->num_nodes * sizeof(struct node)) ||
+	    !section_fits(h, size, SECTION_LABELS, h->label_bytes) ||
+	    !section_fits(h, size, SECTION_INDEX,
+			  (uint64_t)h->index_size * sizeof(int)) ||
+	    !section_fits(h, size, SECTION_OFFSETS,
+			  ((uint64_t)h->num_nodes + 1) * sizeof(int)) ||
+	    !section_fits(h, size, SECTION_TARGETS,
+			  (uint64_t)h->num_edges * sizeof(int)) ||
+	    !section_fits(h, size, SECTION_WEIGHTS,
+			  h->weighted ? (uint64_t)h->num_edges *
+			  sizeof(double) : 0))
+	{
+		fprintf(stderr, "ERROR: %s is damaged.\n", filename);
+		munmap(map, size);
+		return NULL;
+	}
+	int *offsets = (int *)(base + h->section[SECTION_OFFSETS]);
+	if (offsets[0] != 0 || offsets[h->num_nodes] != h->num_edges)
+	{
+		fprintf(stderr, "ERROR: %s is damaged.\n", filename);
+		munmap(map, size);
+		return NULL;
+	}
+
+	// Let the graph use the arrays in the mapping. The graph is full,
+	// since the node array cannot grow, but edges can still be
+	// inserted.
+	graph *g = calloc(1, sizeof(*g));
+	g->map = map;
+	g->map_size = size;
+	g->nodes = (struct node *)(base + h->section[SECTION_NODES]);
+	g->max_nodes = h->num_nodes;
+	g->num_nodes = h->num_nodes;
+	g->labels = base + h->section[SECTION_LABELS];
+	g->label_bytes = h->label_bytes;
+	g->label_capacity = h->label_bytes;
+	g->index.slots = (int *)(base + h->section[SECTION_INDEX]);
+	g->index.size = h->index_size;
+	g->components = NULL;
+	g->offsets = offsets;
+	g->targets = (int *)(base + h->section[SECTION_TARGETS]);
+	g->weights = NULL;
+	if (h->weighted)
+	{
+		g->weights = (double *)(base + h->section[SECTION_WEIGHTS]);
+	}
+	g->csr_nodes = h->num_nodes;
+	g->rev_offsets = NULL;
+	g->rev_sources = NULL;
+	g->max_pending = INITIAL_PENDING_EDGES;
+	g->pending = malloc(g->max_pending * sizeof(struct edge));
+	g->pending_weights = NULL;
+	if (h->weighted)
+	{
+		g->pending_weights = malloc(g->max_pending * sizeof(double));
+	}
+	g->num_pending = 0;
+	return g;
+}
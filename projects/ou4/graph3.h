@@ -0,0 +1,102 @@
+#ifndef __GRAPH3_H
+#define __GRAPH3_H
+
+#include "graph.h"
+
+/*
+ * Extensions to graph.h provided by the CSR graph in graph3.c. They
+ * give read-only access to the compressed sparse row arrays, for
+ * algorithms that need to traverse the edges faster than through
+ * graph_neighbour_begin()/graph_neighbour_next(). The nodes are
+ * identified by their index, see graph_node_index() in graph.h.
+ *
+ * The arrays are owned by the graph and are valid until the next edge
+ * or node is inserted into the graph.
+ *
+ * A graph can also be saved as a binary snapshot file and loaded again
+ * in constant time.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ *   v1.1 2026-10-17: Added graph_save_snapshot() and
+ *                    graph_load_snapshot().
+ *   v1.2 2026-10-17: Added graph_csr_weights().
+ */
+
+/**
+ * graph_csr() - Get the edges of a graph in CSR form.
+ * @g: Graph to inspect.
+ * @offsets: Output. Receives an array of graph_num_nodes() + 1 elements.
+ * @targets: Output. Receives the neighbour array.
+ *
+ * The neighbours of node i are (*targets)[(*offsets)[i]] ..
+ * (*targets)[(*offsets)[i + 1] - 1].
+ *
+ * Returns: Nothing.
+ */
+void graph_csr(const graph *g, const int **offsets, const int **targets);
+
+/**
+ * graph_csr_reverse() - Get the edges of the reverse graph in CSR form.
+ * @g: Graph to inspect.
+ * @offsets: Output. Receives an array of graph_num_nodes() + 1 elements.
+ * @sources: Output. Receives the array of nodes with edges to each node.
+ *
+ * The nodes with an edge to node i are (*sources)[(*offsets)[i]] ..
+ * (*sources)[(*offsets)[i + 1] - 1], in increasing order.
+ *
+ * Returns: Nothing.
+ */
+void graph_csr_reverse(const graph *g, const int **offsets,
+		       const int **sources);
+
+/**
+ * graph_csr_weights() - Get the weights of the edges in CSR form.
+ * @g: Graph to inspect.
+ *
+ * The weight of the edge to (*targets)[k], see graph_csr(), is
+ * weights[k]. The array is valid as long as the arrays from
+ * graph_csr().
+ *
+ * Returns: The weight array, or NULL if all edges have weight 1.
+ */
+const double *graph_csr_weights(const graph *g);
+
+/**
+ * graph_save_snapshot() - Save a graph to a snapshot file.
+ * @g: Graph to save.
+ * @filename: Name of the file to write.
+ *
+ * The snapshot holds the nodes, labels, label index and CSR arrays of
+ * the graph in the form they have in memory, so that
+ * graph_load_snapshot() can use them without parsing. A snapshot can
+ * only be loaded on machines with the same byte order and type sizes,
+ * by code with the same snapshot version. The seen status of the nodes
+ * is not saved.
+ *
+ * Errors are reported on stderr.
+ *
+ * Returns: True if the snapshot was written, otherwise false.
+ */
+bool graph_save_snapshot(const graph *g, const char *filename);
+
+/**
+ * graph_load_snapshot() - Create a graph from a snapshot file.
+ * @filename: Name of a file written by graph_save_snapshot().
+ *
+ * The file is mapped into memory and the graph uses the arrays in it
+ * where they are, so loading takes constant time. The parts of the file
+ * are read by the operating system as they are first used. Changes to
+ * the graph are never written back to the file. No nodes can be
+ * inserted into the loaded graph, but edges can. The component index
+ * used by graph_nodes_are_connected() is built the first time it is
+ * needed.
+ *
+ * Errors are reported on stderr.
+ *
+ * Returns: The new graph, or NULL if the file could not be read or is
+ *	    not a snapshot of this version.
+ */
+graph *graph_load_snapshot(const char *filename);
+
+#endif
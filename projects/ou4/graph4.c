@@ -0,0 +1,711 @@
+/*
+ * Bitset matrix graph implementation tailored for use
+ * by "is_connected.c" in the "Data Structures and Algorithms" course
+ * at the Department of Computing Science, Umeå University.
+ *
+ * Like graph.c, the edges are stored in an adjacency matrix, but each
+ * matrix element is a single bit instead of a void pointer. Row i of
+ * the matrix is a bitset of 64-bit words where bit j is set if there
+ * is an edge from node i to node j. The matrix uses N^2 / 8 bytes,
+ * 64 times less than the void pointer matrix of graph.c, and a
+ * neighbour scan reads one bit per node. Empty words are skipped and
+ * the neighbours in a word are found with count-trailing-zeros.
+ *
+ * The matrix representation is only appropriate for dense graphs.
+ * For sparse graphs, see graph3.c.
+ *
+ * The functions in graph4.h work on whole rows at a time.
+ *
+ * Version information:
+ *	v1.0 2026-10-16 first public version
+ *	v1.1 2026-10-16 added neighbour iteration
+ *	v1.2 2026-10-16 added graph_num_nodes
+ *	v1.3 2026-10-17 added component index
+ *	v1.4 2026-10-17 added edge weights
+ *	v1.5 2026-10-17 only the weights other than 1 are stored
+ *	v1.6 2026-10-17 the label index is shared, see label_index.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <dlist.h>
+#include "graph.h"
+#include "union_find.h"
+#include "label_index.h"
+#include "graph4.h"
+
+// Node at index i of the node array of graph g.
+#define NODE_AT(g, i) (&(g)->nodes[(i)])
+
+// Number of bits in a matrix word.
+#define WORD_BITS 64
+
+// ===========INTERNAL DATA TYPES============
+
+/*
+ * Node representation containing a label and a boolean flag indicating whether
+ * the node has been visited or not during graph traversal.
+ */
+struct node
+{
+	char *label;
+	bool seen;
+};
+
+/*
+ * Graph representation consisting of an array of nodes and a bit matrix.
+ *
+ * The nodes are stored by value in "nodes", so the index of a node is
+ * found from its pointer by pointer subtraction. "max_nodes" is the size
+ * of the array and "num_nodes" the number of nodes in use.
+ *
+ * Row i of the matrix starts at matrix[i * words] and has "words"
+ * words, enough for "max_nodes" bits. "num_edges" counts the set bits.
+ *
+ * "index" is a hash table from node label to node index, see
+ * label_index.h, so that nodes are found without comparing labels
+ * with all nodes.
+ *
+ * "components" holds the weakly connected components of the graph by
+ * node index. It is updated by graph_insert_node() and
+ * graph_insert_edge().
+ *
+ * "weights" is a hash table of the edges with a weight other than 1,
+ * see weight_slot(). An edge that is not in it has weight 1, so the
+ * weights use memory in proportion to the number of weighted edges and
+ * not to max_nodes^2. It is NULL until the first such edge is inserted.
+ */
+struct graph
+{
+	struct node *nodes;
+	int max_nodes;
+	int num_nodes;
+	label_index index;
+	union_find *components;
+
+	uint64_t *matrix;
+	int words;
+	long num_edges;
+	struct weight *weights;
+	size_t weights_size;
+	size_t num_weights;
+};
+
+/*
+ * The weight of the edge from node i to node j. "edge" is
+ * i * max_nodes + j + 1, or 0 if the slot is empty.
+ */
+struct weight
+{
+	size_t edge;
+	double weight;
+};
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - Copies the input string "str" into a newly
+ * allocated memory block and returns a pointer to it.
+ * This function is used internally for creating copies of strings.
+ *
+ * @param str - string to copy
+ * @return char* - copy of given string
+ */
+static char *copy_string(const char *str)
+{
+	char *copy = calloc(strlen(str) + 1, sizeof(char));
+	strcpy(copy, str);
+	return copy;
+}
+
+/**
+ * @brief - Return the row of the matrix for a node index.
+ *
+ * @param g - Graph to inspect
+ * @param i - index of the node
+ * @return uint64_t* - the first word of row i
+ */
+static uint64_t *row(const graph *g, int i)
+{
+	return g->matrix + (size_t)i * g->words;
+}
+
+/**
+ * @brief - Return the label of the node with a given index.
+ *
+ * @param context - Graph to inspect
+ * @param i - index of the node
+ * @return const char* - label of the node
+ */
+static const char *node_label(const void *context, int i)
+{
+	const graph *g = context;
+	return NODE_AT(g, i)->label;
+}
+
+/**
+ * @brief - Find the slot in the label index for a given label.
+ *
+ * @param g - Graph to inspect
+ * @param s - label to look for
+ * @return int - the slot holding the node with label "s", or the empty
+ * slot where such a node should be put
+ */
+static int index_slot(const graph *g, const char *s)
+{
+	return label_index_slot(&g->index, s, node_label, g);
+}
+
+/**
+ * @brief - Find the slot in the weight table for a given edge.
+ *
+ * Like the label index, the weight table is an open-addressing hash
+ * table with linear probing that is never more than half full.
+ *
+ * @param g - Graph to inspect
+ * @param edge - the edge, i * max_nodes + j + 1
+ * @return size_t - the slot holding the edge, or the empty slot where
+ * it should be put
+ */
+static size_t weight_slot(const graph *g, size_t edge)
+{
+	size_t mask = g->weights_size - 1;
+	size_t slot = (size_t)((edge * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+	while (g->weights[slot].edge != 0 && g->weights[slot].edge != edge)
+	{
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+
+/**
+ * @brief - Set the weight of an edge.
+ *
+ * Edges with weight 1 are only kept in the table if they already are
+ * in it. The table is doubled when it would become more than half full.
+ *
+ * @param g - Graph to modify
+ * @param edge - the edge, i * max_nodes + j + 1
+ * @param weight - weight of the edge
+ */
+static void set_weight(graph *g, size_t edge, double weight)
+{
+	if (g->weights != NULL)
+	{
+		size_t slot = weight_slot(g, edge);
+		if (g->weights[slot].edge == edge)
+		{
+			g->weights[slot].weight = weight;
+			return;
+		}
+	}
+	if (weight == 1.0)
+	{
+		return;
+	}
+
+	if (2 * (g->num_weights + 1) > g->weights_size)
+	{
+		struct weight *old = g->weights;
+		size_t old_size = g->weights_size;
+		g->weights_size = old_size > 0 ? 2 * old_size : 16;
+		g->weights = calloc(g->weights_size, sizeof(struct weight));
+		for (size_t k = 0; k < old_size; k++)
+		{
+			if (old[k].edge != 0)
+			{
+				g->weights[weight_slot(g, old[k].edge)] = old[k];
+			}
+		}
+		free(old);
+	}
+	size_t slot = weight_slot(g, edge);
+	g->weights[slot].edge = edge;
+	g->weights[slot].weight = weight;
+	g->num_weights++;
+}
+
+/**
+ * @brief - Checks whether two nodes have equal labels.
+ *
+ * @param n1 - node to compare with
+ * @param n2 - node to compare with
+ * @return true - if the labels are identical
+ * @return false - otherwise
+ */
+bool nodes_are_equal(const node *n1, const node *n2)
+{
+	return strcmp(n1->label, n2->label) == 0;
+}
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * @brief - Create a new empty graph
+ *
+ * @param max_nodes - max number of nodes allowed
+ * @return graph* - pointer to the created graph
+ */
+graph *graph_empty(int max_nodes)
+{
+	// Allocate the graph, its node array and an all-zero matrix with
+	// room for "max_nodes" rows and columns.
+	graph *g = calloc(1, sizeof(*g));
+	g->max_nodes = max_nodes;
+	g->num_nodes = 0;
+	g->nodes = calloc(max_nodes > 0 ? max_nodes : 1, sizeof(struct node));
+	g->words = (max_nodes + WORD_BITS - 1) / WORD_BITS;
+	g->matrix = calloc((size_t)max_nodes * g->words + 1, sizeof(uint64_t));
+	g->num_edges = 0;
+	g->weights = NULL;
+	g->weights_size = 0;
+	g->num_weights = 0;
+	label_index_create(&g->index, max_nodes);
+	g->components = uf_create(max_nodes);
+
+	// Return pointer to the created graph
+	return g;
+}
+
+/**
+ * @brief - Insert a node with the given label "s" into the graph "g"
+ *
+ * @param g - Graph to insert into
+ * @param s - label of node to insert
+ * @return graph* - pointer to the new, modified graph
+ */
+graph *graph_insert_node(graph *g, const char *s)
+{
+	// If the node already exists in the graph, return.
+	int slot = index_slot(g, s);
+	if (g->index.slots[slot] != 0)
+	{
+		return g;
+	}
+
+	// The matrix has room for "max_nodes" nodes only.
+	if (g->num_nodes == g->max_nodes)
+	{
+		fprintf(stderr, "graph_insert_node: Graph is full (%d nodes).\n",
+			g->max_nodes);
+		return g;
+	}
+
+	// Put the node at the first free index.
+	node *n = &g->nodes[g->num_nodes];
+	n->label = copy_string(s);
+	n->seen = false;
+	g->num_nodes++;
+
+	// Enter the node into the label index.
+	g->index.slots[slot] = g->num_nodes;
+
+	// The node starts in a component of its own.
+	uf_make_set(g->components);
+	return g;
+}
+
+/**
+ * @brief - Inserts an edge between two given nodes in the graph "g"
+ *
+ * @param g - Graph to insert edge into
+ * @param n1 - source-node
+ * @param n2 - destination-node
+ * @return graph* - pointer to the new, modified graph
+ */
+graph *graph_insert_edge(graph *g, node *n1, node *n2)
+{
+	return graph_insert_weighted_edge(g, n1, n2, 1.0);
+}
+
+/**
+ * @brief - Inserts an edge with a weight between two given nodes
+ *
+ * Only weights other than 1 are stored, see set_weight(). An edge that
+ * is already in the graph gets the new weight.
+ *
+ * @param g - Graph to insert edge into
+ * @param n1 - source-node
+ * @param n2 - destination-node
+ * @param weight - weight of the edge
+ * @return graph* - pointer to the new, modified graph
+ */
+graph *graph_insert_weighted_edge(graph *g, node *n1, node *n2,
+				  double weight)
+{
+	// Set bit n2 in row n1, and count the edge if it is new.
+	int i = graph_node_index(g, n1);
+	int j = graph_node_index(g, n2);
+	uint64_t *w = &row(g, i)[j / WORD_BITS];
+	uint64_t bit = (uint64_t)1 << (j % WORD_BITS);
+	if ((*w & bit) == 0)
+	{
+		*w |= bit;
+		g->num_edges++;
+	}
+
+	set_weight(g, (size_t)i * g->max_nodes + j + 1, weight);
+
+	// Merge the components of the nodes.
+	uf_union(g->components, i, j);
+
+	// Return pointer to the modified graph
+	return g;
+}
+
+/**
+ * @brief - Checks if a graph has any edges
+ *
+ * @param g - Graph to inspect
+ * @return true - If the graph has at least one edge
+ * @return false - otherwise
+ */
+bool graph_has_edges(const graph *g)
+{
+	return g->num_edges > 0;
+}
+
+/**
+ * @brief - Returns a list of neighbours to a given node.
+ *
+ * The list has to be dlist_kill:ed after use. Like in graph.c, a node
+ * is not reported as its own neighbour.
+ *
+ * @param g - Graph to inspect
+ * @param n - node to inspect
+ * @return dlist* - Directed list with all neighbours to "n"
+ */
+dlist *graph_neighbours(const graph *g, const node *n)
+{
+	// Create an empty list to fill with neighbours
+	dlist *neighbours = dlist_empty(NULL);
+
+	// Visit the set bits of the row of the node, skipping empty words.
+	int i = graph_node_index(g, n);
+	const uint64_t *r = row(g, i);
+	for (int w = 0; w < g->words; w++)
+	{
+		uint64_t bits = r[w];
+		while (bits != 0)
+		{
+			// Index of the lowest set bit, then clear it.
+			int j = w * WORD_BITS + __builtin_ctzll(bits);
+			bits &= bits - 1;
+			if (j != i)
+			{
+				dlist_insert(neighbours, &g->nodes[j],
+					     dlist_first(neighbours));
+			}
+		}
+	}
+
+	// Return the list of neighbours
+	return neighbours;
+}
+
+/**
+ * @brief - Start iterating over the neighbours of a node.
+ *
+ * it->list points to the node and it->pos to its row, it->i is the
+ * index of the next word to load, it->bits holds the bits of the
+ * current word that have not been visited yet, and it->end is the
+ * index of the neighbour returned last.
+ *
+ * @param g - Graph to inspect
+ * @param n - node to inspect
+ * @param it - iterator to initialize
+ * @return node* - first neighbour, or NULL if there are none
+ */
+node *graph_neighbour_begin(const graph *g, const node *n,
+			    graph_neighbour_iter *it)
+{
+	it->list = n;
+	it->pos = row(g, graph_node_index(g, n));
+	it->i = 0;
+	it->bits = 0;
+	return graph_neighbour_next(g, it);
+}
+
+/**
+ * @brief - Return the next neighbour of an iteration.
+ *
+ * @param g - Graph to inspect
+ * @param it - iterator
+ * @return node* - next neighbour, or NULL if there are no more
+ */
+node *graph_neighbour_next(const graph *g, graph_neighbour_iter *it)
+{
+	const uint64_t *r = it->pos;
+	int self = graph_node_index(g, it->list);
+	while (true)
+	{
+		// Load the next non-empty word when the current one is done.
+		while (it->bits == 0)
+		{
+			if (it->i == g->words)
+			{
+				return NULL;
+			}
+			it->bits = r[it->i++];
+		}
+		// Index of the lowest set bit, then clear it. The word that
+		// holds it was loaded from position it->i - 1.
+		int j = (it->i - 1) * WORD_BITS + __builtin_ctzll(it->bits);
+		it->bits &= it->bits - 1;
+		if (j != self)
+		{
+			it->end = j;
+			return &g->nodes[j];
+		}
+	}
+}
+
+/**
+ * @brief - Return the weight of the edge to the neighbour returned last.
+ *
+ * @param g - Graph to inspect
+ * @param it - iterator
+ * @return double - weight of the edge
+ */
+double graph_neighbour_weight(const graph *g, const graph_neighbour_iter *it)
+{
+	if (g->weights == NULL)
+	{
+		return 1.0;
+	}
+	int i = graph_node_index(g, it->list);
+	size_t edge = (size_t)i * g->max_nodes + it->end + 1;
+	size_t slot = weight_slot(g, edge);
+	return g->weights[slot].edge == edge ? g->weights[slot].weight : 1.0;
+}
+
+/**
+ * @brief - Checks if a graph is empty
+ *
+ * @param g - Graph to inspect
+ * @return true - If the graph is empty
+ * @return false - If the graph isn't empty
+ */
+bool graph_is_empty(const graph *g)
+{
+	return g->num_nodes == 0;
+}
+
+/**
+ * @brief - Takes a string and returns a pointer to a node
+ * 			with a label equal to the given string
+ *
+ * @param g - Graph to inspect
+ * @param s - String to find corresponding node to
+ * @return node* - node with label equal to given string
+ */
+node *graph_find_node(const graph *g, const char *s)
+{
+	// Look the label up in the index
+	int slot = index_slot(g, s);
+
+	// If no match was found, return NULL
+	if (g->index.slots[slot] == 0)
+	{
+		return NULL;
+	}
+	return NODE_AT(g, g->index.slots[slot] - 1);
+}
+
+/**
+ * @brief - Return the number of nodes in a graph
+ *
+ * @param g - Graph to inspect
+ * @return int - number of nodes
+ */
+int graph_num_nodes(const graph *g)
+{
+	return g->num_nodes;
+}
+
+/**
+ * @brief - Check if two nodes are in the same component of a graph
+ *
+ * The direction of the edges is ignored.
+ *
+ * @param g - Graph storing the nodes
+ * @param n1 - first node
+ * @param n2 - second node
+ * @return true - if there is an undirected path between the nodes
+ * @return false - otherwise
+ */
+bool graph_nodes_are_connected(const graph *g, const node *n1,
+			       const node *n2)
+{
+	return uf_same_set(g->components, graph_node_index(g, n1),
+			   graph_node_index(g, n2));
+}
+
+/**
+ * @brief - Return the number of components of a graph
+ *
+ * @param g - Graph to inspect
+ * @return int - number of weakly connected components
+ */
+int graph_num_components(const graph *g)
+{
+	return uf_num_sets(g->components);
+}
+
+/**
+ * @brief - Return the index of a node
+ *
+ * @param g - Graph storing the node
+ * @param n - Node to find index for
+ * @return int - index of the node
+ */
+int graph_node_index(const graph *g, const node *n)
+{
+	return n - g->nodes;
+}
+
+/**
+ * @brief - Return the node with a given index
+ *
+ * @param g - Graph to inspect
+ * @param i - index of the node
+ * @return node* - the node, or NULL if there is no node with index i
+ */
+node *graph_node_at(const graph *g, int i)
+{
+	if (i < 0 || i >= g->num_nodes)
+	{
+		return NULL;
+	}
+	return NODE_AT(g, i);
+}
+
+/**
+ * @brief - Check the seen-status of given node in graph "g"
+ *
+ * @param g - Graph to inspect
+ * @param n - Node to inspect
+ * @return true - if the node is seen
+ * @return false - if the node is not seen
+ */
+bool graph_node_is_seen(const graph *g, const node *n)
+{
+	return n->seen;
+}
+
+/**
+ * @brief - Set the seen status of given node in graph "g"
+ *
+ * @param g - Graph to modify
+ * @param n - node to modify
+ * @param seen - status to set node
+ * @return graph* - the modified graph
+ */
+graph *graph_node_set_seen(graph *g, node *n, bool seen)
+{
+	n->seen = seen;
+	return g;
+}
+
+/**
+ * @brief - Reset the seen status of all nodes a in given graph
+ *
+ * @param g - Graph to modify
+ * @return graph* - the modified graph
+ */
+graph *graph_reset_seen(graph *g)
+{
+	// Iterate over all nodes and set its seen-status to false
+	for (int i = 0; i < g->num_nodes; i++)
+	{
+		g->nodes[i].seen = false;
+	}
+
+	// Return the modified graph
+	return g;
+}
+
+/**
+ * @brief - Destroy a given graph
+ *
+ * @param g - Graph to destroy
+ */
+void graph_kill(graph *g)
+{
+	// Free the labels of all nodes, then the node array
+	for (int i = 0; i < g->num_nodes; i++)
+	{
+		free(g->nodes[i].label);
+	}
+	free(g->nodes);
+
+	// Free the matrix and the label index
+	free(g->matrix);
+	label_index_kill(&g->index);
+
+	// Free the component index and the weights
+	uf_kill(g->components);
+	free(g->weights);
+
+	// And free the graph struct
+	free(g);
+}
+
+// ===========BITSET EXTENSIONS, SEE graph4.h============
+
+/**
+ * @brief - Return the number of words in a node set
+ *
+ * @param g - Graph to inspect
+ * @return int - number of uint64_t words per set
+ */
+int graph_set_words(const graph *g)
+{
+	return g->words;
+}
+
+/**
+ * @brief - Find the unvisited neighbours of a set of nodes
+ *
+ * The rows of all nodes in "frontier" are OR:ed together a word at a
+ * time, and the nodes in "visited" are then masked out.
+ *
+ * @param g - Graph to inspect
+ * @param frontier - set of nodes to expand
+ * @param visited - set of nodes to exclude
+ * @param next - output set
+ * @return int - number of nodes in "next"
+ */
+int graph_expand_frontier(const graph *g, const uint64_t *frontier,
+			  const uint64_t *visited, uint64_t *next)
+{
+	memset(next, 0, g->words * sizeof(uint64_t));
+
+	// OR in the row of each node in the frontier.
+	for (int w = 0; w < g->words; w++)
+	{
+		uint64_t bits = frontier[w];
+		while (bits != 0)
+		{
+			const uint64_t *r = row(g, w * WORD_BITS +
+					       __builtin_ctzll(bits));
+			bits &= bits - 1;
+			for (int k = 0; k < g->words; k++)
+			{
+				next[k] |= r[k];
+			}
+		}
+	}
+
+	// Remove the visited nodes and count the rest.
+	int count = 0;
+	for (int k = 0; k < g->words; k++)
+	{
+		next[k] &= ~visited[k];
+		count += __builtin_popcountll(next[k]);
+	}
+	return count;
+}
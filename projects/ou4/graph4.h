@@ -0,0 +1,46 @@
+#ifndef __GRAPH4_H
+#define __GRAPH4_H
+
+#include <stdint.h>
+#include "graph.h"
+
+/*
+ * Extensions to graph.h provided by the bitset matrix graph in
+ * graph4.c. A set of nodes is represented as a bitset of
+ * graph_set_words() 64-bit words, where bit i (bit i % 64 of word
+ * i / 64) stands for the node with index i, see graph_node_index() in
+ * graph.h. This allows a whole breadth-first search level to be
+ * expanded with word-wide OR and AND operations instead of one node at
+ * a time.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ *   v1.1 2026-10-16: Moved graph_node_index() and graph_node_at() to
+ *                    graph.h.
+ */
+
+/**
+ * graph_set_words() - Return the number of words in a node set.
+ * @g: Graph to inspect.
+ *
+ * Returns: The number of uint64_t words needed for a set of nodes of g.
+ */
+int graph_set_words(const graph *g);
+
+/**
+ * graph_expand_frontier() - Find the unvisited neighbours of a set of nodes.
+ * @g: Graph to inspect.
+ * @frontier: Set of nodes to expand.
+ * @visited: Set of nodes to exclude from the result.
+ * @next: Output set. Receives the union of the neighbours of all nodes
+ *	  in frontier, minus the nodes in visited.
+ *
+ * All sets must have graph_set_words(g) words. next must not overlap
+ * the other sets.
+ *
+ * Returns: The number of nodes in next.
+ */
+int graph_expand_frontier(const graph *g, const uint64_t *frontier,
+			  const uint64_t *visited, uint64_t *next);
+
+#endif
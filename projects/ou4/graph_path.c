@@ -0,0 +1,257 @@
+/*
+ * Breadth-first path queries for the graph implementations used by
+ * "is_connected.c" in the "Data Structures and Algorithms" course
+ * at the Department of Computing Science, Umeå University.
+ *
+ * The search does not use the seen status stored in the nodes, which
+ * would have to be reset for all nodes after each query. Instead, each
+ * node index has a stamp in an array, and a node counts as seen if its
+ * stamp equals the number of the current search. Starting a new search
+ * only increments the search number. The BFS queue is a flat array of
+ * node indices, since each node is put in the queue at most once.
+ *
+ * A search stops as soon as the destination is seen. The state of the
+ * search is kept, so a following query from the same source continues
+ * the same search instead of starting over. Queries from one source to
+ * many destinations thus cost one breadth-first search in total.
+ *
+ * Version information:
+ *	v1.0 2026-10-16 first public version
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include "graph.h"
+#include "graph_path.h"
+
+// ===========INTERNAL DATA TYPES============
+
+/*
+ * Search information for a node. Kept together so that a visit touches
+ * a single cache line.
+ *
+ * "stamp" equals the epoch of the path finder if the node has been seen
+ * in the current search, and then "parent" is the index of the node it
+ * was reached from, or -1 for the source.
+ */
+struct visit
+{
+	unsigned stamp;
+	int parent;
+};
+
+/*
+ * Path finder representation.
+ *
+ * "visits" and "queue" have "capacity" elements. The current search
+ * started at node "src". The nodes queue[0] .. queue[tail - 1] have been
+ * seen, and the neighbours of queue[0] .. queue[head - 1] have been put
+ * in the queue. "src" is -1 if there is no search to continue.
+ */
+struct path_finder
+{
+	const graph *g;
+	struct visit *visits;
+	unsigned epoch;
+	int *queue;
+	int capacity;
+	int src;
+	int head;
+	int tail;
+};
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - Start a new search from a node.
+ *
+ * Grows the arrays if nodes have been added to the graph, and moves
+ * on to the next search number. The stamps only have to be cleared when
+ * the search number wraps around.
+ *
+ * @param pf - Path finder to prepare
+ * @param src - index of the source node
+ */
+static void new_search(path_finder *pf, int src)
+{
+	int n = graph_num_nodes(pf->g);
+	if (n > pf->capacity)
+	{
+		pf->visits = realloc(pf->visits, n * sizeof(struct visit));
+		memset(pf->visits + pf->capacity, 0,
+		       (n - pf->capacity) * sizeof(struct visit));
+		pf->queue = realloc(pf->queue, n * sizeof(int));
+		pf->capacity = n;
+	}
+	if (pf->epoch == UINT_MAX)
+	{
+		memset(pf->visits, 0, pf->capacity * sizeof(struct visit));
+		pf->epoch = 0;
+	}
+	pf->epoch++;
+
+	// Put the source in the queue.
+	pf->src = src;
+	pf->visits[src].stamp = pf->epoch;
+	pf->visits[src].parent = -1;
+	pf->queue[0] = src;
+	pf->head = 0;
+	pf->tail = 1;
+}
+
+/**
+ * @brief - Check if a node has been seen in the current search.
+ *
+ * @param pf - Path finder to inspect
+ * @param i - index of the node
+ * @return bool - true if node i has been seen
+ */
+static bool is_seen(const path_finder *pf, int i)
+{
+	return pf->visits[i].stamp == pf->epoch;
+}
+
+/**
+ * @brief - Breadth-first search from "src" until "dest" is found.
+ *
+ * Continues the current search if it started at "src" and no nodes
+ * have been added to the graph since. The graph must not get new edges
+ * between queries that continue a search.
+ *
+ * @param pf - Path finder to use
+ * @param src - index of the source node
+ * @param dest - index of the destination node
+ * @return bool - true if "dest" was reached, in which case the parent
+ * links lead back from "dest" to "src"
+ */
+static bool search(path_finder *pf, int src, int dest)
+{
+	const graph *g = pf->g;
+
+	if (src != pf->src || graph_num_nodes(g) > pf->capacity)
+	{
+		new_search(pf, src);
+	}
+	if (is_seen(pf, dest))
+	{
+		return true;
+	}
+
+	while (pf->head < pf->tail)
+	{
+		int i = pf->queue[pf->head];
+
+		// Put the unseen neighbours in the queue. Visiting all of them
+		// before stopping keeps the queue consistent for the next
+		// query from the same source.
+		graph_neighbour_iter it;
+		for (node *m = graph_neighbour_begin(g, graph_node_at(g, i), &it);
+		     m != NULL; m = graph_neighbour_next(g, &it))
+		{
+			int j = graph_node_index(g, m);
+			if (!is_seen(pf, j))
+			{
+				pf->visits[j].stamp = pf->epoch;
+				pf->visits[j].parent = i;
+				pf->queue[pf->tail++] = j;
+			}
+		}
+		pf->head++;
+
+		// Stop as soon as the destination has been seen, since it is
+		// then on the shortest path.
+		if (is_seen(pf, dest))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * @brief - Create a path finder for a graph
+ *
+ * @param g - Graph to search in
+ * @return path_finder* - pointer to the created path finder
+ */
+path_finder *path_finder_create(const graph *g)
+{
+	// The arrays are allocated by the first search.
+	path_finder *pf = calloc(1, sizeof(*pf));
+	pf->g = g;
+	pf->epoch = 0;
+	pf->capacity = 0;
+	pf->src = -1;
+	return pf;
+}
+
+/**
+ * @brief - Check if there is a path between two nodes
+ *
+ * @param pf - Path finder for the graph
+ * @param src - source node
+ * @param dest - destination node
+ * @return true - if "dest" can be reached from "src"
+ * @return false - otherwise
+ */
+bool graph_path_exists(path_finder *pf, const node *src, const node *dest)
+{
+	return search(pf, graph_node_index(pf->g, src),
+		      graph_node_index(pf->g, dest));
+}
+
+/**
+ * @brief - Find a path with the fewest edges between two nodes
+ *
+ * @param pf - Path finder for the graph
+ * @param src - source node
+ * @param dest - destination node
+ * @param path - array with room for all nodes in the graph, or NULL
+ * @return int - number of edges on the path, or -1 if there is no path
+ */
+int graph_shortest_hops(path_finder *pf, const node *src, const node *dest,
+			node **path)
+{
+	const graph *g = pf->g;
+	int d = graph_node_index(g, dest);
+
+	if (!search(pf, graph_node_index(g, src), d))
+	{
+		return -1;
+	}
+
+	// Count the edges by following the parent links back to src.
+	int hops = 0;
+	for (int i = pf->visits[d].parent; i != -1; i = pf->visits[i].parent)
+	{
+		hops++;
+	}
+
+	// Fill the path from the end.
+	if (path != NULL)
+	{
+		int k = hops;
+		for (int i = d; i != -1; i = pf->visits[i].parent)
+		{
+			path[k--] = graph_node_at(g, i);
+		}
+	}
+	return hops;
+}
+
+/**
+ * @brief - Destroy a path finder
+ *
+ * @param pf - Path finder to destroy
+ */
+void path_finder_kill(path_finder *pf)
+{
+	free(pf->visits);
+	free(pf->queue);
+	free(pf);
+}
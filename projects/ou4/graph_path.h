@@ -0,0 +1,73 @@
+#ifndef __GRAPH_PATH_H
+#define __GRAPH_PATH_H
+
+#include <stdbool.h>
+#include "graph.h"
+
+/*
+ * Declaration of breadth-first path queries on graphs declared in
+ * graph.h. A path finder holds the memory used by the searches, so
+ * that many queries can be answered on the same graph without
+ * allocating memory or resetting the seen status of the nodes between
+ * queries. Queries from the same source share one search. The path
+ * finder works with all graph implementations.
+ *
+ * Version information:
+ *   v1.0 2026-10-16: First public version.
+ */
+
+// ====================== PUBLIC DATA TYPES ==========================
+
+typedef struct path_finder path_finder;
+
+// =================== PATH FINDER INTERFACE ======================
+
+/**
+ * path_finder_create() - Create a path finder for a graph.
+ * @g: Graph to search in.
+ *
+ * A query may continue a search started by an earlier query from the
+ * same source, so no edges may be inserted into the graph while the
+ * path finder is used. Create a new path finder after changing the
+ * edges. The graph must not be killed while the path finder is used.
+ *
+ * Returns: A pointer to the new path finder.
+ */
+path_finder *path_finder_create(const graph *g);
+
+/**
+ * graph_path_exists() - Check if there is a path between two nodes.
+ * @pf: Path finder for the graph storing the nodes.
+ * @src: Source node.
+ * @dest: Destination node.
+ *
+ * A node always has a path to itself.
+ *
+ * Returns: True if dest can be reached from src, otherwise false.
+ */
+bool graph_path_exists(path_finder *pf, const node *src, const node *dest);
+
+/**
+ * graph_shortest_hops() - Find a path with the fewest edges between two nodes.
+ * @pf: Path finder for the graph storing the nodes.
+ * @src: Source node.
+ * @dest: Destination node.
+ * @path: Array to store the path in, or NULL. If not NULL, it must have
+ *	  room for graph_num_nodes() nodes. On success, path[0] is src and
+ *	  path[hops] is dest.
+ *
+ * Returns: The number of edges on the shortest path from src to dest,
+ *	    or -1 if there is no path.
+ */
+int graph_shortest_hops(path_finder *pf, const node *src, const node *dest,
+			node **path);
+
+/**
+ * path_finder_kill() - Destroy a path finder.
+ * @pf: Path finder to destroy.
+ *
+ * Returns: Nothing.
+ */
+void path_finder_kill(path_finder *pf);
+
+#endif
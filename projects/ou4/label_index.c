@@ -0,0 +1,84 @@
+/*
+ * Label index used by the graph implementations for the "Data
+ * Structures and Algorithms" course at the Department of Computing
+ * Science, Umeå University. See label_index.h.
+ *
+ * Version information:
+ *	v1.0 2026-10-17 first public version
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include "label_index.h"
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * @brief - Compute a hash value for a label (32-bit FNV-1a).
+ *
+ * @param s - start of the label
+ * @param len - length of the label
+ * @return uint32_t - hash value
+ */
+uint32_t label_hash(const char *s, size_t len)
+{
+	uint32_t h = 2166136261u;
+	for (size_t i = 0; i < len; i++)
+	{
+		h ^= (unsigned char)s[i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+/**
+ * @brief - Create an empty label index for a given number of labels.
+ *
+ * @param idx - Index to initialize
+ * @param max_labels - max number of labels allowed
+ */
+void label_index_create(label_index *idx, int max_labels)
+{
+	idx->size = 2;
+	while (idx->size < 2 * max_labels)
+	{
+		idx->size *= 2;
+	}
+	idx->slots = calloc(idx->size, sizeof(int));
+}
+
+/**
+ * @brief - Find the slot in the label index for a given label.
+ *
+ * @param idx - Index to inspect
+ * @param s - label to look for
+ * @param label - function returning the label of an integer
+ * @param context - passed on to "label"
+ * @return int - the slot holding the integer with label "s", or the
+ * empty slot where it should be put
+ */
+int label_index_slot(const label_index *idx, const char *s,
+		     label_function *label, const void *context)
+{
+	int mask = idx->size - 1;
+	int slot = label_hash(s, strlen(s)) & mask;
+	while (idx->slots[slot] != 0 &&
+	       strcmp(label(context, idx->slots[slot] - 1), s) != 0)
+	{
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+
+/**
+ * @brief - Free the slots of a label index.
+ *
+ * @param idx - Index to destroy
+ */
+void label_index_kill(label_index *idx)
+{
+	free(idx->slots);
+	idx->slots = NULL;
+	idx->size = 0;
+}
@@ -0,0 +1,81 @@
+#ifndef __LABEL_INDEX_H
+#define __LABEL_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Declaration of a hash index from labels to the integers 0 .. n - 1,
+ * e.g. from node labels to node indexes. The index does not store the
+ * labels. Instead it is given a function that returns the label of an
+ * integer, so that each graph implementation can keep its labels in
+ * its own way.
+ *
+ * The index is an open-addressing hash table with linear probing. It
+ * is made at least twice as large as the number of labels when it is
+ * created, so that it is never more than half full and no rehashing is
+ * needed.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ */
+
+// ====================== PUBLIC DATA TYPES ==========================
+
+/*
+ * Label index. Slot k of "slots" holds i + 1 for the integer i whose
+ * label hashes to slot k or a slot before it, or 0 if the slot is
+ * empty. "size" is a power of 2. The fields are public so that the
+ * index can be written to and mapped from a file as a plain array.
+ */
+typedef struct label_index {
+	int *slots;
+	int size;
+} label_index;
+
+// Return the label of integer i, given the context passed to
+// label_index_slot().
+typedef const char *label_function(const void *context, int i);
+
+// =================== LABEL INDEX INTERFACE ======================
+
+/**
+ * label_hash() - Compute a hash value for a label (32-bit FNV-1a).
+ * @s: Start of the label.
+ * @len: Length of the label.
+ *
+ * Returns: The hash value of the len characters from s.
+ */
+uint32_t label_hash(const char *s, size_t len);
+
+/**
+ * label_index_create() - Create an empty label index.
+ * @idx: Index to initialize.
+ * @max_labels: Max number of labels in the index.
+ *
+ * Returns: Nothing.
+ */
+void label_index_create(label_index *idx, int max_labels);
+
+/**
+ * label_index_slot() - Find the slot of a label.
+ * @idx: Index to inspect.
+ * @s: Label to look for.
+ * @label: Function that returns the label of an integer in the index.
+ * @context: Passed on to label.
+ *
+ * Returns: The slot holding the integer with label s, or, if there is
+ *	    none, the empty slot where it should be put.
+ */
+int label_index_slot(const label_index *idx, const char *s,
+		     label_function *label, const void *context);
+
+/**
+ * label_index_kill() - Free the slots of a label index.
+ * @idx: Index to destroy.
+ *
+ * Returns: Nothing.
+ */
+void label_index_kill(label_index *idx);
+
+#endif
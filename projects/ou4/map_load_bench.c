@@ -0,0 +1,228 @@
+// Needed for clock_gettime() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+/*
+ * Throughput benchmark for map_load() in map_loader.c.
+ *
+ * Generates a map file of the given size with random edges between
+ * the given number of labels, in the same format as airmap1.map,
+ * including a comment after each edge. The file is then loaded into
+ * the CSR graph in graph3.c, once with map_load() and once by reading
+ * it line by line with fgets() and strtok() and inserting the labels
+ * with graph_insert_node() and graph_find_node(), as is_connected.c
+ * used to. The file has just been written, so it is read from the page
+ * cache in both cases. The file is removed at the end.
+ *
+ * Usage: map_load_bench [size in MB] [number of labels] [file name]
+ *
+ * Compile with:
+ *	gcc -std=c99 -Wall -O2 -I../../code_base/current/include
+ *	    map_load_bench.c map_loader.c graph3.c union_find.c label_index.c
+ *	    ../../code_base/current/src/dlist/dlist.c -o map_load_bench
+ *
+ * Version information:
+ *	v1.0 2026-10-17 first public version
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "graph.h"
+#include "map_loader.h"
+
+// Defaults for the command line arguments.
+#define DEFAULT_MB 1024
+#define DEFAULT_LABELS (1 << 20)
+#define DEFAULT_FILE "map_load_bench.map"
+
+// Longest generated label, and the longest line read by the stdio loader.
+#define LABEL_LENGTH 16
+#define BUFSIZE 400
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - Return the current time in seconds.
+ *
+ * @return double - seconds since an arbitrary point
+ */
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief - Return a pseudo-random number (xorshift64*).
+ *
+ * @param state - generator state, must not be 0
+ * @return uint64_t - the next number
+ */
+static uint64_t next_random(uint64_t *state)
+{
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief - Write the label of a node, in the style of an airport code.
+ *
+ * The label is the number written in base 26 with the letters A-Z,
+ * with at least three letters.
+ *
+ * @param buf - buffer with room for LABEL_LENGTH characters
+ * @param i - number of the node
+ */
+static void make_label(char *buf, long i)
+{
+	char tmp[LABEL_LENGTH];
+	int len = 0;
+	do
+	{
+		tmp[len++] = 'A' + i % 26;
+		i /= 26;
+	} while (i > 0 || len < 3);
+	for (int k = 0; k < len; k++)
+	{
+		buf[k] = tmp[len - 1 - k];
+	}
+	buf[len] = '\0';
+}
+
+/**
+ * @brief - Generate a map file.
+ *
+ * @param filename - name of the file to write
+ * @param bytes - approximate size of the file
+ * @param labels - number of distinct labels
+ * @return long - number of edges written
+ */
+static long generate(const char *filename, long bytes, long labels)
+{
+	FILE *fp = fopen(filename, "w");
+	if (fp == NULL)
+	{
+		fprintf(stderr, "ERROR: could not create %s.\n", filename);
+		exit(EXIT_FAILURE);
+	}
+
+	// The stated number of edges is not known until the end, so leave
+	// room for it and write it last.
+	fprintf(fp, "# Generated by map_load_bench\n%-20d\n", 0);
+
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	char src[LABEL_LENGTH];
+	char dest[LABEL_LENGTH];
+	long edges = 0;
+	long written = 0;
+	while (written < bytes)
+	{
+		make_label(src, next_random(&state) % labels);
+		make_label(dest, next_random(&state) % labels);
+		written += fprintf(fp, "%s %s # %s-%s route %ld\n", src, dest,
+				   src, dest, edges);
+		edges++;
+	}
+	fseek(fp, strlen("# Generated by map_load_bench\n"), SEEK_SET);
+	fprintf(fp, "%-20ld", edges);
+	fclose(fp);
+	return edges;
+}
+
+/**
+ * @brief - Load a map file line by line with stdio.
+ *
+ * @param filename - name of the file to read
+ * @param labels - number of distinct labels in the file
+ * @return graph* - the created graph
+ */
+static graph *stdio_load(const char *filename, long labels)
+{
+	FILE *fp = fopen(filename, "r");
+	char buff[BUFSIZE];
+	bool have_count = false;
+	graph *g = graph_empty(labels);
+
+	while (fgets(buff, BUFSIZE, fp) != NULL)
+	{
+		if (buff[0] == '#')
+		{
+			continue;
+		}
+		if (!have_count)
+		{
+			have_count = true;
+			continue;
+		}
+		char *src = strtok(buff, " \n\t");
+		char *dest = strtok(NULL, " \n\t");
+		g = graph_insert_node(g, src);
+		g = graph_insert_node(g, dest);
+		g = graph_insert_edge(g, graph_find_node(g, src),
+				      graph_find_node(g, dest));
+	}
+	fclose(fp);
+	return g;
+}
+
+/**
+ * @brief - Time a loader, including the construction of the CSR arrays.
+ *
+ * @param name - name of the loader to print
+ * @param g - the loaded graph, is killed
+ * @param t0 - time when the loading started
+ * @param mb - size of the file in MB
+ */
+static void report(const char *name, graph *g, double t0, double mb)
+{
+	// Asking for the neighbours of a node makes graph3.c build the CSR
+	// arrays from all edges.
+	graph_neighbour_iter it;
+	graph_neighbour_begin(g, graph_node_at(g, 0), &it);
+	double t = now() - t0;
+	printf("%-10s %10d %10.2f %10.1f\n", name, graph_num_nodes(g), t,
+	       mb / t);
+	graph_kill(g);
+}
+
+// ===========MAIN============
+
+int main(int argc, char **argv)
+{
+	long mb = argc > 1 ? atol(argv[1]) : DEFAULT_MB;
+	long labels = argc > 2 ? atol(argv[2]) : DEFAULT_LABELS;
+	const char *filename = argc > 3 ? argv[3] : DEFAULT_FILE;
+	if (mb <= 0 || labels <= 0)
+	{
+		fprintf(stderr, "Usage: %s [size in MB] [number of labels] "
+			"[file name]\n", argv[0]);
+		exit(EXIT_FAILURE);
+	}
+
+	double t0 = now();
+	long edges = generate(filename, mb << 20, labels);
+	printf("Generated %s: %ld MB, %ld edges, %ld labels in %.1f s\n\n",
+	       filename, mb, edges, labels, now() - t0);
+
+	printf("%-10s %10s %10s %10s\n", "loader", "nodes", "seconds",
+	       "MB/s");
+	t0 = now();
+	graph *g = map_load(filename);
+	if (g == NULL)
+	{
+		exit(EXIT_FAILURE);
+	}
+	report("map_load", g, t0, mb);
+
+	t0 = now();
+	report("stdio", stdio_load(filename, labels), t0, mb);
+
+	remove(filename);
+	return 0;
+}
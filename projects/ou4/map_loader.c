@@ -0,0 +1,561 @@
+// Needed for mmap() and posix_madvise() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+/*
+ * Memory-mapped loader for the map files used by "is_connected.c" in
+ * the "Data Structures and Algorithms" course at the Department of
+ * Computing Science, Umeå University.
+ *
+ * The file is mapped into memory and read in a single pass, without
+ * copying lines into a buffer or the labels into separate strings.
+ * Each label is looked up in a hash table and, the first time it is
+ * seen, copied into a string arena holding all labels back to back.
+ * The edges are collected as pairs of label numbers. When the whole
+ * file has been read, the graph is created with room for exactly the
+ * labels found, the nodes are inserted in label order, so that label
+ * number i becomes node index i, and the edges are inserted by index.
+ * This avoids looking up the labels again in the graph, and suits the
+ * CSR graph in graph3.c, which sorts all edges in one go.
+ *
+ * Version information:
+ *	v1.0 2026-10-17 first public version
+ *	v1.1 2026-10-17 added edge weights
+ *	v1.2 2026-10-17 label_hash() is shared, see label_index.h
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "graph.h"
+#include "map_loader.h"
+#include "label_index.h"
+
+// Number of labels and edges that room is made for at the start.
+#define INITIAL_LABELS 1024
+#define INITIAL_EDGES 4096
+
+// Number of label bytes that room is made for at the start.
+#define INITIAL_ARENA 16384
+
+// Number of edges whose labels are looked up together, see parse().
+#define BATCH 32
+
+// Longest edge weight, in characters.
+#define WEIGHT_LENGTH 63
+
+// ===========INTERNAL DATA TYPES============
+
+/*
+ * Slot in the hash table of the label table. "label" is the label
+ * number + 1, or 0 for empty slots. The hash value is kept in the slot,
+ * so that most other labels in the way are skipped without looking at
+ * the label itself.
+ */
+struct slot
+{
+	uint32_t hash;
+	int label;
+	size_t start;
+};
+
+/*
+ * Label table.
+ *
+ * "arena" holds the labels found so far, each followed by '\0', and
+ * label i starts at arena[start[i]]. "slots" is a hash table with
+ * "num_slots" slots, a power of two. It is kept at most half full.
+ */
+struct labels
+{
+	char *arena;
+	size_t arena_size;
+	size_t arena_capacity;
+	size_t *start;
+	int num_labels;
+	int capacity;
+	struct slot *slots;
+	int num_slots;
+};
+
+/*
+ * Edges as pairs of label numbers. Edge k goes from label ends[2 * k]
+ * to label ends[2 * k + 1] and has weight weights[k]. "weights" is NULL
+ * as long as all edges have weight 1.
+ */
+struct edges
+{
+	int *ends;
+	double *weights;
+	long num_edges;
+	long capacity;
+};
+
+/*
+ * Label found in the file, waiting to be looked up. "weight" is the
+ * weight of the edge, in the token of its destination.
+ */
+struct token
+{
+	const char *s;
+	size_t len;
+	uint32_t hash;
+	double weight;
+};
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - Find the slot for a label in the label table.
+ *
+ * @param t - Label table
+ * @param s - start of the label
+ * @param len - length of the label
+ * @param h - hash value of the label
+ * @return int - the slot holding the label, or the empty slot where it
+ * should be inserted
+ */
+static int find_slot(const struct labels *t, const char *s, size_t len,
+		     uint32_t h)
+{
+	int mask = t->num_slots - 1;
+	int slot = h & mask;
+	while (t->slots[slot].label != 0)
+	{
+		if (t->slots[slot].hash == h)
+		{
+			// strncmp() stops at the end of l, so it never reads
+			// past a shorter label.
+			const char *l = t->arena + t->slots[slot].start;
+			if (strncmp(l, s, len) == 0 && l[len] == '\0')
+			{
+				break;
+			}
+		}
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+
+/**
+ * @brief - Double the size of the hash table of a label table.
+ *
+ * @param t - Label table to modify
+ */
+static void grow_slots(struct labels *t)
+{
+	struct slot *old = t->slots;
+	int old_size = t->num_slots;
+	t->num_slots *= 2;
+	t->slots = calloc(t->num_slots, sizeof(struct slot));
+	int mask = t->num_slots - 1;
+	for (int i = 0; i < old_size; i++)
+	{
+		if (old[i].label != 0)
+		{
+			// All labels are distinct, so only empty slots need to
+			// be looked for.
+			int slot = old[i].hash & mask;
+			while (t->slots[slot].label != 0)
+			{
+				slot = (slot + 1) & mask;
+			}
+			t->slots[slot] = old[i];
+		}
+	}
+	free(old);
+}
+
+/**
+ * @brief - Return the number of a label, adding it if it is new.
+ *
+ * @param t - Label table
+ * @param s - start of the label, not '\0'-terminated
+ * @param len - length of the label
+ * @param h - hash value of the label
+ * @return int - the label number
+ */
+static int intern(struct labels *t, const char *s, size_t len, uint32_t h)
+{
+	int slot = find_slot(t, s, len, h);
+	if (t->slots[slot].label != 0)
+	{
+		return t->slots[slot].label - 1;
+	}
+
+	// Copy the label into the arena.
+	if (t->arena_size + len + 1 > t->arena_capacity)
+	{
+		while (t->arena_size + len + 1 > t->arena_capacity)
+		{
+			t->arena_capacity *= 2;
+		}
+		t->arena = realloc(t->arena, t->arena_capacity);
+	}
+	if (t->num_labels == t->capacity)
+	{
+		t->capacity *= 2;
+		t->start = realloc(t->start, t->capacity * sizeof(size_t));
+	}
+	memcpy(t->arena + t->arena_size, s, len);
+	t->arena[t->arena_size + len] = '\0';
+	t->start[t->num_labels] = t->arena_size;
+	t->arena_size += len + 1;
+	t->slots[slot].hash = h;
+	t->slots[slot].start = t->start[t->num_labels];
+	t->slots[slot].label = ++t->num_labels;
+
+	if (2 * t->num_labels > t->num_slots)
+	{
+		grow_slots(t);
+	}
+	return t->num_labels - 1;
+}
+
+/**
+ * @brief - Add an edge to an edge list.
+ *
+ * @param e - Edge list
+ * @param src - label number of the source
+ * @param dest - label number of the destination
+ * @param weight - weight of the edge
+ */
+static void add_edge(struct edges *e, int src, int dest, double weight)
+{
+	if (e->num_edges == e->capacity)
+	{
+		e->capacity *= 2;
+		e->ends = realloc(e->ends, 2 * e->capacity * sizeof(int));
+		if (e->weights != NULL)
+		{
+			e->weights = realloc(e->weights,
+					     e->capacity * sizeof(double));
+		}
+	}
+
+	// The first weight other than 1 makes room for all weights.
+	if (e->weights == NULL && weight != 1.0)
+	{
+		e->weights = malloc(e->capacity * sizeof(double));
+		for (long k = 0; k < e->num_edges; k++)
+		{
+			e->weights[k] = 1.0;
+		}
+	}
+	e->ends[2 * e->num_edges] = src;
+	e->ends[2 * e->num_edges + 1] = dest;
+	if (e->weights != NULL)
+	{
+		e->weights[e->num_edges] = weight;
+	}
+	e->num_edges++;
+}
+
+/**
+ * @brief - Hash a label and prefetch its slot in the label table.
+ *
+ * @param t - Label table
+ * @param tok - token to fill in
+ * @param s - start of the label
+ * @param len - length of the label
+ */
+static void prepare(const struct labels *t, struct token *tok, const char *s,
+		    size_t len)
+{
+	tok->s = s;
+	tok->len = len;
+	tok->hash = label_hash(s, len);
+	__builtin_prefetch(&t->slots[tok->hash & (t->num_slots - 1)]);
+}
+
+/**
+ * @brief - Look up the labels of a batch of edges and add the edges.
+ *
+ * @param t - Label table
+ * @param e - Edge list
+ * @param batch - source and destination tokens of the edges
+ * @param n - number of tokens in "batch"
+ */
+static void add_batch(struct labels *t, struct edges *e,
+		      const struct token *batch, int n)
+{
+	for (int k = 0; k < n; k += 2)
+	{
+		int src = intern(t, batch[k].s, batch[k].len, batch[k].hash);
+		int dest = intern(t, batch[k + 1].s, batch[k + 1].len,
+				  batch[k + 1].hash);
+		add_edge(e, src, dest, batch[k + 1].weight);
+	}
+}
+
+/**
+ * @brief - Check if a character is white-space within a line.
+ *
+ * @param c - character to check
+ * @return bool - true for space, tab and carriage return
+ */
+static bool is_blank(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+/**
+ * @brief - Read the weight of an edge, if there is one.
+ *
+ * A weight is a number right after the labels. The file is not
+ * '\0'-terminated, so the number is copied before it is converted.
+ *
+ * @param p - first character after the labels and the white-space
+ * after them
+ * @param eol - end of the line
+ * @param weight - output, the weight, or 1 if there is no weight
+ * @return bool - false if the field after the labels starts like a
+ * number but is not one
+ */
+static bool parse_weight(const char *p, const char *eol, double *weight)
+{
+	*weight = 1.0;
+	if (p == eol || !((*p >= '0' && *p <= '9') || *p == '.'))
+	{
+		return true;
+	}
+	char buf[WEIGHT_LENGTH + 1];
+	size_t len = 0;
+	while (p + len < eol && !is_blank(p[len]) && len < WEIGHT_LENGTH)
+	{
+		buf[len] = p[len];
+		len++;
+	}
+	buf[len] = '\0';
+	char *rest;
+	*weight = strtod(buf, &rest);
+	return *rest == '\0' && (p + len == eol || is_blank(p[len]));
+}
+
+/**
+ * @brief - Read the labels and edges of a mapped map file.
+ *
+ * Almost every label lookup misses the cache on large maps. To overlap
+ * the misses, the labels of BATCH edges are hashed and their slots
+ * prefetched before any of them are looked up.
+ *
+ * @param p - start of the file
+ * @param end - end of the file
+ * @param t - Label table to fill
+ * @param e - Edge list to fill
+ * @param filename - name of the file, for error messages
+ * @return bool - true if the file follows the format
+ */
+static bool parse(const char *p, const char *end, struct labels *t,
+		  struct edges *e, const char *filename)
+{
+	bool have_count = false;
+	long line = 0;
+	struct token batch[2 * BATCH];
+	int n = 0;
+
+	while (p < end)
+	{
+		const char *eol = memchr(p, '\n', end - p);
+		if (eol == NULL)
+		{
+			eol = end;
+		}
+		line++;
+
+		// Skip blank and comment lines.
+		while (p < eol && is_blank(*p))
+		{
+			p++;
+		}
+		if (p == eol || *p == '#')
+		{
+			p = eol + 1;
+			continue;
+		}
+
+		// The first other line holds the number of edges. It is only
+		// used to make room for the edges, limited by the number of
+		// lines that fit in the file.
+		if (!have_count)
+		{
+			if (*p < '0' || *p > '9')
+			{
+				fprintf(stderr, "ERROR: %s:%ld: expected the number "
+					"of edges.\n", filename, line);
+				return false;
+			}
+			long count = strtol(p, NULL, 10);
+			if (count > (end - p) / 4)
+			{
+				count = (end - p) / 4;
+			}
+			if (count > e->capacity)
+			{
+				e->capacity = count;
+				e->ends = realloc(e->ends,
+						  2 * e->capacity * sizeof(int));
+				if (e->weights != NULL)
+				{
+					e->weights = realloc(e->weights,
+							     e->capacity *
+							     sizeof(double));
+				}
+			}
+			have_count = true;
+			p = eol + 1;
+			continue;
+		}
+
+		// Find the two labels and the weight. The rest of the line
+		// is ignored.
+		const char *src = p;
+		while (p < eol && !is_blank(*p))
+		{
+			p++;
+		}
+		size_t src_len = p - src;
+		while (p < eol && is_blank(*p))
+		{
+			p++;
+		}
+		const char *dest = p;
+		while (p < eol && !is_blank(*p))
+		{
+			p++;
+		}
+		size_t dest_len = p - dest;
+		if (dest_len == 0)
+		{
+			fprintf(stderr, "ERROR: %s:%ld: expected two labels.\n",
+				filename, line);
+			return false;
+		}
+
+		while (p < eol && is_blank(*p))
+		{
+			p++;
+		}
+		double weight;
+		if (!parse_weight(p, eol, &weight))
+		{
+			fprintf(stderr, "ERROR: %s:%ld: bad edge weight.\n",
+				filename, line);
+			return false;
+		}
+
+		prepare(t, &batch[n++], src, src_len);
+		prepare(t, &batch[n], dest, dest_len);
+		batch[n++].weight = weight;
+		if (n == 2 * BATCH)
+		{
+			add_batch(t, e, batch, n);
+			n = 0;
+		}
+		p = eol + 1;
+	}
+	if (n > 0)
+	{
+		add_batch(t, e, batch, n);
+	}
+
+	if (!have_count)
+	{
+		fprintf(stderr, "ERROR: %s: the number of edges is missing.\n",
+			filename);
+	}
+	return have_count;
+}
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * @brief - Create a graph from a map file
+ *
+ * @param filename - name of the file to read
+ * @return graph* - the created graph, or NULL on failure
+ */
+graph *map_load(const char *filename)
+{
+	int fd = open(filename, O_RDONLY);
+	if (fd == -1)
+	{
+		fprintf(stderr, "ERROR: could not open %s.\n", filename);
+		return NULL;
+	}
+	struct stat st;
+	if (fstat(fd, &st) == -1)
+	{
+		fprintf(stderr, "ERROR: could not read %s.\n", filename);
+		close(fd);
+		return NULL;
+	}
+
+	// An empty file cannot be mapped, and lacks the number of edges.
+	const char *data = NULL;
+	size_t size = st.st_size;
+	if (size > 0)
+	{
+		data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED)
+		{
+			fprintf(stderr, "ERROR: could not map %s.\n", filename);
+			close(fd);
+			return NULL;
+		}
+		posix_madvise((void *)data, size, POSIX_MADV_SEQUENTIAL);
+	}
+	close(fd);
+
+	struct labels t;
+	t.arena_capacity = INITIAL_ARENA;
+	t.arena = malloc(t.arena_capacity);
+	t.arena_size = 0;
+	t.capacity = INITIAL_LABELS;
+	t.start = malloc(t.capacity * sizeof(size_t));
+	t.num_labels = 0;
+	t.num_slots = 2 * INITIAL_LABELS;
+	t.slots = calloc(t.num_slots, sizeof(struct slot));
+
+	struct edges e;
+	e.capacity = INITIAL_EDGES;
+	e.ends = malloc(2 * e.capacity * sizeof(int));
+	e.weights = NULL;
+	e.num_edges = 0;
+
+	bool ok = parse(data, data + size, &t, &e, filename);
+	if (size > 0)
+	{
+		munmap((void *)data, size);
+	}
+	free(t.slots);
+
+	// Build the graph. Label i becomes node i.
+	graph *g = NULL;
+	if (ok)
+	{
+		g = graph_empty(t.num_labels);
+		for (int i = 0; i < t.num_labels; i++)
+		{
+			g = graph_insert_node(g, t.arena + t.start[i]);
+		}
+		for (long k = 0; k < e.num_edges; k++)
+		{
+			g = graph_insert_weighted_edge(
+				g, graph_node_at(g, e.ends[2 * k]),
+				graph_node_at(g, e.ends[2 * k + 1]),
+				e.weights != NULL ? e.weights[k] : 1.0);
+		}
+	}
+
+	free(t.arena);
+	free(t.start);
+	free(e.ends);
+	free(e.weights);
+	return g;
+}
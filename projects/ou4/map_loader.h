@@ -0,0 +1,42 @@
+#ifndef __MAP_LOADER_H
+#define __MAP_LOADER_H
+
+#include "graph.h"
+
+/*
+ * Declaration of a loader for map files in the format used by
+ * is_connected.c. A map file consists of
+ *  - comment lines starting with '#' and blank lines, anywhere,
+ *  - a line with the number of edges, before the first edge,
+ *  - one line per edge with the labels of the source and destination
+ *    nodes, separated by white-space and optionally followed by more
+ *    text, e.g. "UME BMA # Umea-Bromma". If the text starts with a
+ *    number, e.g. "UME BMA 515 # km", the number is the weight of the
+ *    edge, see graph_insert_weighted_edge() in graph.h. Other edges
+ *    have weight 1.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ *   v1.1 2026-10-17: Added edge weights.
+ */
+
+// ====================== MAP LOADER INTERFACE ======================
+
+/**
+ * map_load() - Create a graph from a map file.
+ * @filename: Name of the file to read.
+ *
+ * The graph gets exactly as many nodes as there are distinct labels in
+ * the file, numbered in the order they first appear, see
+ * graph_node_index() in graph.h. The number of edges stated in the file
+ * is not used to size the graph, so files with more edges than stated
+ * are accepted.
+ *
+ * Errors are reported on stderr.
+ *
+ * Returns: The new graph, or NULL if the file could not be read or does
+ *	    not follow the format.
+ */
+graph *map_load(const char *filename);
+
+#endif
@@ -0,0 +1,485 @@
+// Needed for pthread_barrier_t with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+/*
+ * Direction-optimizing parallel breadth-first search over the CSR
+ * graph in graph3.c, for the "Data Structures and Algorithms" course
+ * at the Department of Computing Science, Umeå University.
+ *
+ * The search is level-synchronous. All threads expand the current
+ * level, wait at a barrier, and thread 0 then prepares the next level
+ * alone. The work of a level is handed out in chunks of CHUNK nodes
+ * through an atomic counter, so threads that get nodes with many
+ * edges do not hold up the others. Each thread collects the nodes it
+ * finds in a local frontier that is copied into the shared frontier
+ * at the end of the level.
+ *
+ * A level is expanded either top-down or bottom-up, chosen as in
+ * Beamer, Asanovic and Patterson, "Direction-Optimizing Breadth-First
+ * Search", SC 2012:
+ *  - Top-down: every edge out of the frontier is checked. A node is
+ *    claimed by setting its bit in the visited bitmap with an atomic
+ *    OR, so that each node is added by exactly one thread.
+ *  - Bottom-up: every unvisited node checks its incoming edges for a
+ *    parent in the frontier, which is stored as a bitmap, and stops at
+ *    the first one. The chunks are whole bitmap words, so each node is
+ *    only handled by one thread.
+ * The search switches to bottom-up when the edges out of the frontier
+ * outnumber the edges of the unvisited nodes divided by ALPHA, and back
+ * to top-down when the frontier has fewer than N / BETA nodes.
+ *
+ * Compile with -pthread.
+ *
+ * Version information:
+ *	v1.0 2026-10-17 first public version
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "graph.h"
+#include "graph3.h"
+#include "parallel_bfs.h"
+
+// Switching thresholds, see the top of the file.
+#define ALPHA 14
+#define BETA 24
+
+// Number of nodes in a work chunk. Must be a multiple of 64.
+#define CHUNK 256
+
+// Number of nodes that room is made for in a new local frontier.
+#define INITIAL_LOCAL_NODES 1024
+
+// ===========INTERNAL DATA TYPES============
+
+/*
+ * Nodes found by one thread during the current level. "edges" is the
+ * sum of their out-degrees, and "checked" counts the edges looked at
+ * during the whole search.
+ */
+struct local
+{
+	int *nodes;
+	int size;
+	int capacity;
+	long edges;
+	long checked;
+};
+
+/*
+ * State shared by the threads of a search.
+ *
+ * "frontier" holds the "frontier_size" nodes of the current level, and
+ * the threads put the nodes of the next level in "next". "visited" and
+ * "front" are bitmaps over all nodes; "front" holds the frontier during
+ * bottom-up levels. "chunk" and "front_chunk" hand out the work.
+ *
+ * Everything that is not atomic is only written by thread 0 between
+ * the barriers, or by the single thread that owns a node.
+ */
+struct bfs
+{
+	const int *offsets;
+	const int *targets;
+	const int *rev_offsets;
+	const int *rev_sources;
+	int n;
+	int *dist;
+
+	_Atomic uint64_t *visited;
+	_Atomic uint64_t *front;
+	int words;
+
+	int *frontier;
+	int frontier_size;
+	long frontier_edges;
+	int *next;
+	atomic_int next_size;
+	atomic_long next_edges;
+	long unvisited_edges;
+
+	atomic_int chunk;
+	atomic_int front_chunk;
+	int level;
+	bool bottom_up;
+	bool done;
+	int bottom_up_levels;
+
+	pthread_barrier_t barrier;
+	struct local *locals;
+};
+
+/*
+ * Argument to a worker thread.
+ */
+struct worker_arg
+{
+	struct bfs *b;
+	int t;
+};
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - Add a node to a local frontier.
+ *
+ * @param b - Search state
+ * @param l - Local frontier
+ * @param v - index of the node
+ */
+static void local_push(const struct bfs *b, struct local *l, int v)
+{
+	if (l->size == l->capacity)
+	{
+		l->capacity *= 2;
+		l->nodes = realloc(l->nodes, l->capacity * sizeof(int));
+	}
+	l->nodes[l->size++] = v;
+	l->edges += b->offsets[v + 1] - b->offsets[v];
+}
+
+/**
+ * @brief - Claim a node during a top-down level.
+ *
+ * @param b - Search state
+ * @param v - index of the node
+ * @return bool - true if this thread set the visited bit of the node
+ */
+static bool claim(struct bfs *b, int v)
+{
+	_Atomic uint64_t *w = &b->visited[v / 64];
+	uint64_t bit = (uint64_t)1 << (v % 64);
+
+	// Read first, so that the atomic OR is only done for nodes that
+	// are likely to be unvisited.
+	if (atomic_load_explicit(w, memory_order_relaxed) & bit)
+	{
+		return false;
+	}
+	return (atomic_fetch_or_explicit(w, bit, memory_order_relaxed) & bit)
+		== 0;
+}
+
+/**
+ * @brief - Expand chunks of the frontier top-down.
+ *
+ * @param b - Search state
+ * @param l - Local frontier of the calling thread
+ */
+static void top_down(struct bfs *b, struct local *l)
+{
+	int c;
+	while ((c = atomic_fetch_add(&b->chunk, 1) * CHUNK) < b->frontier_size)
+	{
+		int end = c + CHUNK < b->frontier_size ? c + CHUNK
+						      : b->frontier_size;
+		for (int f = c; f < end; f++)
+		{
+			int u = b->frontier[f];
+			for (int k = b->offsets[u]; k < b->offsets[u + 1]; k++)
+			{
+				int v = b->targets[k];
+				if (claim(b, v))
+				{
+					b->dist[v] = b->level + 1;
+					local_push(b, l, v);
+				}
+			}
+			l->checked += b->offsets[u + 1] - b->offsets[u];
+		}
+	}
+}
+
+/**
+ * @brief - Put chunks of the frontier into the frontier bitmap.
+ *
+ * @param b - Search state
+ */
+static void fill_front(struct bfs *b)
+{
+	int c;
+	while ((c = atomic_fetch_add(&b->front_chunk, 1) * CHUNK) <
+	       b->frontier_size)
+	{
+		int end = c + CHUNK < b->frontier_size ? c + CHUNK
+						      : b->frontier_size;
+		for (int f = c; f < end; f++)
+		{
+			int u = b->frontier[f];
+			atomic_fetch_or_explicit(&b->front[u / 64],
+						 (uint64_t)1 << (u % 64),
+						 memory_order_relaxed);
+		}
+	}
+}
+
+/**
+ * @brief - Let chunks of unvisited nodes look for parents in the frontier.
+ *
+ * @param b - Search state
+ * @param l - Local frontier of the calling thread
+ */
+static void bottom_up(struct bfs *b, struct local *l)
+{
+	int c;
+	while ((c = atomic_fetch_add(&b->chunk, 1) * CHUNK) < b->n)
+	{
+		int end = c + CHUNK < b->n ? c + CHUNK : b->n;
+		for (int w = c / 64; w * 64 < end; w++)
+		{
+			// The chunk owns these words, so no other thread
+			// changes them during the level.
+			uint64_t seen = atomic_load_explicit(&b->visited[w],
+							     memory_order_relaxed);
+			uint64_t found = 0;
+			if (seen == ~(uint64_t)0)
+			{
+				continue;
+			}
+			for (int v = w * 64; v < w * 64 + 64 && v < end; v++)
+			{
+				if (seen & ((uint64_t)1 << (v % 64)))
+				{
+					continue;
+				}
+				for (int k = b->rev_offsets[v];
+				     k < b->rev_offsets[v + 1]; k++)
+				{
+					int u = b->rev_sources[k];
+					l->checked++;
+					if (atomic_load_explicit(&b->front[u / 64],
+								 memory_order_relaxed) &
+					    ((uint64_t)1 << (u % 64)))
+					{
+						found |= (uint64_t)1 << (v % 64);
+						b->dist[v] = b->level + 1;
+						local_push(b, l, v);
+						break;
+					}
+				}
+			}
+			if (found != 0)
+			{
+				atomic_fetch_or_explicit(&b->visited[w], found,
+							 memory_order_relaxed);
+			}
+		}
+	}
+}
+
+/**
+ * @brief - Copy a local frontier into the shared next frontier.
+ *
+ * @param b - Search state
+ * @param l - Local frontier to copy and empty
+ */
+static void flush_local(struct bfs *b, struct local *l)
+{
+	int pos = atomic_fetch_add(&b->next_size, l->size);
+	memcpy(b->next + pos, l->nodes, l->size * sizeof(int));
+	atomic_fetch_add(&b->next_edges, l->edges);
+	l->size = 0;
+	l->edges = 0;
+}
+
+/**
+ * @brief - Prepare the next level. Called by thread 0 only.
+ *
+ * @param b - Search state
+ */
+static void next_level(struct bfs *b)
+{
+	// The next frontier becomes the current one.
+	int *tmp = b->frontier;
+	b->frontier = b->next;
+	b->next = tmp;
+	b->frontier_size = atomic_load(&b->next_size);
+	b->frontier_edges = atomic_load(&b->next_edges);
+	b->unvisited_edges -= b->frontier_edges;
+	atomic_store(&b->next_size, 0);
+	atomic_store(&b->next_edges, 0);
+	b->level++;
+	if (b->frontier_size == 0)
+	{
+		b->done = true;
+		return;
+	}
+
+	// Choose the direction of the next level.
+	if (!b->bottom_up && b->frontier_edges > b->unvisited_edges / ALPHA)
+	{
+		b->bottom_up = true;
+	}
+	else if (b->bottom_up && b->frontier_size < b->n / BETA)
+	{
+		b->bottom_up = false;
+	}
+	if (b->bottom_up)
+	{
+		memset(b->front, 0, b->words * sizeof(uint64_t));
+		b->bottom_up_levels++;
+	}
+	atomic_store(&b->chunk, 0);
+	atomic_store(&b->front_chunk, 0);
+}
+
+/**
+ * @brief - Expand levels until the search is done.
+ *
+ * Run by all threads, with t = 0 for the calling thread.
+ *
+ * @param arg - worker_arg for the thread
+ * @return void* - NULL
+ */
+static void *worker(void *arg)
+{
+	struct bfs *b = ((struct worker_arg *)arg)->b;
+	int t = ((struct worker_arg *)arg)->t;
+	struct local *l = &b->locals[t];
+
+	while (true)
+	{
+		// Wait until the level has been prepared.
+		pthread_barrier_wait(&b->barrier);
+		if (b->done)
+		{
+			break;
+		}
+		if (b->bottom_up)
+		{
+			fill_front(b);
+			pthread_barrier_wait(&b->barrier);
+			bottom_up(b, l);
+		}
+		else
+		{
+			top_down(b, l);
+		}
+		flush_local(b, l);
+
+		// Wait until all threads are done with the level.
+		pthread_barrier_wait(&b->barrier);
+		if (t == 0)
+		{
+			next_level(b);
+		}
+	}
+	return NULL;
+}
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * @brief - Breadth-first search using several threads
+ *
+ * @param g - Graph from graph3.c to search in
+ * @param src - source node
+ * @param threads - number of threads, including the calling thread
+ * @param dist - output array with one element per node
+ * @param stats - output statistics, or NULL
+ * @return int - number of nodes reached from "src"
+ */
+int graph_bfs_parallel(const graph *g, const node *src, int threads,
+		       int *dist, bfs_stats *stats)
+{
+	struct bfs b;
+	int s = graph_node_index(g, src);
+
+	if (threads < 1)
+	{
+		threads = 1;
+	}
+
+	// Set up the shared state.
+	graph_csr(g, &b.offsets, &b.targets);
+	graph_csr_reverse(g, &b.rev_offsets, &b.rev_sources);
+	b.n = graph_num_nodes(g);
+	b.dist = dist;
+	b.words = (b.n + 63) / 64;
+	b.visited = calloc(b.words, sizeof(uint64_t));
+	b.front = calloc(b.words, sizeof(uint64_t));
+	b.frontier = malloc(b.n * sizeof(int));
+	b.next = malloc(b.n * sizeof(int));
+	atomic_init(&b.next_size, 0);
+	atomic_init(&b.next_edges, 0);
+	atomic_init(&b.chunk, 0);
+	atomic_init(&b.front_chunk, 0);
+	b.level = 0;
+	b.bottom_up = false;
+	b.done = false;
+	b.bottom_up_levels = 0;
+	pthread_barrier_init(&b.barrier, NULL, threads);
+	b.locals = calloc(threads, sizeof(struct local));
+	for (int t = 0; t < threads; t++)
+	{
+		b.locals[t].capacity = INITIAL_LOCAL_NODES;
+		b.locals[t].nodes = malloc(INITIAL_LOCAL_NODES * sizeof(int));
+	}
+
+	// The first level holds the source only.
+	for (int i = 0; i < b.n; i++)
+	{
+		dist[i] = -1;
+	}
+	dist[s] = 0;
+	b.visited[s / 64] = (uint64_t)1 << (s % 64);
+	b.frontier[0] = s;
+	b.frontier_size = 1;
+	b.frontier_edges = b.offsets[s + 1] - b.offsets[s];
+	b.unvisited_edges = b.offsets[b.n] - b.frontier_edges;
+
+	// Start the helper threads and take part as thread 0.
+	pthread_t *tid = calloc(threads, sizeof(pthread_t));
+	struct worker_arg *args = calloc(threads, sizeof(struct worker_arg));
+	for (int t = 0; t < threads; t++)
+	{
+		args[t].b = &b;
+		args[t].t = t;
+	}
+	for (int t = 1; t < threads; t++)
+	{
+		pthread_create(&tid[t], NULL, worker, &args[t]);
+	}
+	worker(&args[0]);
+	for (int t = 1; t < threads; t++)
+	{
+		pthread_join(tid[t], NULL);
+	}
+
+	// Count the nodes reached and collect the statistics.
+	int reached = 0;
+	for (int w = 0; w < b.words; w++)
+	{
+		reached += __builtin_popcountll(b.visited[w]);
+	}
+	if (stats != NULL)
+	{
+		stats->levels = b.level;
+		stats->bottom_up_levels = b.bottom_up_levels;
+		stats->edges_checked = 0;
+		for (int t = 0; t < threads; t++)
+		{
+			stats->edges_checked += b.locals[t].checked;
+		}
+	}
+
+	// Clean up.
+	for (int t = 0; t < threads; t++)
+	{
+		free(b.locals[t].nodes);
+	}
+	free(b.locals);
+	free(args);
+	free(tid);
+	pthread_barrier_destroy(&b.barrier);
+	free(b.visited);
+	free(b.front);
+	free(b.frontier);
+	free(b.next);
+	return reached;
+}
@@ -0,0 +1,45 @@
+#ifndef __PARALLEL_BFS_H
+#define __PARALLEL_BFS_H
+
+#include "graph.h"
+
+/*
+ * Declaration of a parallel breadth-first search for the CSR graph in
+ * graph3.c. The search visits the graph one level at a time with
+ * several threads. Small levels are expanded top-down, from the nodes
+ * in the frontier to their neighbours. Large levels are expanded
+ * bottom-up: each unvisited node looks for a parent in the frontier
+ * and stops at the first one found, which checks far fewer edges when
+ * the frontier covers a large part of the graph.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ */
+
+// ====================== PUBLIC DATA TYPES ==========================
+
+// Statistics for a search, see graph_bfs_parallel().
+typedef struct bfs_stats {
+	int levels; // Number of levels expanded.
+	int bottom_up_levels; // Number of levels expanded bottom-up.
+	long edges_checked; // Number of edges looked at.
+} bfs_stats;
+
+// ====================== PARALLEL BFS INTERFACE ======================
+
+/**
+ * graph_bfs_parallel() - Breadth-first search using several threads.
+ * @g: Graph to search in. Must be a graph from graph3.c.
+ * @src: Source node.
+ * @threads: Number of threads to use, including the calling thread.
+ * @dist: Output array with graph_num_nodes() elements. Receives the
+ *	  number of edges on a shortest path from src to each node, or -1
+ *	  for nodes that cannot be reached from src.
+ * @stats: Output, or NULL. Receives statistics for the search.
+ *
+ * Returns: The number of nodes reached from src, including src.
+ */
+int graph_bfs_parallel(const graph *g, const node *src, int threads,
+		       int *dist, bfs_stats *stats);
+
+#endif
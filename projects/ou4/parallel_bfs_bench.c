@@ -0,0 +1,366 @@
+// Needed for clock_gettime() and sysconf() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+/*
+ * Scaling benchmark for graph_bfs_parallel() in parallel_bfs.c.
+ *
+ * Builds an undirected R-MAT graph (Chakrabarti, Zhan and Faloutsos,
+ * "R-MAT: A Recursive Model for Graph Mining", SDM 2004) with the CSR
+ * graph in graph3.c. R-MAT graphs have a power-law degree distribution
+ * like social and road-like networks with hubs, and are the graphs
+ * used by the Graph500 benchmark. A number of breadth-first searches
+ * from random sources are then timed with 1, 2, 4, ... threads up to
+ * the given maximum, and with a plain serial top-down search for
+ * comparison. The result of every search is checked against the
+ * serial search.
+ *
+ * Usage: parallel_bfs_bench [scale] [edge factor] [max threads] [searches]
+ *
+ * The graph has 2^scale nodes and edge factor * 2^scale undirected
+ * edges before duplicates are removed. The default for max threads is
+ * the number of online processors.
+ *
+ * Compile with:
+ *	gcc -std=c99 -Wall -O2 -pthread -I../../code_base/current/include
+ *	    parallel_bfs_bench.c parallel_bfs.c graph3.c union_find.c
+ *	    label_index.c ../../code_base/current/src/dlist/dlist.c
+ *	    -o parallel_bfs_bench
+ *
+ * Version information:
+ *	v1.0 2026-10-17 first public version
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "graph.h"
+#include "graph3.h"
+#include "parallel_bfs.h"
+
+// Defaults for the command line arguments.
+#define DEFAULT_SCALE 16
+#define DEFAULT_EDGE_FACTOR 16
+#define DEFAULT_SEARCHES 8
+
+// R-MAT quadrant probabilities, as in Graph500. D = 1 - A - B - C.
+#define RMAT_A 0.57
+#define RMAT_B 0.19
+#define RMAT_C 0.19
+
+// Longest node label, "n" followed by at most 10 digits.
+#define LABEL_LENGTH 16
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - Return the current time in seconds.
+ *
+ * @return double - seconds since an arbitrary point
+ */
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief - Return a pseudo-random number (xorshift64*).
+ *
+ * @param state - generator state, must not be 0
+ * @return uint64_t - the next number
+ */
+static uint64_t next_random(uint64_t *state)
+{
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief - Return a pseudo-random number in [0, 1).
+ *
+ * @param state - generator state
+ * @return double - the number
+ */
+static double next_double(uint64_t *state)
+{
+	return (next_random(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief - Create an R-MAT graph.
+ *
+ * Each edge is placed by choosing one of the four quadrants of the
+ * adjacency matrix "scale" times. Self-loops are skipped.
+ *
+ * @param scale - the graph gets 2^scale nodes
+ * @param edge_factor - number of edges per node
+ * @param state - generator state
+ * @return graph* - the created graph
+ */
+static graph *rmat_graph(int scale, int edge_factor, uint64_t *state)
+{
+	int n = 1 << scale;
+	long m = (long)edge_factor * n;
+	char label[LABEL_LENGTH];
+	graph *g = graph_empty(n);
+
+	for (int i = 0; i < n; i++)
+	{
+		snprintf(label, sizeof(label), "n%d", i);
+		graph_insert_node(g, label);
+	}
+	for (long e = 0; e < m; e++)
+	{
+		int u = 0;
+		int v = 0;
+		for (int bit = 0; bit < scale; bit++)
+		{
+			double r = next_double(state);
+			u <<= 1;
+			v <<= 1;
+			if (r >= RMAT_A + RMAT_B + RMAT_C)
+			{
+				u |= 1;
+				v |= 1;
+			}
+			else if (r >= RMAT_A + RMAT_B)
+			{
+				u |= 1;
+			}
+			else if (r >= RMAT_A)
+			{
+				v |= 1;
+			}
+		}
+		if (u != v)
+		{
+			graph_insert_edge(g, graph_node_at(g, u), graph_node_at(g, v));
+			graph_insert_edge(g, graph_node_at(g, v), graph_node_at(g, u));
+		}
+	}
+	return g;
+}
+
+/**
+ * @brief - Serial top-down breadth-first search, used as reference.
+ *
+ * @param g - Graph from graph3.c
+ * @param s - index of the source node
+ * @param dist - output array with one element per node
+ * @param queue - array with one element per node
+ * @return int - number of nodes reached
+ */
+static int serial_bfs(const graph *g, int s, int *dist, int *queue)
+{
+	const int *offsets;
+	const int *targets;
+	int n = graph_num_nodes(g);
+	int head = 0;
+	int tail = 0;
+
+	graph_csr(g, &offsets, &targets);
+	for (int i = 0; i < n; i++)
+	{
+		dist[i] = -1;
+	}
+	dist[s] = 0;
+	queue[tail++] = s;
+	while (head < tail)
+	{
+		int u = queue[head++];
+		for (int k = offsets[u]; k < offsets[u + 1]; k++)
+		{
+			int v = targets[k];
+			if (dist[v] == -1)
+			{
+				dist[v] = dist[u] + 1;
+				queue[tail++] = v;
+			}
+		}
+	}
+	return tail;
+}
+
+/**
+ * @brief - Count the edges out of the nodes reached by a search.
+ *
+ * Used as the number of traversed edges when computing TEPS.
+ *
+ * @param g - Graph from graph3.c
+ * @param dist - distances from the search
+ * @return long - number of edges out of reached nodes
+ */
+static long reached_edges(const graph *g, const int *dist)
+{
+	const int *offsets;
+	const int *targets;
+	long edges = 0;
+
+	graph_csr(g, &offsets, &targets);
+	for (int i = 0; i < graph_num_nodes(g); i++)
+	{
+		if (dist[i] != -1)
+		{
+			edges += offsets[i + 1] - offsets[i];
+		}
+	}
+	return edges;
+}
+
+/**
+ * @brief - Step to the next number of threads to time.
+ *
+ * Doubles the number of threads, but always ends with "max".
+ *
+ * @param threads - the current number of threads
+ * @param max - the largest number of threads
+ * @return int - the next number of threads, larger than "max" when done
+ */
+static int next_thread_count(int threads, int max)
+{
+	if (threads < max && threads * 2 > max)
+	{
+		return max;
+	}
+	return threads * 2;
+}
+
+/**
+ * @brief - Parse a positive command line argument.
+ *
+ * @param argc - number of arguments
+ * @param argv - the arguments
+ * @param i - index of the argument
+ * @param def - value to use if the argument is missing
+ * @return int - the value of the argument
+ */
+static int int_arg(int argc, char **argv, int i, int def)
+{
+	if (argc <= i)
+	{
+		return def;
+	}
+	int v = atoi(argv[i]);
+	if (v <= 0)
+	{
+		fprintf(stderr, "Invalid argument \"%s\".\n", argv[i]);
+		exit(EXIT_FAILURE);
+	}
+	return v;
+}
+
+// ===========MAIN============
+
+int main(int argc, char **argv)
+{
+	int scale = int_arg(argc, argv, 1, DEFAULT_SCALE);
+	int edge_factor = int_arg(argc, argv, 2, DEFAULT_EDGE_FACTOR);
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	int max_threads = int_arg(argc, argv, 3, cpus > 0 ? cpus : 1);
+	int searches = int_arg(argc, argv, 4, DEFAULT_SEARCHES);
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+	if (scale > 30)
+	{
+		fprintf(stderr, "Scale must be at most 30.\n");
+		exit(EXIT_FAILURE);
+	}
+
+	// Build the graph, including the reverse edges used by bottom-up
+	// levels, outside the timed searches.
+	double t0 = now();
+	graph *g = rmat_graph(scale, edge_factor, &state);
+	const int *offsets;
+	const int *targets;
+	const int *rev_offsets;
+	const int *rev_sources;
+	graph_csr(g, &offsets, &targets);
+	graph_csr_reverse(g, &rev_offsets, &rev_sources);
+	int n = graph_num_nodes(g);
+	printf("R-MAT graph: scale %d, %d nodes, %d directed edges, built in "
+	       "%.2f s\n", scale, n, offsets[n], now() - t0);
+	printf("Processors online: %ld\n\n", cpus);
+
+	// Choose sources with at least one edge, and compute the expected
+	// results.
+	int *sources = malloc(searches * sizeof(int));
+	int **expected = malloc(searches * sizeof(int *));
+	int *queue = malloc(n * sizeof(int));
+	int *dist = malloc(n * sizeof(int));
+	long edges = 0;
+	for (int s = 0; s < searches; s++)
+	{
+		do
+		{
+			sources[s] = next_random(&state) % n;
+		} while (offsets[sources[s] + 1] == offsets[sources[s]]);
+		expected[s] = malloc(n * sizeof(int));
+		serial_bfs(g, sources[s], expected[s], queue);
+		edges += reached_edges(g, expected[s]);
+	}
+
+	// Time the serial reference search.
+	t0 = now();
+	for (int s = 0; s < searches; s++)
+	{
+		serial_bfs(g, sources[s], dist, queue);
+	}
+	double serial = (now() - t0) / searches;
+	printf("%-10s %12s %10s %10s %10s\n", "threads", "ms/search",
+	       "MTEPS", "speedup", "bottom-up");
+	printf("%-10s %12.3f %10.1f %10s %10s\n", "serial", serial * 1e3,
+	       edges / searches / serial * 1e-6, "-", "-");
+
+	// Time the parallel search. The speedup is relative to the
+	// parallel search with one thread.
+	double single = 0;
+	bool ok = true;
+	for (int threads = 1; threads <= max_threads;
+	     threads = next_thread_count(threads, max_threads))
+	{
+		bfs_stats stats;
+		int bottom_up = 0;
+		int levels = 0;
+
+		t0 = now();
+		for (int s = 0; s < searches; s++)
+		{
+			graph_bfs_parallel(g, graph_node_at(g, sources[s]), threads,
+					   dist, &stats);
+			bottom_up += stats.bottom_up_levels;
+			levels += stats.levels;
+			if (memcmp(dist, expected[s], n * sizeof(int)) != 0)
+			{
+				fprintf(stderr, "Wrong distances with %d threads from "
+					"node %d.\n", threads, sources[s]);
+				ok = false;
+			}
+		}
+		double t = (now() - t0) / searches;
+		if (threads == 1)
+		{
+			single = t;
+		}
+		printf("%-10d %12.3f %10.1f %10.2f %6d/%-3d\n", threads, t * 1e3,
+		       edges / searches / t * 1e-6, single / t, bottom_up,
+		       levels);
+	}
+
+	for (int s = 0; s < searches; s++)
+	{
+		free(expected[s]);
+	}
+	free(expected);
+	free(sources);
+	free(queue);
+	free(dist);
+	graph_kill(g);
+	return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
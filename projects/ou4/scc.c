@@ -0,0 +1,214 @@
+/*
+ * Strongly connected components for the graph implementations used by
+ * "is_connected.c" in the "Data Structures and Algorithms" course at
+ * the Department of Computing Science, Umeå University.
+ *
+ * The components are found with Tarjan's algorithm. The depth-first
+ * search uses an explicit stack of frames instead of recursion, since
+ * the search can be as deep as the number of nodes, which would
+ * overflow the call stack on large maps. Each frame holds a neighbour
+ * iterator, see graph_neighbour_begin() in graph.h, so that the search
+ * of a node continues where it left off when the search of one of its
+ * neighbours is done.
+ *
+ * Version information:
+ *	v1.0 2026-10-17 first public version
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "graph.h"
+#include "scc.h"
+
+// ===========INTERNAL DATA TYPES============
+
+/*
+ * Index representation. "component" has one element per node of the
+ * graph, and holds the component number of each node.
+ */
+struct scc_index
+{
+	int *component;
+	int num_nodes;
+	int num_components;
+};
+
+/*
+ * Frame of the depth-first search. "v" is the index of the node being
+ * searched, and "next" its next neighbour to look at, or NULL.
+ */
+struct frame
+{
+	int v;
+	node *next;
+	graph_neighbour_iter it;
+};
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - Give a node its discovery number and push a frame for it.
+ *
+ * @param g - Graph to search
+ * @param v - index of the node
+ * @param frames - stack of frames
+ * @param depth - number of frames, incremented
+ * @param order - discovery number of each node, or -1
+ * @param low - lowest discovery number reachable from each node
+ * @param counter - next discovery number, incremented
+ * @param stack - Tarjan's stack of nodes without a component
+ * @param top - number of nodes in "stack", incremented
+ */
+static void visit(const graph *g, int v, struct frame *frames, int *depth,
+		  int *order, int *low, int *counter, int *stack, int *top)
+{
+	order[v] = low[v] = (*counter)++;
+	stack[(*top)++] = v;
+
+	struct frame *f = &frames[(*depth)++];
+	f->v = v;
+	f->next = graph_neighbour_begin(g, graph_node_at(g, v), &f->it);
+}
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * @brief - Compute the strongly connected components of a graph
+ *
+ * @param g - Graph to inspect
+ * @return scc_index* - pointer to the created index
+ */
+scc_index *scc_create(const graph *g)
+{
+	int n = graph_num_nodes(g);
+	int size = n > 0 ? n : 1;
+	scc_index *s = malloc(sizeof(*s));
+	s->component = malloc(size * sizeof(int));
+	s->num_nodes = n;
+	s->num_components = 0;
+
+	// A node is on Tarjan's stack if it has been discovered but has no
+	// component yet.
+	int *order = malloc(size * sizeof(int));
+	int *low = malloc(size * sizeof(int));
+	int *stack = malloc(size * sizeof(int));
+	struct frame *frames = malloc(size * sizeof(struct frame));
+	int counter = 0;
+	int top = 0;
+	int depth = 0;
+	for (int i = 0; i < n; i++)
+	{
+		order[i] = -1;
+		s->component[i] = -1;
+	}
+
+	for (int root = 0; root < n; root++)
+	{
+		if (order[root] != -1)
+		{
+			continue;
+		}
+		visit(g, root, frames, &depth, order, low, &counter, stack, &top);
+
+		while (depth > 0)
+		{
+			struct frame *f = &frames[depth - 1];
+			int v = f->v;
+
+			if (f->next != NULL)
+			{
+				// Step past the neighbour before a new frame is
+				// pushed on top of this one.
+				int w = graph_node_index(g, f->next);
+				f->next = graph_neighbour_next(g, &f->it);
+
+				if (order[w] == -1)
+				{
+					visit(g, w, frames, &depth, order, low,
+					      &counter, stack, &top);
+				}
+				else if (s->component[w] == -1 && order[w] < low[v])
+				{
+					low[v] = order[w];
+				}
+				continue;
+			}
+
+			// All neighbours of v are done. If v is the root of a
+			// component, the component is v and the nodes above it
+			// on the stack.
+			if (low[v] == order[v])
+			{
+				int w;
+				do
+				{
+					w = stack[--top];
+					s->component[w] = s->num_components;
+				} while (w != v);
+				s->num_components++;
+			}
+
+			// Return to the parent.
+			depth--;
+			if (depth > 0 && low[v] < low[frames[depth - 1].v])
+			{
+				low[frames[depth - 1].v] = low[v];
+			}
+		}
+	}
+
+	free(order);
+	free(low);
+	free(stack);
+	free(frames);
+	return s;
+}
+
+/**
+ * @brief - Return the number of strongly connected components
+ *
+ * @param s - Index to inspect
+ * @return int - number of components
+ */
+int scc_num_components(const scc_index *s)
+{
+	return s->num_components;
+}
+
+/**
+ * @brief - Return the strongly connected component of a node
+ *
+ * @param s - Index to inspect
+ * @param i - node index
+ * @return int - number of the component containing node "i"
+ */
+int scc_component(const scc_index *s, int i)
+{
+	return s->component[i];
+}
+
+/**
+ * @brief - Check if two nodes are strongly connected
+ *
+ * @param s - Index to inspect
+ * @param i - first node index
+ * @param j - second node index
+ * @return true - if there are paths in both directions
+ * @return false - otherwise
+ */
+bool scc_strongly_connected(const scc_index *s, int i, int j)
+{
+	return s->component[i] == s->component[j];
+}
+
+/**
+ * @brief - Destroy an index
+ *
+ * @param s - Index to destroy
+ */
+void scc_kill(scc_index *s)
+{
+	free(s->component);
+	free(s);
+}
@@ -0,0 +1,77 @@
+#ifndef __SCC_H
+#define __SCC_H
+
+#include <stdbool.h>
+#include "graph.h"
+
+/*
+ * Declaration of the strongly connected components of a directed
+ * graph declared in graph.h. Two nodes are in the same strongly
+ * connected component if there are paths between them in both
+ * directions. The components are computed once by scc_create(), after
+ * which queries take constant time. The index works with all graph
+ * implementations.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ */
+
+// ====================== PUBLIC DATA TYPES ==========================
+
+typedef struct scc_index scc_index;
+
+// =================== SCC INDEX INTERFACE ======================
+
+/**
+ * scc_create() - Compute the strongly connected components of a graph.
+ * @g: Graph to inspect.
+ *
+ * The index is a snapshot of the graph. Create a new index after
+ * inserting nodes or edges. The graph may be killed while the index is
+ * used.
+ *
+ * Returns: A pointer to the new index.
+ */
+scc_index *scc_create(const graph *g);
+
+/**
+ * scc_num_components() - Return the number of strongly connected components.
+ * @s: Index to inspect.
+ *
+ * Returns: The number of components.
+ */
+int scc_num_components(const scc_index *s);
+
+/**
+ * scc_component() - Return the strongly connected component of a node.
+ * @s: Index to inspect.
+ * @i: Node index, see graph_node_index() in graph.h.
+ *
+ * The components are numbered 0 .. scc_num_components() - 1 in reverse
+ * topological order: if there is an edge from a node in component a to
+ * a node in another component b, then a > b. Hence there is no path
+ * from a node in component a to a node in component b if a < b.
+ *
+ * Returns: The number of the component containing node i.
+ */
+int scc_component(const scc_index *s, int i);
+
+/**
+ * scc_strongly_connected() - Check if two nodes are strongly connected.
+ * @s: Index to inspect.
+ * @i: First node index.
+ * @j: Second node index.
+ *
+ * Returns: True if there are paths from i to j and from j to i.
+ */
+bool scc_strongly_connected(const scc_index *s, int i, int j);
+
+/**
+ * scc_kill() - Destroy an index.
+ * @s: Index to destroy.
+ *
+ * Returns: Nothing.
+ */
+void scc_kill(scc_index *s);
+
+#endif
@@ -0,0 +1,304 @@
+/*
+ * Weighted shortest path queries for the CSR graph in graph3.c, used by
+ * "is_connected.c" in the "Data Structures and Algorithms" course
+ * at the Department of Computing Science, Umeå University.
+ *
+ * Dijkstra's algorithm and A* share one search loop: Dijkstra's
+ * algorithm is A* with a heuristic that is always 0. The priority of a
+ * node in the heap is its distance from the source plus the heuristic,
+ * and the heap is the 4-ary indexed heap from the code base, so the
+ * priority of a node already in the heap is lowered in place when a
+ * shorter path to it is found.
+ *
+ * The edges are read directly from the CSR arrays, see graph3.h. Like
+ * in graph_path.c, the search state of a node is only valid if its
+ * stamp equals the number of the current search, so no array has to be
+ * reset between queries.
+ *
+ * A node that has been taken from the heap is put back if a shorter path
+ * to it is found later, which only happens with a heuristic that is not
+ * consistent. The search thus stays correct for any heuristic that
+ * never overestimates the distance.
+ *
+ * Version information:
+ *	v1.0 2026-10-17 first public version
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+#include <index_heap.h>
+#include "graph.h"
+#include "graph3.h"
+#include "shortest_path.h"
+
+// Number of children of each node in the heap.
+#define HEAP_ARITY 4
+
+// ===========INTERNAL DATA TYPES============
+
+/*
+ * Search information for a node. Kept together so that a visit touches
+ * a single cache line.
+ *
+ * "stamp" equals the epoch of the route finder if the node has been
+ * reached in the current search. Then "dist" is the length of the
+ * shortest path to it found so far, "parent" the index of the node
+ * before it on that path, or -1 for the source, and "bound" the value
+ * of the heuristic for the node.
+ */
+struct visit
+{
+	unsigned stamp;
+	int parent;
+	double dist;
+	double bound;
+};
+
+/*
+ * Route finder representation. The CSR arrays of the graph are fetched
+ * once, since the graph may not change while the route finder is used.
+ * "weights" is NULL if all edges have weight 1.
+ */
+struct route_finder
+{
+	const graph *g;
+	const int *offsets;
+	const int *targets;
+	const double *weights;
+	struct visit *visits;
+	unsigned epoch;
+	index_heap *heap;
+	route_stats stats;
+};
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - The heuristic of Dijkstra's algorithm.
+ *
+ * @param v - index of a node
+ * @param dest - index of the destination
+ * @param arg - not used
+ * @return double - 0
+ */
+static double no_heuristic(int v, int dest, void *arg)
+{
+	return 0;
+}
+
+/**
+ * @brief - Record a path to a node, and put the node in the heap.
+ *
+ * @param rf - Route finder to update
+ * @param v - index of the node
+ * @param parent - index of the node before v on the path, or -1
+ * @param dist - length of the path
+ * @param dest - index of the destination
+ * @param h - heuristic
+ * @param arg - passed on to h
+ */
+static void reach(route_finder *rf, int v, int parent, double dist,
+		  int dest, route_heuristic *h, void *arg)
+{
+	struct visit *vi = &rf->visits[v];
+	if (vi->stamp != rf->epoch)
+	{
+		// First visit in this search.
+		vi->stamp = rf->epoch;
+		vi->bound = h(v, dest, arg);
+	}
+	vi->dist = dist;
+	vi->parent = parent;
+
+	double priority = dist + vi->bound;
+	if (index_heap_contains(rf->heap, v))
+	{
+		index_heap_decrease_key(rf->heap, v, priority);
+	}
+	else
+	{
+		index_heap_push(rf->heap, v, priority);
+	}
+}
+
+/**
+ * @brief - Search for a shortest path from "src" to "dest".
+ *
+ * @param rf - Route finder to use
+ * @param src - index of the source node
+ * @param dest - index of the destination node
+ * @param h - heuristic
+ * @param arg - passed on to h
+ * @return bool - true if a path was found
+ */
+static bool search(route_finder *rf, int src, int dest, route_heuristic *h,
+		   void *arg)
+{
+	// Move on to the next search number. The stamps only have to be
+	// cleared when the search number wraps around.
+	if (rf->epoch == UINT_MAX)
+	{
+		memset(rf->visits, 0,
+		       graph_num_nodes(rf->g) * sizeof(struct visit));
+		rf->epoch = 0;
+	}
+	rf->epoch++;
+	index_heap_clear(rf->heap);
+	memset(&rf->stats, 0, sizeof(rf->stats));
+
+	reach(rf, src, -1, 0, dest, h, arg);
+	while (!index_heap_is_empty(rf->heap))
+	{
+		int v = index_heap_top(rf->heap);
+		index_heap_pop(rf->heap);
+		rf->stats.settled++;
+		if (v == dest)
+		{
+			return true;
+		}
+
+		// Relax the edges of v.
+		double dist = rf->visits[v].dist;
+		for (int k = rf->offsets[v]; k < rf->offsets[v + 1]; k++)
+		{
+			int w = rf->targets[k];
+			double d = dist + (rf->weights != NULL ?
+					   rf->weights[k] : 1.0);
+			if (rf->visits[w].stamp != rf->epoch ||
+			    d < rf->visits[w].dist)
+			{
+				reach(rf, w, v, d, dest, h, arg);
+				rf->stats.improved++;
+			}
+		}
+		rf->stats.edges_checked += rf->offsets[v + 1] - rf->offsets[v];
+	}
+	return false;
+}
+
+/**
+ * @brief - Answer a query with a search and copy the path found.
+ *
+ * @param rf - Route finder to use
+ * @param src - source node
+ * @param dest - destination node
+ * @param h - heuristic
+ * @param arg - passed on to h
+ * @param path - array for the path, or NULL
+ * @param hops - output for the number of edges, or NULL
+ * @return double - length of the path, or -1 if there is none
+ */
+static double query(route_finder *rf, const node *src, const node *dest,
+		    route_heuristic *h, void *arg, node **path, int *hops)
+{
+	int s = graph_node_index(rf->g, src);
+	int d = graph_node_index(rf->g, dest);
+	if (!search(rf, s, d, h, arg))
+	{
+		return -1;
+	}
+
+	// Count the edges by following the parents back to the source,
+	// then store the path from the end.
+	int n = 0;
+	for (int v = d; v != s; v = rf->visits[v].parent)
+	{
+		n++;
+	}
+	if (path != NULL)
+	{
+		int v = d;
+		for (int k = n; k >= 0; k--)
+		{
+			path[k] = graph_node_at(rf->g, v);
+			v = rf->visits[v].parent;
+		}
+	}
+	if (hops != NULL)
+	{
+		*hops = n;
+	}
+	return rf->visits[d].dist;
+}
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * @brief - Create a route finder for a graph
+ *
+ * @param g - Graph to search in
+ * @return route_finder* - pointer to the created route finder
+ */
+route_finder *route_finder_create(const graph *g)
+{
+	int n = graph_num_nodes(g);
+	route_finder *rf = calloc(1, sizeof(*rf));
+	rf->g = g;
+	graph_csr(g, &rf->offsets, &rf->targets);
+	rf->weights = graph_csr_weights(g);
+	rf->visits = calloc(n > 0 ? n : 1, sizeof(struct visit));
+	rf->epoch = 0;
+	rf->heap = index_heap_empty(n, HEAP_ARITY);
+	return rf;
+}
+
+/**
+ * @brief - Find a path with the lowest total weight between two nodes
+ *
+ * @param rf - Route finder for the graph storing the nodes
+ * @param src - source node
+ * @param dest - destination node
+ * @param path - array to store the path in, or NULL
+ * @param hops - output for the number of edges on the path, or NULL
+ * @return double - length of the shortest path, or -1 if there is none
+ */
+double graph_shortest_path(route_finder *rf, const node *src,
+			   const node *dest, node **path, int *hops)
+{
+	return query(rf, src, dest, no_heuristic, NULL, path, hops);
+}
+
+/**
+ * @brief - Find a path with the lowest total weight using A*
+ *
+ * @param rf - Route finder for the graph storing the nodes
+ * @param src - source node
+ * @param dest - destination node
+ * @param h - heuristic, a lower bound of the distance to dest
+ * @param arg - passed on to h
+ * @param path - array to store the path in, or NULL
+ * @param hops - output for the number of edges on the path, or NULL
+ * @return double - length of the shortest path, or -1 if there is none
+ */
+double graph_shortest_path_astar(route_finder *rf, const node *src,
+				 const node *dest, route_heuristic *h,
+				 void *arg, node **path, int *hops)
+{
+	return query(rf, src, dest, h, arg, path, hops);
+}
+
+/**
+ * @brief - Get statistics for the last query
+ *
+ * @param rf - Route finder to inspect
+ * @param stats - output for the statistics
+ */
+void route_finder_stats(const route_finder *rf, route_stats *stats)
+{
+	*stats = rf->stats;
+}
+
+/**
+ * @brief - Destroy a route finder
+ *
+ * @param rf - Route finder to destroy
+ */
+void route_finder_kill(route_finder *rf)
+{
+	index_heap_kill(rf->heap);
+	free(rf->visits);
+	free(rf);
+}
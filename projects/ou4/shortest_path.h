@@ -0,0 +1,113 @@
+#ifndef __SHORTEST_PATH_H
+#define __SHORTEST_PATH_H
+
+#include "graph.h"
+
+/*
+ * Declaration of weighted shortest path queries on the CSR graph in
+ * graph3.c, using the edge weights given to
+ * graph_insert_weighted_edge(). The weights must not be negative.
+ *
+ * graph_shortest_path() uses Dijkstra's algorithm. It takes the reached
+ * nodes in order of their distance from the source with an indexed
+ * heap, see index_heap.h in the code base, and stops when the
+ * destination is taken. graph_shortest_path_astar() uses A*, which adds
+ * a lower bound of the remaining distance to the priority of each node,
+ * so that nodes in the direction of the destination are taken first and
+ * far fewer nodes are visited on e.g. road maps.
+ *
+ * A route finder holds the memory used by the searches, so that many
+ * queries can be answered on the same graph without allocating memory.
+ * Only the nodes reached by a query are looked at by the next one.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ */
+
+// ====================== PUBLIC DATA TYPES ==========================
+
+typedef struct route_finder route_finder;
+
+// Lower bound of the distance from node index v to node index dest,
+// see graph_shortest_path_astar(). arg is passed on unchanged.
+typedef double route_heuristic(int v, int dest, void *arg);
+
+// Statistics for the last query, see route_finder_stats().
+typedef struct route_stats {
+	int settled; // Number of nodes taken from the heap.
+	long edges_checked; // Number of edges looked at.
+	long improved; // Number of edges that gave a shorter distance.
+} route_stats;
+
+// =================== ROUTE FINDER INTERFACE ======================
+
+/**
+ * route_finder_create() - Create a route finder for a graph.
+ * @g: Graph to search in. Must be a graph from graph3.c.
+ *
+ * No edges may be inserted into the graph while the route finder is
+ * used. Create a new route finder after changing the edges. The graph
+ * must not be killed while the route finder is used.
+ *
+ * Returns: A pointer to the new route finder.
+ */
+route_finder *route_finder_create(const graph *g);
+
+/**
+ * graph_shortest_path() - Find a path with the lowest total weight.
+ * @rf: Route finder for the graph storing the nodes.
+ * @src: Source node.
+ * @dest: Destination node.
+ * @path: Array to store the path in, or NULL. If not NULL, it must have
+ *	  room for graph_num_nodes() nodes. On success, path[0] is src and
+ *	  path[*hops] is dest.
+ * @hops: Output, or NULL. Receives the number of edges on the path.
+ *
+ * Returns: The sum of the weights of the edges on a shortest path from
+ *	    src to dest, or -1 if there is no path.
+ */
+double graph_shortest_path(route_finder *rf, const node *src,
+			   const node *dest, node **path, int *hops);
+
+/**
+ * graph_shortest_path_astar() - Find a path with the lowest total weight
+ *				 using A*.
+ * @rf: Route finder for the graph storing the nodes.
+ * @src: Source node.
+ * @dest: Destination node.
+ * @h: Heuristic. h(v, d, arg) must never be larger than the distance
+ *     from node index v to node index d, see graph_node_index(), e.g.
+ *     the straight-line distance between two places on a map.
+ * @arg: Passed on to h.
+ * @path: As for graph_shortest_path().
+ * @hops: As for graph_shortest_path().
+ *
+ * The result is the same as for graph_shortest_path(). The search is
+ * fastest if the heuristic is also consistent, i.e. if h(u, d) is at
+ * most the weight of an edge from u to v plus h(v, d). Otherwise nodes
+ * may have to be visited more than once.
+ *
+ * Returns: As for graph_shortest_path().
+ */
+double graph_shortest_path_astar(route_finder *rf, const node *src,
+				 const node *dest, route_heuristic *h,
+				 void *arg, node **path, int *hops);
+
+/**
+ * route_finder_stats() - Get statistics for the last query.
+ * @rf: Route finder to inspect.
+ * @stats: Output. Receives the statistics.
+ *
+ * Returns: Nothing.
+ */
+void route_finder_stats(const route_finder *rf, route_stats *stats);
+
+/**
+ * route_finder_kill() - Destroy a route finder.
+ * @rf: Route finder to destroy.
+ *
+ * Returns: Nothing.
+ */
+void route_finder_kill(route_finder *rf);
+
+#endif
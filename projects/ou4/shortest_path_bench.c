@@ -0,0 +1,377 @@
+// Needed for clock_gettime() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+/*
+ * Benchmark for graph_shortest_path() and graph_shortest_path_astar()
+ * in shortest_path.c.
+ *
+ * Two kinds of weighted graphs are built in the CSR graph in graph3.c:
+ *  - a grid, where each node has edges to its four neighbours with
+ *    random weights between 1 and 2. The A* heuristic is the Manhattan
+ *    distance, since no edge is shorter than 1.
+ *  - a road-like graph of random places in the unit square, where each
+ *    place has edges to all places within a radius chosen to give about
+ *    six roads per place. The weight of a road is its length times a
+ *    random detour factor between 1 and 1.5. The A* heuristic is the
+ *    straight-line distance.
+ * For each graph, the same random queries are answered with Dijkstra's
+ * algorithm and with A*, and the average time and number of settled
+ * nodes per query are printed. The results of the two are compared.
+ *
+ * Usage: shortest_path_bench [grid side] [number of places] [queries]
+ *
+ * Compile with:
+ *	gcc -std=c99 -Wall -O2 -I../../code_base/current/include
+ *	    shortest_path_bench.c shortest_path.c graph3.c union_find.c
+ *	    label_index.c
+ *	    ../../code_base/current/src/index_heap/index_heap.c
+ *	    ../../code_base/current/src/dlist/dlist.c -lm
+ *	    -o shortest_path_bench
+ *
+ * Version information:
+ *	v1.0 2026-10-17 first public version
+ *	v1.1 2026-10-17 queries without a path no longer count as different
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "graph.h"
+#include "shortest_path.h"
+
+// Defaults for the command line arguments.
+#define DEFAULT_SIDE 1000
+#define DEFAULT_PLACES 1000000
+#define DEFAULT_QUERIES 20
+
+// Average number of roads per place in the road-like graph.
+#define ROADS_PER_PLACE 6
+
+#define LABEL_LENGTH 16
+
+// M_PI is not part of -std=c99.
+#define PI 3.14159265358979323846
+
+// ===========INTERNAL DATA TYPES============
+
+/*
+ * Coordinates of the nodes of a graph, by node index, for the
+ * heuristics. For the grid, node i is at (i % side, i / side).
+ */
+struct coords
+{
+	int side;
+	double *x;
+	double *y;
+};
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - Return the current time in seconds.
+ *
+ * @return double - seconds since an arbitrary point
+ */
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief - Return a pseudo-random number (xorshift64*).
+ *
+ * @param state - generator state, must not be 0
+ * @return uint64_t - the next number
+ */
+static uint64_t next_random(uint64_t *state)
+{
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief - Return a pseudo-random number in [0, 1).
+ *
+ * @param state - generator state, must not be 0
+ * @return double - the next number
+ */
+static double next_double(uint64_t *state)
+{
+	return (next_random(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @brief - Create a graph with the given number of nodes.
+ *
+ * @param n - number of nodes
+ * @return graph* - the created graph, with node i labelled "<i>"
+ */
+static graph *make_nodes(int n)
+{
+	graph *g = graph_empty(n);
+	char label[LABEL_LENGTH];
+	for (int i = 0; i < n; i++)
+	{
+		sprintf(label, "%d", i);
+		g = graph_insert_node(g, label);
+	}
+	return g;
+}
+
+/**
+ * @brief - Manhattan distance heuristic for the grid.
+ *
+ * @param v - index of a node
+ * @param dest - index of the destination
+ * @param arg - the struct coords of the grid
+ * @return double - the Manhattan distance between the nodes
+ */
+static double manhattan(int v, int dest, void *arg)
+{
+	const struct coords *c = arg;
+	return abs(v % c->side - dest % c->side) +
+	       abs(v / c->side - dest / c->side);
+}
+
+/**
+ * @brief - Straight-line distance heuristic for the road-like graph.
+ *
+ * @param v - index of a node
+ * @param dest - index of the destination
+ * @param arg - the struct coords of the places
+ * @return double - the distance between the places
+ */
+static double straight_line(int v, int dest, void *arg)
+{
+	const struct coords *c = arg;
+	return hypot(c->x[v] - c->x[dest], c->y[v] - c->y[dest]);
+}
+
+/**
+ * @brief - Build a grid graph.
+ *
+ * @param side - number of nodes along each side
+ * @param c - coordinates to fill in
+ * @return graph* - the created graph
+ */
+static graph *make_grid(int side, struct coords *c)
+{
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	graph *g = make_nodes(side * side);
+	for (int i = 0; i < side * side; i++)
+	{
+		int x = i % side;
+		int y = i / side;
+		int neighbours[4] = { x > 0 ? i - 1 : -1,
+				      x < side - 1 ? i + 1 : -1,
+				      y > 0 ? i - side : -1,
+				      y < side - 1 ? i + side : -1 };
+		for (int k = 0; k < 4; k++)
+		{
+			if (neighbours[k] >= 0)
+			{
+				g = graph_insert_weighted_edge(
+					g, graph_node_at(g, i),
+					graph_node_at(g, neighbours[k]),
+					1.0 + next_double(&state));
+			}
+		}
+	}
+	c->side = side;
+	c->x = NULL;
+	c->y = NULL;
+	return g;
+}
+
+/**
+ * @brief - Build a road-like graph.
+ *
+ * The places are sorted into square cells with the side of the road
+ * radius, so that the places within the radius are found in the 3 x 3
+ * cells around each place.
+ *
+ * @param n - number of places
+ * @param c - coordinates to fill in
+ * @return graph* - the created graph
+ */
+static graph *make_roads(int n, struct coords *c)
+{
+	uint64_t state = 0x2545F4914F6CDD1DULL;
+	double radius = sqrt(ROADS_PER_PLACE / (PI * n));
+	int cells = (int)(1 / radius) + 1;
+
+	c->side = 0;
+	c->x = malloc(n * sizeof(double));
+	c->y = malloc(n * sizeof(double));
+	for (int i = 0; i < n; i++)
+	{
+		c->x[i] = next_double(&state);
+		c->y[i] = next_double(&state);
+	}
+
+	// Counting sort of the places by cell.
+	int *start = calloc((size_t)cells * cells + 1, sizeof(int));
+	int *cell = malloc(n * sizeof(int));
+	int *order = malloc(n * sizeof(int));
+	for (int i = 0; i < n; i++)
+	{
+		cell[i] = (int)(c->y[i] / radius) * cells +
+			  (int)(c->x[i] / radius);
+		start[cell[i] + 1]++;
+	}
+	for (int k = 0; k < cells * cells; k++)
+	{
+		start[k + 1] += start[k];
+	}
+	int *fill = malloc((size_t)cells * cells * sizeof(int));
+	for (int k = 0; k < cells * cells; k++)
+	{
+		fill[k] = start[k];
+	}
+	for (int i = 0; i < n; i++)
+	{
+		order[fill[cell[i]]++] = i;
+	}
+	free(fill);
+
+	graph *g = make_nodes(n);
+	for (int i = 0; i < n; i++)
+	{
+		int cx = cell[i] % cells;
+		int cy = cell[i] / cells;
+		for (int y = cy - 1; y <= cy + 1; y++)
+		{
+			for (int x = cx - 1; x <= cx + 1; x++)
+			{
+				if (x < 0 || y < 0 || x >= cells || y >= cells)
+				{
+					continue;
+				}
+				int k = y * cells + x;
+				for (int p = start[k]; p < start[k + 1]; p++)
+				{
+					int j = order[p];
+					double d = hypot(c->x[i] - c->x[j],
+							 c->y[i] - c->y[j]);
+					if (j != i && d < radius)
+					{
+						g = graph_insert_weighted_edge(
+							g, graph_node_at(g, i),
+							graph_node_at(g, j),
+							d * (1.0 + 0.5 *
+							     next_double(&state)));
+					}
+				}
+			}
+		}
+	}
+	free(start);
+	free(cell);
+	free(order);
+	return g;
+}
+
+/**
+ * @brief - Answer random queries with Dijkstra's algorithm and with A*.
+ *
+ * @param name - name of the graph to print
+ * @param g - Graph to search in
+ * @param h - heuristic for A*
+ * @param c - coordinates, passed on to h
+ * @param queries - number of queries
+ * @return bool - true if both algorithms gave the same distances
+ */
+static bool run(const char *name, const graph *g, route_heuristic *h,
+		struct coords *c, int queries)
+{
+	int n = graph_num_nodes(g);
+	route_finder *rf = route_finder_create(g);
+	uint64_t state = 0x853C49E6748FEA9BULL;
+	double time[2] = { 0, 0 };
+	long settled[2] = { 0, 0 };
+	bool ok = true;
+	int found = 0;
+
+	for (int q = 0; q < queries; q++)
+	{
+		node *src = graph_node_at(g, next_random(&state) % n);
+		node *dest = graph_node_at(g, next_random(&state) % n);
+		double dist[2];
+		route_stats stats;
+
+		double t0 = now();
+		dist[0] = graph_shortest_path(rf, src, dest, NULL, NULL);
+		time[0] += now() - t0;
+		route_finder_stats(rf, &stats);
+		settled[0] += stats.settled;
+
+		t0 = now();
+		dist[1] = graph_shortest_path_astar(rf, src, dest, h, c, NULL,
+						    NULL);
+		time[1] += now() - t0;
+		route_finder_stats(rf, &stats);
+		settled[1] += stats.settled;
+
+		// The sums of the weights may be added in another order.
+		// Both are -1 if there is no path.
+		if (fabs(dist[0] - dist[1]) > 1e-9 * fabs(dist[0]))
+		{
+			ok = false;
+		}
+		found += dist[0] >= 0;
+	}
+	route_finder_kill(rf);
+
+	const char *algorithms[2] = { "Dijkstra", "A*" };
+	for (int a = 0; a < 2; a++)
+	{
+		printf("%-6s %-10s %10.3f %12.0f\n", name, algorithms[a],
+		       time[a] / queries * 1e3, (double)settled[a] / queries);
+	}
+	printf("%-6s %d of %d queries had a path, results %s\n\n", name,
+	       found, queries, ok ? "agree" : "DIFFER");
+	return ok;
+}
+
+// ===========MAIN============
+
+int main(int argc, char **argv)
+{
+	int side = argc > 1 ? atoi(argv[1]) : DEFAULT_SIDE;
+	int places = argc > 2 ? atoi(argv[2]) : DEFAULT_PLACES;
+	int queries = argc > 3 ? atoi(argv[3]) : DEFAULT_QUERIES;
+	if (side <= 0 || places <= 0 || queries <= 0)
+	{
+		fprintf(stderr, "Usage: %s [grid side] [number of places] "
+			"[queries]\n", argv[0]);
+		exit(EXIT_FAILURE);
+	}
+
+	struct coords grid_coords;
+	struct coords road_coords;
+	double t0 = now();
+	graph *grid = make_grid(side, &grid_coords);
+	printf("Built %d x %d grid in %.2f s\n", side, side, now() - t0);
+	t0 = now();
+	graph *roads = make_roads(places, &road_coords);
+	printf("Built road-like graph with %d places in %.2f s\n\n", places,
+	       now() - t0);
+
+	printf("%-6s %-10s %10s %12s\n", "graph", "algorithm", "ms/query",
+	       "settled");
+	bool ok = run("grid", grid, manhattan, &grid_coords, queries);
+	ok = run("roads", roads, straight_line, &road_coords, queries) && ok;
+
+	graph_kill(grid);
+	graph_kill(roads);
+	free(road_coords.x);
+	free(road_coords.y);
+	return ok ? 0 : 1;
+}
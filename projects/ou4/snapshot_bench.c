@@ -0,0 +1,196 @@
+// Needed for clock_gettime() with -std=c99.
+#define _POSIX_C_SOURCE 200809L
+
+/*
+ * Startup benchmark for graph_save_snapshot() and graph_load_snapshot()
+ * in graph3.c.
+ *
+ * Builds a graph, either with random edges between the given number of
+ * nodes or from a map file with map_load(), saves it as a snapshot and
+ * loads it again. For the loaded graph, the time of the load itself, of
+ * the first label lookup and neighbour listing, and of the first
+ * graph_num_components(), which builds the component index, are
+ * printed. The CSR arrays of the two graphs are then compared, and the
+ * snapshot file is removed.
+ *
+ * The snapshot has just been written, so it is read from the page cache.
+ *
+ * Usage: snapshot_bench [number of nodes] [number of edges] [map file]
+ *
+ * Compile with:
+ *	gcc -std=c99 -Wall -O2 -I../../code_base/current/include
+ *	    snapshot_bench.c map_loader.c graph3.c union_find.c label_index.c
+ *	    ../../code_base/current/src/dlist/dlist.c -o snapshot_bench
+ *
+ * Version information:
+ *	v1.0 2026-10-17 first public version
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "graph.h"
+#include "graph3.h"
+#include "map_loader.h"
+
+// Defaults for the command line arguments.
+#define DEFAULT_NODES (1 << 20)
+#define DEFAULT_EDGES 10000000L
+#define SNAPSHOT_FILE "snapshot_bench.snap"
+
+#define LABEL_LENGTH 16
+
+// ===========INTERNAL HELP FUNCTIONS============
+
+/**
+ * @brief - Return the current time in seconds.
+ *
+ * @return double - seconds since an arbitrary point
+ */
+static double now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief - Return a pseudo-random number (xorshift64*).
+ *
+ * @param state - generator state, must not be 0
+ * @return uint64_t - the next number
+ */
+static uint64_t next_random(uint64_t *state)
+{
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 0x2545F4914F6CDD1DULL;
+}
+
+/**
+ * @brief - Create a graph with random edges.
+ *
+ * The node with index i has the label "N<i>".
+ *
+ * @param nodes - number of nodes
+ * @param edges - number of edges
+ * @return graph* - the created graph
+ */
+static graph *generate(int nodes, long edges)
+{
+	graph *g = graph_empty(nodes);
+	char label[LABEL_LENGTH];
+	for (int i = 0; i < nodes; i++)
+	{
+		sprintf(label, "N%d", i);
+		g = graph_insert_node(g, label);
+	}
+
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	for (long e = 0; e < edges; e++)
+	{
+		node *src = graph_node_at(g, next_random(&state) % nodes);
+		node *dest = graph_node_at(g, next_random(&state) % nodes);
+		g = graph_insert_edge(g, src, dest);
+	}
+	return g;
+}
+
+/**
+ * @brief - Check that two graphs have the same CSR arrays.
+ *
+ * @param g - first graph
+ * @param h - second graph
+ * @return bool - true if the arrays are equal
+ */
+static bool same_csr(const graph *g, const graph *h)
+{
+	const int *g_offsets;
+	const int *g_targets;
+	const int *h_offsets;
+	const int *h_targets;
+	int n = graph_num_nodes(g);
+	graph_csr(g, &g_offsets, &g_targets);
+	graph_csr(h, &h_offsets, &h_targets);
+	return n == graph_num_nodes(h) &&
+	       memcmp(g_offsets, h_offsets, (n + 1) * sizeof(int)) == 0 &&
+	       memcmp(g_targets, h_targets, g_offsets[n] * sizeof(int)) == 0;
+}
+
+// ===========MAIN============
+
+int main(int argc, char **argv)
+{
+	int nodes = argc > 1 ? atoi(argv[1]) : DEFAULT_NODES;
+	long edges = argc > 2 ? atol(argv[2]) : DEFAULT_EDGES;
+	if (nodes <= 0 || edges < 0)
+	{
+		fprintf(stderr, "Usage: %s [number of nodes] [number of edges] "
+			"[map file]\n", argv[0]);
+		exit(EXIT_FAILURE);
+	}
+
+	double t0 = now();
+	graph *g = argc > 3 ? map_load(argv[3]) : generate(nodes, edges);
+	if (g == NULL)
+	{
+		exit(EXIT_FAILURE);
+	}
+	// The first graph_csr() builds the CSR arrays from all edges.
+	const int *offsets;
+	const int *targets;
+	graph_csr(g, &offsets, &targets);
+	printf("Built graph: %d nodes, %d edges in %.2f s\n\n",
+	       graph_num_nodes(g), offsets[graph_num_nodes(g)], now() - t0);
+
+	t0 = now();
+	if (!graph_save_snapshot(g, SNAPSHOT_FILE))
+	{
+		exit(EXIT_FAILURE);
+	}
+	printf("%-24s %10.3f ms\n", "save", (now() - t0) * 1e3);
+
+	t0 = now();
+	graph *h = graph_load_snapshot(SNAPSHOT_FILE);
+	if (h == NULL)
+	{
+		exit(EXIT_FAILURE);
+	}
+	printf("%-24s %10.3f ms\n", "load", (now() - t0) * 1e3);
+
+	// Look up a label, which touches the label index, and list the
+	// neighbours of the last node, which lie at the end of the file.
+	graph_neighbour_iter it;
+	t0 = now();
+	bool found = graph_find_node(h, "no such label") != NULL;
+	node *last = graph_node_at(h, graph_num_nodes(h) - 1);
+	int degree = 0;
+	for (node *m = graph_neighbour_begin(h, last, &it); m != NULL;
+	     m = graph_neighbour_next(h, &it))
+	{
+		degree++;
+	}
+	printf("%-24s %10.3f ms\n", "first find + neighbours",
+	       (now() - t0) * 1e3);
+
+	t0 = now();
+	int components = graph_num_components(h);
+	printf("%-24s %10.3f ms\n", "component index",
+	       (now() - t0) * 1e3);
+
+	int n = graph_num_nodes(g);
+	bool ok = same_csr(g, h) && !found &&
+		  degree == offsets[n] - offsets[n - 1] &&
+		  components == graph_num_components(g);
+	printf("\nReloaded graph %s the original.\n",
+	       ok ? "equals" : "DIFFERS FROM");
+
+	graph_kill(h);
+	graph_kill(g);
+	remove(SNAPSHOT_FILE);
+	return ok ? 0 : 1;
+}
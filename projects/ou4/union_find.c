@@ -0,0 +1,175 @@
+/*
+ * Union-find structure used by the graph implementations for the
+ * "Data Structures and Algorithms" course at the Department of
+ * Computing Science, Umeå University.
+ *
+ * Each set is a tree stored as parent links in an array, with the
+ * representative at the root. The rank of a root is an upper bound on
+ * the height of its tree, and the root with the lower rank is put
+ * under the other one when two sets are merged. uf_find() makes every
+ * node on the path point directly to the root. Both loops are
+ * iterative, so long paths cannot overflow the call stack.
+ *
+ * Version information:
+ *	v1.0 2026-10-17 first public version
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "union_find.h"
+
+// ===========INTERNAL DATA TYPES============
+
+/*
+ * Union-find representation. "parent" and "rank" have room for
+ * "capacity" elements, of which the first "n" are used, and
+ * "parent[i] == i" for the roots. "sets" is the number of roots.
+ */
+struct union_find
+{
+	int *parent;
+	unsigned char *rank;
+	int n;
+	int capacity;
+	int sets;
+};
+
+// ===========INTERNAL FUNCTION IMPLEMENTATIONS============
+
+/**
+ * @brief - Create an empty union-find structure
+ *
+ * @param capacity - number of elements to make room for
+ * @return union_find* - pointer to the created structure
+ */
+union_find *uf_create(int capacity)
+{
+	union_find *uf = malloc(sizeof(*uf));
+	uf->capacity = capacity > 0 ? capacity : 1;
+	uf->parent = malloc(uf->capacity * sizeof(int));
+	uf->rank = malloc(uf->capacity * sizeof(unsigned char));
+	uf->n = 0;
+	uf->sets = 0;
+	return uf;
+}
+
+/**
+ * @brief - Add an element in a set of its own
+ *
+ * @param uf - Union-find structure
+ * @return int - the new element
+ */
+int uf_make_set(union_find *uf)
+{
+	if (uf->n == uf->capacity)
+	{
+		uf->capacity *= 2;
+		uf->parent = realloc(uf->parent, uf->capacity * sizeof(int));
+		uf->rank = realloc(uf->rank,
+				   uf->capacity * sizeof(unsigned char));
+	}
+	uf->parent[uf->n] = uf->n;
+	uf->rank[uf->n] = 0;
+	uf->sets++;
+	return uf->n++;
+}
+
+/**
+ * @brief - Find the representative of the set containing an element
+ *
+ * @param uf - Union-find structure
+ * @param i - element
+ * @return int - the root of the tree containing "i"
+ */
+int uf_find(union_find *uf, int i)
+{
+	// Find the root.
+	int root = i;
+	while (uf->parent[root] != root)
+	{
+		root = uf->parent[root];
+	}
+
+	// Let every node on the path point directly to the root.
+	while (uf->parent[i] != root)
+	{
+		int next = uf->parent[i];
+		uf->parent[i] = root;
+		i = next;
+	}
+	return root;
+}
+
+/**
+ * @brief - Merge the sets containing two elements
+ *
+ * @param uf - Union-find structure
+ * @param i - first element
+ * @param j - second element
+ * @return true - if the sets were merged
+ * @return false - if "i" and "j" already were in the same set
+ */
+bool uf_union(union_find *uf, int i, int j)
+{
+	int a = uf_find(uf, i);
+	int b = uf_find(uf, j);
+	if (a == b)
+	{
+		return false;
+	}
+
+	// Put the lower tree under the higher one.
+	if (uf->rank[a] < uf->rank[b])
+	{
+		uf->parent[a] = b;
+	}
+	else if (uf->rank[a] > uf->rank[b])
+	{
+		uf->parent[b] = a;
+	}
+	else
+	{
+		uf->parent[b] = a;
+		uf->rank[a]++;
+	}
+	uf->sets--;
+	return true;
+}
+
+/**
+ * @brief - Check if two elements are in the same set
+ *
+ * @param uf - Union-find structure
+ * @param i - first element
+ * @param j - second element
+ * @return true - if "i" and "j" are in the same set
+ * @return false - otherwise
+ */
+bool uf_same_set(union_find *uf, int i, int j)
+{
+	return uf_find(uf, i) == uf_find(uf, j);
+}
+
+/**
+ * @brief - Return the number of sets
+ *
+ * @param uf - Union-find structure
+ * @return int - number of disjoint sets
+ */
+int uf_num_sets(const union_find *uf)
+{
+	return uf->sets;
+}
+
+/**
+ * @brief - Destroy a union-find structure
+ *
+ * @param uf - Union-find structure to destroy
+ */
+void uf_kill(union_find *uf)
+{
+	free(uf->parent);
+	free(uf->rank);
+	free(uf);
+}
@@ -0,0 +1,95 @@
+#ifndef __UNION_FIND_H
+#define __UNION_FIND_H
+
+#include <stdbool.h>
+
+/*
+ * Declaration of a union-find (disjoint-set) structure over the
+ * integers 0 .. n - 1. Elements are added one at a time with
+ * uf_make_set(), each in a set of its own, and sets are merged with
+ * uf_union(). The structure uses union by rank and path compression,
+ * so that a sequence of operations takes O(alpha(n)) amortized time
+ * per operation, where alpha is the very slowly growing inverse
+ * Ackermann function.
+ *
+ * The graph implementations use it to keep track of the weakly
+ * connected components of the graph as edges are inserted, see
+ * graph_nodes_are_connected() in graph.h.
+ *
+ * Version information:
+ *   v1.0 2026-10-17: First public version.
+ */
+
+// ====================== PUBLIC DATA TYPES ==========================
+
+typedef struct union_find union_find;
+
+// =================== UNION-FIND INTERFACE ======================
+
+/**
+ * uf_create() - Create an empty union-find structure.
+ * @capacity: Number of elements to make room for. More elements may be
+ *	      added, at the cost of reallocating the arrays.
+ *
+ * Returns: A pointer to the new structure.
+ */
+union_find *uf_create(int capacity);
+
+/**
+ * uf_make_set() - Add an element in a set of its own.
+ * @uf: Union-find structure to modify.
+ *
+ * Returns: The new element, which is the number of elements added
+ *	    before it.
+ */
+int uf_make_set(union_find *uf);
+
+/**
+ * uf_find() - Find the representative of the set containing an element.
+ * @uf: Union-find structure to inspect.
+ * @i: Element, 0 <= i < n.
+ *
+ * Shortens the path from i to the representative, which is why uf is
+ * not const.
+ *
+ * Returns: The representative element of the set containing i.
+ */
+int uf_find(union_find *uf, int i);
+
+/**
+ * uf_union() - Merge the sets containing two elements.
+ * @uf: Union-find structure to modify.
+ * @i: First element.
+ * @j: Second element.
+ *
+ * Returns: True if i and j were in different sets, otherwise false.
+ */
+bool uf_union(union_find *uf, int i, int j);
+
+/**
+ * uf_same_set() - Check if two elements are in the same set.
+ * @uf: Union-find structure to inspect.
+ * @i: First element.
+ * @j: Second element.
+ *
+ * Returns: True if i and j are in the same set, otherwise false.
+ */
+bool uf_same_set(union_find *uf, int i, int j);
+
+/**
+ * uf_num_sets() - Return the number of sets.
+ * @uf: Union-find structure to inspect.
+ *
+ * Returns: The number of disjoint sets.
+ */
+int uf_num_sets(const union_find *uf);
+
+/**
+ * uf_kill() - Destroy a union-find structure.
+ * @uf: Union-find structure to destroy.
+ *
+ * Returns: Nothing.
+ */
+void uf_kill(union_find *uf);
+
+#endif